@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/compact-full-name.hpp"
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/util/sha256.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <cstring>
+
+namespace ndn {
+
+/** @brief Compare the ImplicitSha256DigestComponent holding @p digest with @p component.
+ *  @return same as `Component::fromImplicitSha256Digest(digest).compare(component)`, in sign
+ */
+static int
+compareDigestComponent(const uint8_t* digest, const name::Component& component)
+{
+  if (component.type() != tlv::ImplicitSha256DigestComponent) {
+    return tlv::ImplicitSha256DigestComponent < component.type() ? -1 : 1;
+  }
+  if (component.value_size() != util::Sha256::DIGEST_SIZE) {
+    return util::Sha256::DIGEST_SIZE < component.value_size() ? -1 : 1;
+  }
+  return std::memcmp(digest, component.value(), util::Sha256::DIGEST_SIZE);
+}
+
+CompactFullName::CompactFullName(const Name& name, ConstBufferPtr digest)
+  : m_name(&name)
+  , m_digest(std::move(digest))
+{
+  if (m_digest == nullptr || m_digest->size() != util::Sha256::DIGEST_SIZE) {
+    NDN_THROW(std::invalid_argument("Implicit digest must be a SHA-256 digest"));
+  }
+}
+
+CompactFullName::CompactFullName(const Data& data)
+  : m_name(&data.getName())
+  , m_digest(data.getImplicitDigest())
+{
+}
+
+Name
+CompactFullName::toName() const
+{
+  return Name(*m_name).appendImplicitSha256Digest(m_digest);
+}
+
+bool
+CompactFullName::hasPrefix(const Name& prefix) const
+{
+  size_t n = m_name->size();
+  if (prefix.size() <= n) {
+    return prefix.isPrefixOf(*m_name);
+  }
+  return prefix.size() == n + 1 &&
+         prefix.compare(0, n, *m_name) == 0 &&
+         compareDigestComponent(m_digest->data(), prefix[n]) == 0;
+}
+
+int
+CompactFullName::compare(const Name& other) const
+{
+  size_t n = m_name->size();
+  size_t count = std::min(n, other.size());
+  int cmp = m_name->compare(0, count, other, 0, count);
+  if (cmp != 0) {
+    return cmp;
+  }
+  if (other.size() <= n) {
+    return 1; // other is a proper prefix of the full name
+  }
+
+  cmp = compareDigestComponent(m_digest->data(), other[n]);
+  if (cmp != 0) {
+    return cmp;
+  }
+  return other.size() == n + 1 ? 0 : -1;
+}
+
+int
+CompactFullName::compare(const CompactFullName& other) const
+{
+  size_t n1 = m_name->size();
+  size_t n2 = other.m_name->size();
+  size_t count = std::min(n1, n2);
+  int cmp = m_name->compare(0, count, *other.m_name, 0, count);
+  if (cmp != 0) {
+    return cmp;
+  }
+
+  if (n1 == n2) {
+    return std::memcmp(m_digest->data(), other.m_digest->data(), util::Sha256::DIGEST_SIZE);
+  }
+  if (n1 < n2) {
+    cmp = compareDigestComponent(m_digest->data(), (*other.m_name)[n1]);
+    return cmp != 0 ? cmp : -1;
+  }
+  cmp = compareDigestComponent(other.m_digest->data(), (*m_name)[n2]);
+  return cmp != 0 ? -cmp : 1;
+}
+
+size_t
+CompactFullName::hash() const
+{
+  // hash the wire encoding of toName() as a single range, as std::hash<Name> does;
+  // boost::hash_range gives a different result when the range is hashed in pieces
+  const Block& nameWire = m_name->wireEncode();
+  size_t valueSize = nameWire.value_size() + 2 + util::Sha256::DIGEST_SIZE;
+
+  // TLV-TYPE and TLV-LENGTH of the Name are at most 9 octets each
+  EncodingBuffer encoder(valueSize + 2 * 9, 0);
+  encoder.prependByteArray(m_digest->data(), m_digest->size());
+  encoder.prependVarNumber(util::Sha256::DIGEST_SIZE);
+  encoder.prependVarNumber(tlv::ImplicitSha256DigestComponent);
+  encoder.prependRange(nameWire.value_begin(), nameWire.value_end());
+  encoder.prependVarNumber(valueSize);
+  encoder.prependVarNumber(tlv::Name);
+  return boost::hash_range(encoder.begin(), encoder.end());
+}
+
+} // namespace ndn
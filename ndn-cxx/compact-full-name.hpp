@@ -0,0 +1,191 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_COMPACT_FULL_NAME_HPP
+#define NDN_CXX_COMPACT_FULL_NAME_HPP
+
+#include "ndn-cxx/name.hpp"
+
+namespace ndn {
+
+class Data;
+
+/** @brief Compact representation of the full name of a %Data packet.
+ *
+ *  A CompactFullName refers to the name of a Data packet and holds the 32-byte implicit
+ *  SHA-256 digest of the packet, which is shared with the packet itself. It can be compared,
+ *  tested for prefix relationship, and hashed, with the same results as the equivalent Name
+ *  returned by toName(), but without materializing that Name.
+ *
+ *  @warning The referenced Name must outlive the CompactFullName.
+ */
+class CompactFullName
+{
+public:
+  /** @brief Create from a Data name and its implicit digest.
+   *  @param name Data name, which is referenced rather than copied
+   *  @param digest implicit SHA-256 digest
+   *  @throw std::invalid_argument @p digest is not a SHA-256 digest
+   */
+  CompactFullName(const Name& name, ConstBufferPtr digest);
+
+  /** @brief Create from a Data packet, computing its implicit digest if necessary.
+   *  @throw Data::Error @p data has no wire encoding
+   */
+  explicit
+  CompactFullName(const Data& data);
+
+  /** @brief Return the Data name, i.e., the full name without the digest component.
+   */
+  const Name&
+  getName() const noexcept
+  {
+    return *m_name;
+  }
+
+  const ConstBufferPtr&
+  getDigest() const noexcept
+  {
+    return m_digest;
+  }
+
+  /** @brief Return the number of components of the full name.
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_name->size() + 1;
+  }
+
+  /** @brief Return the full name as a Name.
+   */
+  Name
+  toName() const;
+
+  /** @brief Check whether @p prefix is a prefix of the full name.
+   */
+  bool
+  hasPrefix(const Name& prefix) const;
+
+  /** @brief Compare with @p other in NDN canonical order.
+   *  @return same as `toName().compare(other)`
+   */
+  int
+  compare(const Name& other) const;
+
+  /** @brief Compare with @p other in NDN canonical order.
+   */
+  int
+  compare(const CompactFullName& other) const;
+
+  /** @brief Compute the same hash value as `std::hash<Name>()(toName())`.
+   */
+  size_t
+  hash() const;
+
+private: // non-member operators
+  // NOTE: the following "hidden friend" operators are available via
+  //       argument-dependent lookup only and must be defined inline.
+
+  friend bool
+  operator==(const CompactFullName& lhs, const CompactFullName& rhs)
+  {
+    return lhs.compare(rhs) == 0;
+  }
+
+  friend bool
+  operator==(const CompactFullName& lhs, const Name& rhs)
+  {
+    return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+  }
+
+  friend bool
+  operator==(const Name& lhs, const CompactFullName& rhs)
+  {
+    return rhs == lhs;
+  }
+
+  friend bool
+  operator!=(const CompactFullName& lhs, const CompactFullName& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  friend bool
+  operator!=(const CompactFullName& lhs, const Name& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  friend bool
+  operator!=(const Name& lhs, const CompactFullName& rhs)
+  {
+    return !(rhs == lhs);
+  }
+
+  friend bool
+  operator<(const CompactFullName& lhs, const CompactFullName& rhs)
+  {
+    return lhs.compare(rhs) < 0;
+  }
+
+  friend bool
+  operator<(const CompactFullName& lhs, const Name& rhs)
+  {
+    return lhs.compare(rhs) < 0;
+  }
+
+  friend bool
+  operator<(const Name& lhs, const CompactFullName& rhs)
+  {
+    return rhs.compare(lhs) > 0;
+  }
+
+  /** @brief Print the URI representation of the full name.
+   */
+  friend std::ostream&
+  operator<<(std::ostream& os, const CompactFullName& fullName)
+  {
+    return os << fullName.toName();
+  }
+
+private:
+  const Name* m_name;
+  ConstBufferPtr m_digest;
+};
+
+} // namespace ndn
+
+namespace std {
+
+template<>
+struct hash<ndn::CompactFullName>
+{
+  size_t
+  operator()(const ndn::CompactFullName& fullName) const
+  {
+    return fullName.hash();
+  }
+};
+
+} // namespace std
+
+#endif // NDN_CXX_COMPACT_FULL_NAME_HPP
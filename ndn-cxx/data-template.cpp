@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/data-template.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/util/sha256.hpp"
+
+namespace ndn {
+
+static ConstBufferPtr
+computeDigestSha256(const InputBuffers& bufs)
+{
+  util::Sha256 digest;
+  for (const auto& buf : bufs) {
+    digest.update(buf.first, buf.second);
+  }
+  return digest.computeDigest();
+}
+
+DataTemplate::DataTemplate(const Name& prefix)
+{
+  setPrefix(prefix);
+  setMetaInfo(MetaInfo());
+  setSigner(SignatureInfo(tlv::DigestSha256), &computeDigestSha256);
+}
+
+DataTemplate&
+DataTemplate::setPrefix(const Name& prefix)
+{
+  m_prefix = prefix;
+  m_prefix.wireEncode(); // ensure the prefix wire is cached for encode()
+  return *this;
+}
+
+DataTemplate&
+DataTemplate::setMetaInfo(const MetaInfo& metaInfo)
+{
+  m_metaInfo = metaInfo;
+  m_metaInfoWire = m_metaInfo.wireEncode();
+  return *this;
+}
+
+DataTemplate&
+DataTemplate::setContentType(uint32_t type)
+{
+  m_metaInfo.setType(type);
+  m_metaInfoWire = m_metaInfo.wireEncode();
+  return *this;
+}
+
+DataTemplate&
+DataTemplate::setFreshnessPeriod(time::milliseconds freshnessPeriod)
+{
+  m_metaInfo.setFreshnessPeriod(freshnessPeriod);
+  m_metaInfoWire = m_metaInfo.wireEncode();
+  return *this;
+}
+
+DataTemplate&
+DataTemplate::setSigner(const SignatureInfo& info, SignFunction sign)
+{
+  if (sign == nullptr) {
+    NDN_THROW(std::invalid_argument("SignFunction cannot be empty"));
+  }
+  m_signatureInfo = info;
+  m_signatureInfoWire = m_signatureInfo.wireEncode(SignatureInfo::Type::Data);
+  m_sign = std::move(sign);
+  return *this;
+}
+
+size_t
+DataTemplate::estimateSignatureValueSize() const
+{
+  size_t valueSize = 0;
+  switch (m_signatureInfo.getSignatureType()) {
+    case tlv::DigestSha256:
+    case tlv::SignatureHmacWithSha256:
+      valueSize = 32;
+      break;
+    case tlv::SignatureSha256WithEcdsa:
+      valueSize = 139; // DER-encoded ECDSA signature with the largest supported curve (P-521)
+      break;
+    default:
+      valueSize = 512; // RSA signature with a 4096-bit key
+      break;
+  }
+  return tlv::sizeOfVarNumber(tlv::SignatureValue) + tlv::sizeOfVarNumber(valueSize) + valueSize;
+}
+
+Block
+DataTemplate::encode(const PartialName& nameSuffix, const uint8_t* content, size_t contentSize) const
+{
+  if (content == nullptr && contentSize != 0) {
+    NDN_THROW(std::invalid_argument("Content buffer cannot be nullptr"));
+  }
+
+  // Data = DATA-TYPE TLV-LENGTH
+  //          Name
+  //          [MetaInfo]
+  //          [Content]
+  //          SignatureInfo
+  //          SignatureValue
+
+  const Block& prefixWire = m_prefix.wireEncode();
+  size_t nameValueLength = prefixWire.value_size();
+  for (const auto& component : nameSuffix) {
+    nameValueLength += component.size();
+  }
+
+  size_t unsignedLength = tlv::sizeOfVarNumber(tlv::Name) + tlv::sizeOfVarNumber(nameValueLength) +
+                          nameValueLength + m_metaInfoWire.size() +
+                          tlv::sizeOfVarNumber(tlv::Content) + tlv::sizeOfVarNumber(contentSize) +
+                          contentSize + m_signatureInfoWire.size();
+  size_t signatureValueReserve = estimateSignatureValueSize();
+  size_t headerReserve = tlv::sizeOfVarNumber(tlv::Data) +
+                         tlv::sizeOfVarNumber(unsignedLength + signatureValueReserve);
+
+  // the unsigned portion is prepended, SignatureValue is appended, then the outer TL is prepended
+  EncodingBuffer encoder(headerReserve + unsignedLength + signatureValueReserve,
+                         signatureValueReserve);
+
+  encoder.prependBlock(m_signatureInfoWire);
+  encoder.prependByteArrayBlock(tlv::Content, content, contentSize);
+  encoder.prependBlock(m_metaInfoWire);
+  for (auto i = nameSuffix.rbegin(); i != nameSuffix.rend(); ++i) {
+    encoder.prependBlock(*i);
+  }
+  encoder.prependByteArray(prefixWire.value(), prefixWire.value_size());
+  encoder.prependVarNumber(nameValueLength);
+  encoder.prependVarNumber(tlv::Name);
+  BOOST_ASSERT(encoder.size() == unsignedLength);
+
+  ConstBufferPtr sigValue = m_sign({{encoder.buf(), encoder.size()}});
+  if (sigValue == nullptr) {
+    NDN_THROW(Data::Error("SignFunction did not produce a SignatureValue"));
+  }
+
+  size_t totalLength = encoder.size();
+  totalLength += encoder.appendByteArrayBlock(tlv::SignatureValue, sigValue->data(), sigValue->size());
+  encoder.prependVarNumber(totalLength);
+  encoder.prependVarNumber(tlv::Data);
+
+  return encoder.block();
+}
+
+Block
+DataTemplate::encode(const PartialName& nameSuffix, const Block& content) const
+{
+  if (content.type() == tlv::Content) {
+    if (!content.hasValue() && content.elements_size() > 0) {
+      Block contentElement(content);
+      contentElement.encode();
+      return encode(nameSuffix, contentElement.value(), contentElement.value_size());
+    }
+    return encode(nameSuffix, content.value(), content.value_size());
+  }
+
+  if (!content.hasWire()) {
+    Block nested(content);
+    nested.encode();
+    return encode(nameSuffix, nested.wire(), nested.size());
+  }
+  return encode(nameSuffix, content.wire(), content.size());
+}
+
+} // namespace ndn
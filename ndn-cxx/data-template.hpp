@@ -0,0 +1,163 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_DATA_TEMPLATE_HPP
+#define NDN_CXX_DATA_TEMPLATE_HPP
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/security/security-common.hpp"
+
+namespace ndn {
+
+/** @brief Template for high-rate construction of %Data packets.
+ *
+ *  A DataTemplate holds the fields that are shared by many Data packets, namely the name
+ *  prefix, MetaInfo, and SignatureInfo, in pre-encoded form. Each packet produced from the
+ *  template only needs to encode its name suffix and Content, and to compute its SignatureValue.
+ *  The whole packet is encoded into a single, right-sized buffer.
+ *
+ *  By default, packets are signed with DigestSha256. Use setSigner() or
+ *  KeyChain::prepareTemplate() to sign with a different key.
+ *
+ *  @code
+ *  DataTemplate tpl("/producer/stream");
+ *  tpl.setFreshnessPeriod(1_s);
+ *  keyChain.prepareTemplate(tpl, signingByIdentity("/producer"));
+ *  for (uint64_t seq = 0; ...; ++seq) {
+ *    face.put(tpl.makeData(Name().appendSequenceNumber(seq), payload, payloadSize));
+ *  }
+ *  @endcode
+ */
+class DataTemplate
+{
+public:
+  /** @brief A function that computes the TLV-VALUE of SignatureValue over the signed portion.
+   */
+  using SignFunction = std::function<ConstBufferPtr(const InputBuffers& signedPortion)>;
+
+  /** @brief Create a template with the given name prefix, empty MetaInfo,
+   *         and DigestSha256 signature.
+   */
+  explicit
+  DataTemplate(const Name& prefix = Name());
+
+  const Name&
+  getPrefix() const noexcept
+  {
+    return m_prefix;
+  }
+
+  /** @brief Set the name prefix shared by all packets produced from this template.
+   */
+  DataTemplate&
+  setPrefix(const Name& prefix);
+
+  const MetaInfo&
+  getMetaInfo() const noexcept
+  {
+    return m_metaInfo;
+  }
+
+  /** @brief Set the MetaInfo shared by all packets produced from this template.
+   */
+  DataTemplate&
+  setMetaInfo(const MetaInfo& metaInfo);
+
+  /** @brief Set the ContentType of all packets produced from this template.
+   */
+  DataTemplate&
+  setContentType(uint32_t type);
+
+  /** @brief Set the FreshnessPeriod of all packets produced from this template.
+   */
+  DataTemplate&
+  setFreshnessPeriod(time::milliseconds freshnessPeriod);
+
+  const SignatureInfo&
+  getSignatureInfo() const noexcept
+  {
+    return m_signatureInfo;
+  }
+
+  /** @brief Set the SignatureInfo and the signing function used by this template.
+   *  @param info SignatureInfo placed into every packet
+   *  @param sign function that computes the SignatureValue; must not be empty
+   *
+   *  This is a low-level function that should not normally be called directly by applications.
+   *  Instead, use KeyChain::prepareTemplate().
+   */
+  DataTemplate&
+  setSigner(const SignatureInfo& info, SignFunction sign);
+
+  /** @brief Encode a signed Data packet.
+   *  @param nameSuffix name components appended to the template prefix
+   *  @param content pointer to the TLV-VALUE of Content; may be nullptr if @p contentSize is zero
+   *  @param contentSize size of the Content TLV-VALUE
+   *  @return wire encoding of the Data packet
+   */
+  Block
+  encode(const PartialName& nameSuffix, const uint8_t* content, size_t contentSize) const;
+
+  /** @brief Encode a signed Data packet.
+   *  @param nameSuffix name components appended to the template prefix
+   *  @param content a Content element, or a Block to be nested into the Content element
+   *  @return wire encoding of the Data packet
+   */
+  Block
+  encode(const PartialName& nameSuffix, const Block& content) const;
+
+  /** @brief Create a signed Data packet.
+   *  @sa encode(const PartialName&, const uint8_t*, size_t) const
+   */
+  shared_ptr<Data>
+  makeData(const PartialName& nameSuffix, const uint8_t* content, size_t contentSize) const
+  {
+    return make_shared<Data>(encode(nameSuffix, content, contentSize));
+  }
+
+  /** @brief Create a signed Data packet.
+   *  @sa encode(const PartialName&, const Block&) const
+   */
+  shared_ptr<Data>
+  makeData(const PartialName& nameSuffix, const Block& content) const
+  {
+    return make_shared<Data>(encode(nameSuffix, content));
+  }
+
+private:
+  /** @brief Return an upper bound on the size of the SignatureValue element.
+   */
+  size_t
+  estimateSignatureValueSize() const;
+
+private:
+  Name m_prefix;
+  MetaInfo m_metaInfo;
+  SignatureInfo m_signatureInfo;
+  SignFunction m_sign;
+
+  Block m_metaInfoWire;
+  Block m_signatureInfoWire;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_DATA_TEMPLATE_HPP
@@ -38,6 +38,18 @@ Data::Data(const Name& name)
 {
 }
 
+/** @brief Return the number of octets that EncodingBuffer::prependBlock() writes for @p block.
+ */
+static size_t
+encodedSize(const Block& block)
+{
+  if (block.hasWire()) {
+    return block.size();
+  }
+  return tlv::sizeOfVarNumber(block.type()) + tlv::sizeOfVarNumber(block.value_size()) +
+         block.value_size();
+}
+
 Data::Data(const Block& wire)
 {
   wireDecode(wire);
@@ -99,7 +111,7 @@ Data::wireEncode(EncodingBuffer& encoder, const Block& signatureValue) const
   encoder.prependVarNumber(totalLength);
   encoder.prependVarNumber(tlv::Data);
 
-  const_cast<Data*>(this)->wireDecode(encoder.block());
+  const_cast<Data*>(this)->setEncodedWire(encoder.block());
   return m_wire;
 }
 
@@ -109,16 +121,119 @@ Data::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
-
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
+  if (!m_signatureInfo) {
+    NDN_THROW(Error("Requested wire format, but Data has not been signed"));
+  }
 
-  const_cast<Data*>(this)->wireDecode(buffer.block());
+  // compute the size from the cached encodings of the sub-elements,
+  // so that the packet is encoded in a single pass into a right-sized buffer
+  const Block& nameWire = m_name.wireEncode();
+  const Block& metaInfoWire = m_metaInfo.wireEncode();
+  const Block& content = getContent();
+  const Block& signatureInfoWire = m_signatureInfo.wireEncode(SignatureInfo::Type::Data);
+
+  size_t valueLength = nameWire.size() + metaInfoWire.size() + content.size() +
+                       signatureInfoWire.size() + encodedSize(m_signatureValue);
+  size_t totalLength = tlv::sizeOfVarNumber(tlv::Data) + tlv::sizeOfVarNumber(valueLength) +
+                       valueLength;
+
+  EncodingBuffer buffer(totalLength, 0);
+  buffer.prependBlock(m_signatureValue);
+  buffer.prependBlock(signatureInfoWire);
+  buffer.prependBlock(content);
+  buffer.prependBlock(metaInfoWire);
+  buffer.prependBlock(nameWire);
+  buffer.prependVarNumber(valueLength);
+  buffer.prependVarNumber(tlv::Data);
+  BOOST_ASSERT(buffer.size() == totalLength);
+
+  const_cast<Data*>(this)->setEncodedWire(buffer.block());
   return m_wire;
 }
 
+WireSequence
+Data::wireEncodeScattered() const
+{
+  if (!m_externalContent) {
+    return {wireEncode()};
+  }
+  if (!m_signatureInfo) {
+    NDN_THROW(Error("Requested wire format, but Data has not been signed"));
+  }
+
+  const Block& nameWire = m_name.wireEncode();
+  const Block& metaInfoWire = m_metaInfo.wireEncode();
+  const Block& signatureInfoWire = m_signatureInfo.wireEncode(SignatureInfo::Type::Data);
+  size_t contentSize = m_externalContent->size();
+
+  size_t trailerLength = signatureInfoWire.size() + encodedSize(m_signatureValue);
+  size_t valueLength = nameWire.size() + metaInfoWire.size() + tlv::sizeOfVarNumber(tlv::Content) +
+                       tlv::sizeOfVarNumber(contentSize) + contentSize + trailerLength;
+  size_t headerLength = tlv::sizeOfVarNumber(tlv::Data) + tlv::sizeOfVarNumber(valueLength) +
+                        valueLength - contentSize - trailerLength;
+
+  // the header and the trailer share one buffer, while the content is referenced in place
+  EncodingBuffer buffer(headerLength + trailerLength, 0);
+  buffer.prependBlock(m_signatureValue);
+  buffer.prependBlock(signatureInfoWire);
+  buffer.prependVarNumber(contentSize);
+  buffer.prependVarNumber(tlv::Content);
+  buffer.prependBlock(metaInfoWire);
+  buffer.prependBlock(nameWire);
+  buffer.prependVarNumber(valueLength);
+  buffer.prependVarNumber(tlv::Data);
+  BOOST_ASSERT(buffer.size() == headerLength + trailerLength);
+
+  return {WireRegion(buffer.getBuffer(), buffer.buf(), headerLength),
+          *m_externalContent,
+          WireRegion(buffer.getBuffer(), buffer.buf() + headerLength, trailerLength)};
+}
+
+InputBuffers
+Data::extractSignedRanges(EncodingBuffer& encoder) const
+{
+  if (!m_externalContent) {
+    wireEncode(encoder, true);
+    return {{encoder.buf(), encoder.size()}};
+  }
+
+  size_t signatureInfoLength = m_signatureInfo.wireEncode(encoder, SignatureInfo::Type::Data);
+  encoder.prependVarNumber(m_externalContent->size());
+  encoder.prependVarNumber(tlv::Content);
+  m_metaInfo.wireEncode(encoder);
+  m_name.wireEncode(encoder);
+  size_t headerLength = encoder.size() - signatureInfoLength;
+
+  return {{encoder.buf(), headerLength},
+          {m_externalContent->data(), m_externalContent->size()},
+          {encoder.buf() + headerLength, signatureInfoLength}};
+}
+
+void
+Data::setEncodedWire(const Block& wire)
+{
+  m_wire = wire;
+  m_wire.parse();
+
+  // the fields already hold the encoded values, so only the Blocks that are exposed as-is
+  // are rebound to the new buffer; Name, MetaInfo, and SignatureInfo are not decoded again
+  for (const auto& element : m_wire.elements()) {
+    switch (element.type()) {
+      case tlv::Content:
+        m_content = element;
+        break;
+      case tlv::SignatureValue:
+        m_signatureValue = element;
+        break;
+      default:
+        break;
+    }
+  }
+
+  m_implicitDigest.reset();
+  m_fullName.clear();
+}
+
 void
 Data::wireDecode(const Block& wire)
 {
@@ -143,8 +258,10 @@ Data::wireDecode(const Block& wire)
 
   m_metaInfo = {};
   m_content = Block(tlv::Content);
+  m_externalContent = nullopt;
   m_signatureInfo = {};
   m_signatureValue = {};
+  m_implicitDigest.reset();
   m_fullName.clear();
 
   int lastElement = 1; // last recognized element index, in spec order
@@ -205,20 +322,32 @@ const Name&
 Data::getFullName() const
 {
   if (m_fullName.empty()) {
+    const auto& digest = getImplicitDigest();
+    m_fullName = m_name;
+    m_fullName.appendImplicitSha256Digest(digest);
+  }
+
+  return m_fullName;
+}
+
+const ConstBufferPtr&
+Data::getImplicitDigest() const
+{
+  if (m_implicitDigest == nullptr) {
     if (!m_wire.hasWire()) {
       NDN_THROW(Error("Cannot compute full name because Data has no wire encoding (not signed)"));
     }
-    m_fullName = m_name;
-    m_fullName.appendImplicitSha256Digest(util::Sha256::computeDigest(m_wire.wire(), m_wire.size()));
+    m_implicitDigest = util::Sha256::computeDigest(m_wire.wire(), m_wire.size());
   }
 
-  return m_fullName;
+  return m_implicitDigest;
 }
 
 void
 Data::resetWire()
 {
   m_wire.reset();
+  m_implicitDigest.reset();
   m_fullName.clear();
 }
 
@@ -243,6 +372,10 @@ Data::setMetaInfo(const MetaInfo& metaInfo)
 const Block&
 Data::getContent() const
 {
+  if (!m_content.isValid() && m_externalContent) {
+    const_cast<Block&>(m_content) = makeBinaryBlock(tlv::Content, m_externalContent->data(),
+                                                    m_externalContent->size());
+  }
   if (!m_content.hasWire()) {
     const_cast<Block&>(m_content).encode();
   }
@@ -258,6 +391,7 @@ Data::setContent(const Block& block)
   else {
     m_content = Block(tlv::Content, block);
   }
+  m_externalContent = nullopt;
   resetWire();
   return *this;
 }
@@ -266,6 +400,7 @@ Data&
 Data::setContent(const uint8_t* value, size_t valueSize)
 {
   m_content = makeBinaryBlock(tlv::Content, value, valueSize);
+  m_externalContent = nullopt;
   resetWire();
   return *this;
 }
@@ -277,6 +412,30 @@ Data::setContent(ConstBufferPtr value)
     NDN_THROW(std::invalid_argument("Content buffer cannot be nullptr"));
   }
   m_content = Block(tlv::Content, std::move(value));
+  m_externalContent = nullopt;
+  resetWire();
+  return *this;
+}
+
+Data&
+Data::setExternalContent(ConstBufferPtr value)
+{
+  if (value == nullptr) {
+    NDN_THROW(std::invalid_argument("Content buffer cannot be nullptr"));
+  }
+  const uint8_t* data = value->data();
+  size_t size = value->size();
+  return setExternalContent(std::move(value), data, size);
+}
+
+Data&
+Data::setExternalContent(shared_ptr<const void> owner, const uint8_t* value, size_t valueSize)
+{
+  if (value == nullptr && valueSize != 0) {
+    NDN_THROW(std::invalid_argument("Content buffer cannot be nullptr"));
+  }
+  m_content = {};
+  m_externalContent.emplace(std::move(owner), value, valueSize);
   resetWire();
   return *this;
 }
@@ -24,8 +24,10 @@
 
 #include "ndn-cxx/detail/packet-base.hpp"
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/wire-sequence.hpp"
 #include "ndn-cxx/meta-info.hpp"
 #include "ndn-cxx/name.hpp"
+#include "ndn-cxx/security/security-common.hpp"
 #include "ndn-cxx/signature.hpp"
 
 namespace ndn {
@@ -75,6 +77,8 @@ public:
    *  @param encoder EncodingBuffer containing Name, MetaInfo, Content, and SignatureInfo, but
    *                 without SignatureValue and the outermost Type-Length of the Data element.
    *  @param signatureValue SignatureValue element.
+   *  @pre The contents of @p encoder were produced by `wireEncode(encoder, true)` on this Data,
+   *       and the Data has not been modified since then.
    *
    *  This method is intended to be used in concert with `wireEncode(encoder, true)`, e.g.:
    *  @code
@@ -96,6 +100,27 @@ public:
   const Block&
   wireEncode() const;
 
+  /** @brief Encode into a sequence of memory regions, without copying external content.
+   *  @pre Data must be signed.
+   *
+   *  If the Data has external content, the sequence consists of the header (outermost
+   *  Type-Length, Name, MetaInfo, and Type-Length of Content), the content itself, and the
+   *  trailer (SignatureInfo and SignatureValue). Otherwise, the sequence contains wireEncode().
+   *
+   *  @sa setExternalContent()
+   */
+  WireSequence
+  wireEncodeScattered() const;
+
+  /** @brief Encode the signed portion of this Data into @p encoder.
+   *  @return the memory regions that make up the signed portion, i.e., Name, MetaInfo, Content,
+   *          and SignatureInfo; they refer to @p encoder and, if set, to the external content
+   *  @pre @p encoder is empty.
+   *  @note @p encoder must not be modified while the returned regions are in use.
+   */
+  InputBuffers
+  extractSignedRanges(EncodingBuffer& encoder) const;
+
   /** @brief Decode from @p wire.
    */
   void
@@ -112,10 +137,22 @@ public:
   /** @brief Get full name including implicit digest
    *  @pre hasWire() == true; i.e. wireEncode() must have been called
    *  @throw Error Data has no wire encoding
+   *  @note This materializes a copy of the Name. Prefer CompactFullName where possible.
    */
   const Name&
   getFullName() const;
 
+  /** @brief Get the implicit SHA-256 digest of the packet
+   *
+   *  The digest is computed on first use, and is shared with copies of this Data
+   *  and with CompactFullName instances.
+   *
+   *  @pre hasWire() == true; i.e. wireEncode() must have been called
+   *  @throw Error Data has no wire encoding
+   */
+  const ConstBufferPtr&
+  getImplicitDigest() const;
+
 public: // Data fields
   /** @brief Get name
    */
@@ -178,6 +215,36 @@ public: // Data fields
   Data&
   setContent(ConstBufferPtr value);
 
+  /** @brief Set Content from an application-owned buffer, without copying it
+   *  @param value buffer containing the TLV-VALUE of the content; must not be nullptr
+   *  @return a reference to this Data, to allow chaining
+   *  @sa setExternalContent(shared_ptr<const void>, const uint8_t*, size_t)
+   */
+  Data&
+  setExternalContent(ConstBufferPtr value);
+
+  /** @brief Set Content from an application-owned memory region, without copying it
+   *  @param owner object that keeps the memory region alive, e.g., a memory-mapped file
+   *  @param value pointer to the first octet of the TLV-VALUE; may be nullptr if @p valueSize is zero
+   *  @param valueSize size of the TLV-VALUE
+   *  @return a reference to this Data, to allow chaining
+   *
+   *  The memory region must not be modified while this Data refers to it. It is signed by
+   *  KeyChain::sign() and emitted by wireEncodeScattered() in place. It is copied only if a
+   *  contiguous encoding is requested, e.g., by getContent() or wireEncode().
+   */
+  Data&
+  setExternalContent(shared_ptr<const void> owner, const uint8_t* value, size_t valueSize);
+
+  /** @brief Check whether Content refers to an application-owned memory region
+   *  @sa setExternalContent()
+   */
+  bool
+  hasExternalContent() const noexcept
+  {
+    return m_externalContent != nullopt;
+  }
+
   /** @brief Get Signature
    *  @deprecated Use getSignatureInfo and getSignatureValue
    */
@@ -280,21 +347,30 @@ public: // SignatureInfo fields
   }
 
 protected:
-  /** @brief Clear wire encoding and cached FullName
+  /** @brief Clear wire encoding, cached implicit digest, and cached FullName
    *  @note This does not clear the SignatureValue.
    */
   void
   resetWire();
 
+private:
+  /** @brief Adopt a freshly encoded @p wire without decoding it again.
+   *  @pre @p wire is the encoding of the current fields.
+   */
+  void
+  setEncodedWire(const Block& wire);
+
 private:
   Name m_name;
   MetaInfo m_metaInfo;
-  Block m_content;
+  Block m_content; ///< invalid if external content has not been copied yet
+  optional<WireRegion> m_externalContent;
   SignatureInfo m_signatureInfo;
   Block m_signatureValue;
 
   mutable Block m_wire;
-  mutable Name m_fullName; ///< cached FullName computed from m_wire
+  mutable ConstBufferPtr m_implicitDigest; ///< cached implicit digest computed from m_wire
+  mutable Name m_fullName; ///< cached FullName, materialized only by getFullName()
 };
 
 #ifndef DOXYGEN
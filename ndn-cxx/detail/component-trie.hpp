@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_DETAIL_COMPONENT_TRIE_HPP
+#define NDN_DETAIL_COMPONENT_TRIE_HPP
+
+#include "ndn-cxx/name.hpp"
+
+#include <map>
+
+namespace ndn {
+namespace detail {
+
+/** \brief A trie of name components that maps name prefixes to values.
+ *
+ *  Lookups walk the components of the given name in place, without constructing any
+ *  temporary Name or PartialName.
+ *
+ *  \tparam T value type
+ */
+template<typename T>
+class ComponentTrie : noncopyable
+{
+public:
+  bool
+  empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+  /** \brief Insert a value at \p prefix, replacing any existing value.
+   *  \return a reference to the stored value
+   */
+  T&
+  insert(const Name& prefix, T value)
+  {
+    Node* node = &m_root;
+    for (const auto& comp : prefix) {
+      auto& child = node->children[comp];
+      if (child == nullptr) {
+        child = make_unique<Node>();
+      }
+      node = child.get();
+    }
+
+    if (!node->value) {
+      ++m_size;
+    }
+    node->value = std::move(value);
+    return *node->value;
+  }
+
+  /** \brief Find the value of the longest entry that is a prefix of the components of
+   *         \p name starting at position \p offset.
+   *  \return a pointer to the value, or nullptr if no entry matches
+   */
+  const T*
+  findLongestPrefix(const Name& name, size_t offset = 0) const
+  {
+    const Node* node = &m_root;
+    const T* match = node->value ? &*node->value : nullptr;
+    for (size_t i = offset; i < name.size(); ++i) {
+      auto it = node->children.find(name[i]);
+      if (it == node->children.end()) {
+        break;
+      }
+      node = it->second.get();
+      if (node->value) {
+        match = &*node->value;
+      }
+    }
+    return match;
+  }
+
+  /** \brief Determine whether an existing entry is a prefix of \p prefix,
+   *         or has \p prefix as its prefix.
+   */
+  bool
+  hasOverlap(const Name& prefix) const
+  {
+    const Node* node = &m_root;
+    for (const auto& comp : prefix) {
+      if (node->value) {
+        return true;
+      }
+      auto it = node->children.find(comp);
+      if (it == node->children.end()) {
+        return false;
+      }
+      node = it->second.get();
+    }
+    // nodes are only created on the path to an entry, so any child leads to an entry
+    return node->value || !node->children.empty();
+  }
+
+private:
+  struct Node
+  {
+    optional<T> value;
+    std::map<name::Component, unique_ptr<Node>> children;
+  };
+
+  Node m_root;
+  size_t m_size = 0;
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_DETAIL_COMPONENT_TRIE_HPP
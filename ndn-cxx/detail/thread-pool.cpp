@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/thread-pool.hpp"
+
+namespace ndn {
+namespace detail {
+
+ThreadPool::ThreadPool(size_t nThreads, size_t maxPending)
+  : m_maxPending(maxPending)
+{
+  if (nThreads == 0) {
+    NDN_THROW(std::invalid_argument("Number of threads must be positive"));
+  }
+  if (maxPending == 0) {
+    NDN_THROW(std::invalid_argument("Maximum number of pending jobs must be positive"));
+  }
+
+  m_threads.reserve(nThreads);
+  for (size_t i = 0; i < nThreads; ++i) {
+    m_threads.emplace_back([this] { run(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isStopped = true;
+  }
+  m_cv.notify_all();
+
+  for (auto& thread : m_threads) {
+    thread.join();
+  }
+}
+
+bool
+ThreadPool::tryPost(std::function<void()> job)
+{
+  if (!tryReserve()) {
+    return false;
+  }
+  post(std::move(job));
+  return true;
+}
+
+bool
+ThreadPool::tryReserve()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_isStopped || m_nPending >= m_maxPending) {
+    return false;
+  }
+  ++m_nPending;
+  return true;
+}
+
+void
+ThreadPool::post(std::function<void()> job)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    BOOST_ASSERT(m_nPending > m_queue.size());
+    m_queue.push_back(std::move(job));
+  }
+  m_cv.notify_one();
+}
+
+void
+ThreadPool::cancelReservation()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  BOOST_ASSERT(m_nPending > 0);
+  --m_nPending;
+}
+
+size_t
+ThreadPool::getNPending() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_nPending;
+}
+
+void
+ThreadPool::run()
+{
+  while (true) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv.wait(lock, [this] { return m_isStopped || !m_queue.empty(); });
+      if (m_queue.empty()) {
+        return; // stopped and drained
+      }
+      job = std::move(m_queue.front());
+      m_queue.pop_front();
+    }
+
+    job();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_nPending;
+  }
+}
+
+} // namespace detail
+} // namespace ndn
@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_DETAIL_THREAD_POOL_HPP
+#define NDN_DETAIL_THREAD_POOL_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace ndn {
+namespace detail {
+
+/**
+ * @brief A fixed-size pool of threads that executes jobs, such as signing or authorization.
+ *
+ * The number of jobs that are queued or running is bounded; tryPost() refuses new jobs
+ * when the bound is reached, allowing the caller to apply backpressure.
+ */
+class ThreadPool : noncopyable
+{
+public:
+  /**
+   * @param nThreads number of worker threads, must be positive
+   * @param maxPending maximum number of jobs that are queued or running, must be positive
+   * @throw std::invalid_argument @p nThreads or @p maxPending is zero
+   */
+  ThreadPool(size_t nThreads, size_t maxPending);
+
+  /**
+   * @brief Stop accepting jobs, execute the queued jobs, and join all worker threads.
+   */
+  ~ThreadPool();
+
+  /**
+   * @brief Enqueue @p job for execution on a worker thread.
+   * @return whether the job has been accepted; false if the pool is full
+   */
+  bool
+  tryPost(std::function<void()> job);
+
+  /**
+   * @brief Reserve a slot for a job that will be posted later.
+   *
+   * A successful reservation counts towards the bound immediately. It must be followed by
+   * exactly one call to either post() or cancelReservation().
+   *
+   * @return whether a slot has been reserved; false if the pool is full
+   */
+  bool
+  tryReserve();
+
+  /**
+   * @brief Enqueue @p job into a slot previously reserved with tryReserve().
+   */
+  void
+  post(std::function<void()> job);
+
+  /**
+   * @brief Release a slot previously reserved with tryReserve() without posting a job.
+   */
+  void
+  cancelReservation();
+
+  size_t
+  getNThreads() const
+  {
+    return m_threads.size();
+  }
+
+  size_t
+  getMaxPending() const
+  {
+    return m_maxPending;
+  }
+
+  /**
+   * @return number of jobs that are queued or running
+   */
+  size_t
+  getNPending() const;
+
+private:
+  void
+  run();
+
+private:
+  const size_t m_maxPending;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<std::function<void()>> m_queue;
+  size_t m_nPending = 0;
+  bool m_isStopped = false;
+  std::vector<std::thread> m_threads;
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_DETAIL_THREAD_POOL_HPP
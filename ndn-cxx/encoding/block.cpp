@@ -106,6 +106,34 @@ Block::Block(ConstBufferPtr buffer, uint32_t type,
 {
 }
 
+Block::Block(ConstBufferPtr buffer, Buffer::const_iterator begin,
+             const tlv::ElementBounds& element, const std::vector<tlv::ElementBounds>& children)
+  : m_buffer(std::move(buffer))
+  , m_type(element.type)
+  , m_size(element.end - element.begin)
+{
+  if (m_buffer == nullptr || begin < m_buffer->begin() ||
+      m_size > static_cast<size_t>(m_buffer->end() - begin)) {
+    NDN_THROW(std::invalid_argument("TLV element is not within buffer"));
+  }
+  if (element.nChildren > children.size() || element.firstChild > children.size() - element.nChildren) {
+    NDN_THROW(std::invalid_argument("Sub-elements are not within table"));
+  }
+
+  m_begin = begin;
+  m_end = begin + m_size;
+  m_valueBegin = begin + (element.valueBegin - element.begin);
+  m_valueEnd = m_end;
+
+  m_elements.reserve(element.nChildren);
+  for (size_t i = element.firstChild; i < element.firstChild + element.nChildren; ++i) {
+    const auto& child = children[i];
+    auto childEnd = begin + (child.end - element.begin);
+    m_elements.emplace_back(m_buffer, child.type, begin + (child.begin - element.begin), childEnd,
+                            begin + (child.valueBegin - element.begin), childEnd);
+  }
+}
+
 Block::Block(const uint8_t* buf, size_t bufSize)
 {
   const uint8_t* pos = buf;
@@ -330,22 +358,20 @@ Block::parse() const
   Buffer::const_iterator begin = value_begin();
   Buffer::const_iterator end = value_end();
 
-  while (begin != end) {
-    Buffer::const_iterator pos = begin;
+  size_t nScanned = tlv::scanElements(value(), value_size(), [&] (const tlv::ElementBounds& e) {
+    m_elements.emplace_back(m_buffer, e.type, begin + e.begin, begin + e.end,
+                            begin + e.valueBegin, begin + e.end);
+  });
 
-    uint32_t type = tlv::readType(pos, end);
-    uint64_t length = tlv::readVarNumber(pos, end);
-    if (length > static_cast<uint64_t>(end - pos)) {
-      m_elements.clear();
-      NDN_THROW(Error("TLV-LENGTH of sub-element of type " + to_string(type) +
-                      " exceeds TLV-VALUE boundary of parent block"));
-    }
-    // pos now points to TLV-VALUE of sub element
-
-    Buffer::const_iterator subEnd = pos + length;
-    m_elements.emplace_back(m_buffer, type, begin, subEnd, pos, subEnd);
+  if (nScanned != value_size()) {
+    m_elements.clear();
 
-    begin = subEnd;
+    // decode the offending sub-element again to report the precise error
+    Buffer::const_iterator pos = begin + nScanned;
+    uint32_t type = tlv::readType(pos, end);
+    tlv::readVarNumber(pos, end);
+    NDN_THROW(Error("TLV-LENGTH of sub-element of type " + to_string(type) +
+                    " exceeds TLV-VALUE boundary of parent block"));
   }
 }
 
@@ -126,6 +126,19 @@ public: // construction, assignment
         Buffer::const_iterator begin, Buffer::const_iterator end,
         Buffer::const_iterator valueBegin, Buffer::const_iterator valueEnd);
 
+  /** @brief Create a Block from a wire Buffer and bounds located by tlv::scanElements()
+   *  @param buffer a Buffer containing the TLV element described by @p element
+   *  @param begin begin position of the TLV element within @p buffer
+   *  @param element bounds of the TLV element
+   *  @param children table of sub-element bounds, in which @p element refers to its sub-elements
+   *  @throw std::invalid_argument the TLV element does not fit within @p buffer,
+   *                               or its sub-elements are not within @p children
+   *  @note Offsets in @p element and @p children are translated so that `element.begin`
+   *        corresponds to @p begin. Sub-elements, if any, are available without calling parse().
+   */
+  Block(ConstBufferPtr buffer, Buffer::const_iterator begin,
+        const tlv::ElementBounds& element, const std::vector<tlv::ElementBounds>& children);
+
   /** @brief Parse Block from a raw buffer
    *  @param buf pointer to the first octet of a TLV element
    *  @param bufSize size of the raw buffer; may be greater than the actual size of the TLV element
@@ -0,0 +1,560 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_ENCODING_TLV_SCHEMA_HPP
+#define NDN_ENCODING_TLV_SCHEMA_HPP
+
+#include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <bitset>
+
+/** @brief Expands to the pair of template arguments that identify a data member in a schema field.
+ *
+ *  Example: `Required<tlv::nfd::FaceId, NDN_CXX_TLV_SCHEMA_MEMBER(NextHopRecord::m_faceId)>`
+ */
+#define NDN_CXX_TLV_SCHEMA_MEMBER(m) decltype(&m), &m
+
+namespace ndn {
+namespace tlv {
+namespace schema {
+
+/** @brief A sub-element located during decoding, referring into the buffer of its parent.
+ */
+class ElementRef
+{
+public:
+  ElementRef(const Block& parent, const ElementBounds& bounds) noexcept
+    : m_parent(parent)
+    , m_bounds(bounds)
+  {
+  }
+
+  uint32_t
+  type() const noexcept
+  {
+    return m_bounds.type;
+  }
+
+  const uint8_t*
+  value() const noexcept
+  {
+    return m_parent.value() + m_bounds.valueBegin;
+  }
+
+  size_t
+  value_size() const noexcept
+  {
+    return m_bounds.end - m_bounds.valueBegin;
+  }
+
+  /** @brief Return the sub-element as a Block that shares the buffer of its parent.
+   */
+  Block
+  block() const
+  {
+    auto begin = m_parent.value_begin();
+    return Block(m_parent.getBuffer(), m_bounds.type, begin + m_bounds.begin, begin + m_bounds.end,
+                 begin + m_bounds.valueBegin, begin + m_bounds.end);
+  }
+
+  /** @brief Read TLV-VALUE as a non-negative integer.
+   *  @throw tlv::Error TLV-VALUE is not a valid non-negative integer
+   */
+  uint64_t
+  readNonNegativeInteger() const
+  {
+    const uint8_t* pos = value();
+    return tlv::readNonNegativeInteger(value_size(), pos, pos + value_size());
+  }
+
+private:
+  const Block& m_parent;
+  const ElementBounds& m_bounds;
+};
+
+/** @brief Forward-only cursor over the sub-elements of a Block.
+ *
+ *  Sub-elements are located directly in the wire encoding of the parent, without calling
+ *  Block::parse() and thus without allocating a Block for each of them.
+ */
+class Cursor
+{
+public:
+  /** @throw tlv::Error the first sub-element is malformed
+   */
+  explicit
+  Cursor(const Block& parent)
+    : m_parent(parent)
+    , m_value(parent.hasValue() ? parent.value() : nullptr)
+    , m_size(parent.hasValue() ? parent.value_size() : 0)
+  {
+    read(0);
+  }
+
+  bool
+  hasElement() const noexcept
+  {
+    return m_hasElement;
+  }
+
+  /** @pre hasElement()
+   */
+  uint32_t
+  type() const noexcept
+  {
+    return m_bounds.type;
+  }
+
+  /** @pre hasElement()
+   */
+  ElementRef
+  element() const noexcept
+  {
+    return {m_parent, m_bounds};
+  }
+
+  /** @brief Advance to the next sub-element.
+   *  @pre hasElement()
+   *  @throw tlv::Error the next sub-element is malformed
+   */
+  void
+  next()
+  {
+    read(m_bounds.end);
+  }
+
+private:
+  void
+  read(size_t pos)
+  {
+    m_hasElement = pos < m_size;
+    if (!m_hasElement)
+      return;
+
+    const uint8_t* begin = m_value + pos;
+    const uint8_t* const end = m_value + m_size;
+    m_bounds.begin = pos;
+    m_bounds.type = readType(begin, end);
+    uint64_t length = readVarNumber(begin, end);
+    if (length > static_cast<uint64_t>(end - begin)) {
+      NDN_THROW(Error("TLV-LENGTH of sub-element of type " + to_string(m_bounds.type) +
+                      " exceeds TLV-VALUE boundary of parent block"));
+    }
+    m_bounds.valueBegin = static_cast<size_t>(begin - m_value);
+    m_bounds.end = m_bounds.valueBegin + static_cast<size_t>(length);
+  }
+
+private:
+  const Block& m_parent;
+  const uint8_t* m_value;
+  size_t m_size;
+  ElementBounds m_bounds;
+  bool m_hasElement;
+};
+
+/** @brief Converts between a C++ value and a TLV element.
+ *
+ *  The primary template handles types that encode themselves as a complete TLV element, such as
+ *  Name or another schema-backed record: they must provide `wireEncode(EncodingImpl<TAG>&)` and
+ *  a constructor from `const Block&`.
+ */
+template<typename T, typename = void>
+struct Codec
+{
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t, const T& value)
+  {
+    return value.wireEncode(encoder);
+  }
+
+  static T
+  decode(const ElementRef& element)
+  {
+    return T(element.block());
+  }
+};
+
+/** @brief Codec for integers, encoded as NonNegativeInteger.
+ */
+template<typename T>
+struct Codec<T, std::enable_if_t<std::is_integral<T>::value>>
+{
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, T value)
+  {
+    return prependNonNegativeIntegerBlock(encoder, type, value);
+  }
+
+  static T
+  decode(const ElementRef& element)
+  {
+    uint64_t value = element.readNonNegativeInteger();
+    if (value > std::numeric_limits<T>::max()) {
+      NDN_THROW(Error("Value in TLV element of type " + to_string(element.type()) +
+                      " is too large"));
+    }
+    return static_cast<T>(value);
+  }
+};
+
+/** @brief Codec for enumerations, encoded as NonNegativeInteger.
+ *  @warning If T is an unscoped enum type, it must have a fixed underlying type.
+ */
+template<typename T>
+struct Codec<T, std::enable_if_t<std::is_enum<T>::value>>
+{
+  using Underlying = Codec<std::underlying_type_t<T>>;
+
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, T value)
+  {
+    return Underlying::prepend(encoder, type, static_cast<std::underlying_type_t<T>>(value));
+  }
+
+  static T
+  decode(const ElementRef& element)
+  {
+    return static_cast<T>(Underlying::decode(element));
+  }
+};
+
+/** @brief Codec for durations, encoded as NonNegativeInteger in units of the duration type.
+ */
+template<typename Rep, typename Period>
+struct Codec<time::duration<Rep, Period>>
+{
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, time::duration<Rep, Period> value)
+  {
+    return prependNonNegativeIntegerBlock(encoder, type, value.count());
+  }
+
+  static time::duration<Rep, Period>
+  decode(const ElementRef& element)
+  {
+    return time::duration<Rep, Period>(element.readNonNegativeInteger());
+  }
+};
+
+/** @brief Codec for timestamps, encoded as NonNegativeInteger milliseconds since Unix epoch.
+ */
+template<>
+struct Codec<time::system_clock::TimePoint>
+{
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, const time::system_clock::TimePoint& value)
+  {
+    return prependNonNegativeIntegerBlock(encoder, type, time::toUnixTimestamp(value).count());
+  }
+
+  static time::system_clock::TimePoint
+  decode(const ElementRef& element)
+  {
+    return time::fromUnixTimestamp(time::milliseconds(element.readNonNegativeInteger()));
+  }
+};
+
+/** @brief Codec for strings, encoded as the octets of the string.
+ */
+template<>
+struct Codec<std::string>
+{
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, const std::string& value)
+  {
+    return prependStringBlock(encoder, type, value);
+  }
+
+  static std::string
+  decode(const ElementRef& element)
+  {
+    return std::string(reinterpret_cast<const char*>(element.value()), element.value_size());
+  }
+};
+
+/** @brief Codec for bit sets, encoded as NonNegativeInteger.
+ */
+template<size_t N>
+struct Codec<std::bitset<N>>
+{
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, const std::bitset<N>& value)
+  {
+    return prependNonNegativeIntegerBlock(encoder, type, value.to_ullong());
+  }
+
+  static std::bitset<N>
+  decode(const ElementRef& element)
+  {
+    return std::bitset<N>(static_cast<unsigned long long>(element.readNonNegativeInteger()));
+  }
+};
+
+/** @brief Codec that wraps a self-encoding value in an outer TLV element.
+ *
+ *  For example, `Strategy ::= STRATEGY-TYPE TLV-LENGTH Name`.
+ */
+template<typename T>
+struct NestedCodec
+{
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, const T& value)
+  {
+    return prependNestedBlock(encoder, type, value);
+  }
+
+  static T
+  decode(const ElementRef& element)
+  {
+    Block outer = element.block();
+    Cursor cursor(outer);
+    if (!cursor.hasElement()) {
+      NDN_THROW(Error("TLV element of type " + to_string(element.type()) + " is empty"));
+    }
+    return Codec<T>::decode(cursor.element());
+  }
+};
+
+/** @brief A field that must appear exactly once.
+ *  @tparam TYPE TLV-TYPE of the field
+ *  @tparam MemberPtr, MEMBER the data member, see NDN_CXX_TLV_SCHEMA_MEMBER
+ *  @tparam C codec; `void` selects Codec<T>
+ */
+template<uint32_t TYPE, typename MemberPtr, MemberPtr MEMBER, typename C = void>
+struct Required;
+
+template<uint32_t TYPE, typename Class, typename T, T Class::*MEMBER, typename C>
+struct Required<TYPE, T Class::*, MEMBER, C>
+{
+  using FieldCodec = std::conditional_t<std::is_void<C>::value, Codec<T>, C>;
+
+  template<encoding::Tag TAG, typename Object>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, const Object& obj)
+  {
+    return FieldCodec::prepend(encoder, TYPE, obj.*MEMBER);
+  }
+
+  template<typename Object>
+  static void
+  decode(Object& obj, Cursor& cursor)
+  {
+    if (!cursor.hasElement() || cursor.type() != TYPE) {
+      NDN_THROW(typename Object::Error("missing required field of type " + to_string(TYPE)));
+    }
+    obj.*MEMBER = FieldCodec::decode(cursor.element());
+    cursor.next();
+  }
+};
+
+/** @brief A field that may be omitted, stored in an `optional<T>` data member.
+ */
+template<uint32_t TYPE, typename MemberPtr, MemberPtr MEMBER, typename C = void>
+struct Optional;
+
+template<uint32_t TYPE, typename Class, typename T, optional<T> Class::*MEMBER, typename C>
+struct Optional<TYPE, optional<T> Class::*, MEMBER, C>
+{
+  using FieldCodec = std::conditional_t<std::is_void<C>::value, Codec<T>, C>;
+
+  template<encoding::Tag TAG, typename Object>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, const Object& obj)
+  {
+    const auto& value = obj.*MEMBER;
+    return value ? FieldCodec::prepend(encoder, TYPE, *value) : 0;
+  }
+
+  template<typename Object>
+  static void
+  decode(Object& obj, Cursor& cursor)
+  {
+    if (cursor.hasElement() && cursor.type() == TYPE) {
+      obj.*MEMBER = FieldCodec::decode(cursor.element());
+      cursor.next();
+    }
+    else {
+      obj.*MEMBER = nullopt;
+    }
+  }
+};
+
+/** @brief A field that may appear zero or more times, stored in a `std::vector<T>` data member.
+ *
+ *  The occurrences must be consecutive: the decoder throws if another element of this TLV-TYPE
+ *  appears after an element of a different TLV-TYPE, rather than dropping the rest of them.
+ */
+template<uint32_t TYPE, typename MemberPtr, MemberPtr MEMBER, typename C = void>
+struct Repeated;
+
+template<uint32_t TYPE, typename Class, typename T, std::vector<T> Class::*MEMBER, typename C>
+struct Repeated<TYPE, std::vector<T> Class::*, MEMBER, C>
+{
+  using FieldCodec = std::conditional_t<std::is_void<C>::value, Codec<T>, C>;
+
+  template<encoding::Tag TAG, typename Object>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, const Object& obj)
+  {
+    const auto& values = obj.*MEMBER;
+    size_t totalLength = 0;
+    for (auto i = values.rbegin(); i != values.rend(); ++i) {
+      totalLength += FieldCodec::prepend(encoder, TYPE, *i);
+    }
+    return totalLength;
+  }
+
+  template<typename Object>
+  static void
+  decode(Object& obj, Cursor& cursor)
+  {
+    auto& values = obj.*MEMBER;
+    values.clear();
+    for (; cursor.hasElement() && cursor.type() == TYPE; cursor.next()) {
+      values.push_back(FieldCodec::decode(cursor.element()));
+    }
+
+    if (!cursor.hasElement()) {
+      return;
+    }
+    uint32_t unexpectedType = cursor.type();
+    for (Cursor rest(cursor); rest.hasElement(); rest.next()) {
+      if (rest.type() == TYPE) {
+        NDN_THROW(typename Object::Error("unexpected element of type " +
+                                         to_string(unexpectedType) +
+                                         " between fields of type " + to_string(TYPE)));
+      }
+    }
+  }
+};
+
+namespace detail {
+
+template<typename... Fields>
+struct FieldList;
+
+template<>
+struct FieldList<>
+{
+  template<encoding::Tag TAG, typename Object>
+  static size_t
+  prepend(EncodingImpl<TAG>&, const Object&)
+  {
+    return 0;
+  }
+
+  template<typename Object>
+  static void
+  decode(Object&, Cursor&)
+  {
+  }
+};
+
+template<typename Field, typename... Rest>
+struct FieldList<Field, Rest...>
+{
+  template<encoding::Tag TAG, typename Object>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, const Object& obj)
+  {
+    // fields are prepended in reverse order
+    size_t totalLength = FieldList<Rest...>::prepend(encoder, obj);
+    return totalLength + Field::prepend(encoder, obj);
+  }
+
+  template<typename Object>
+  static void
+  decode(Object& obj, Cursor& cursor)
+  {
+    Field::decode(obj, cursor);
+    FieldList<Rest...>::decode(obj, cursor);
+  }
+};
+
+} // namespace detail
+
+/** @brief Declarative description of a TLV record whose sub-elements appear in a fixed order.
+ *  @tparam TYPE TLV-TYPE of the record
+ *  @tparam Fields Required, Optional, or Repeated fields, in wire order
+ *
+ *  The encoder, the estimator, and a single-pass decoder are generated from the field list.
+ *  Sub-elements following the last field are ignored, but must be well-formed; however, an
+ *  element of a Repeated field must not appear after them.
+ *
+ *  A class using a schema typically declares a private nested `struct Schema;` and defines it
+ *  in its translation unit, so that the schema can refer to private data members:
+ *  @code
+ *  struct NextHopRecord::Schema : tlv::schema::Record<tlv::nfd::NextHopRecord,
+ *    Required<tlv::nfd::FaceId, NDN_CXX_TLV_SCHEMA_MEMBER(NextHopRecord::m_faceId)>,
+ *    Required<tlv::nfd::Cost, NDN_CXX_TLV_SCHEMA_MEMBER(NextHopRecord::m_cost)>>
+ *  {
+ *  };
+ *  @endcode
+ *  The error type thrown by the decoder is `Object::Error`.
+ */
+template<uint32_t TYPE, typename... Fields>
+struct Record
+{
+  template<encoding::Tag TAG, typename Object>
+  static size_t
+  encode(EncodingImpl<TAG>& encoder, const Object& obj)
+  {
+    size_t totalLength = detail::FieldList<Fields...>::prepend(encoder, obj);
+    totalLength += encoder.prependVarNumber(totalLength);
+    totalLength += encoder.prependVarNumber(TYPE);
+    return totalLength;
+  }
+
+  /** @throw Object::Error @p block has the wrong TLV-TYPE, a required field is missing,
+   *                        or the elements of a Repeated field are not consecutive
+   *  @throw tlv::Error a sub-element is malformed
+   */
+  template<typename Object>
+  static void
+  decode(Object& obj, const Block& block)
+  {
+    if (block.type() != TYPE) {
+      NDN_THROW(typename Object::Error("Expecting TLV-TYPE " + to_string(TYPE) +
+                                       " (found type " + to_string(block.type()) + ")"));
+    }
+
+    Cursor cursor(block);
+    detail::FieldList<Fields...>::decode(obj, cursor);
+    while (cursor.hasElement()) {
+      cursor.next();
+    }
+  }
+};
+
+} // namespace schema
+} // namespace tlv
+} // namespace ndn
+
+#endif // NDN_ENCODING_TLV_SCHEMA_HPP
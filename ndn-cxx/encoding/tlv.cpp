@@ -29,6 +29,40 @@ Error::Error(const char* expectedType, uint32_t actualType)
 {
 }
 
+size_t
+scanElements(const uint8_t* buf, size_t size, std::vector<ElementBounds>& elements)
+{
+  return scanElements(buf, size, [&elements] (const ElementBounds& bounds) {
+    elements.push_back(bounds);
+  });
+}
+
+size_t
+scanElements(const uint8_t* buf, size_t size, std::vector<ElementBounds>& elements,
+             std::vector<ElementBounds>& children)
+{
+  return scanElements(buf, size, [&] (const ElementBounds& bounds) {
+    ElementBounds element = bounds;
+    element.firstChild = children.size();
+
+    // the TLV-VALUE was just located, so scanning it now reads octets that are still in cache
+    size_t valueSize = element.end - element.valueBegin;
+    size_t nScanned = scanElements(buf + element.valueBegin, valueSize,
+                                   [&children, &element] (ElementBounds child) {
+      child.begin += element.valueBegin;
+      child.valueBegin += element.valueBegin;
+      child.end += element.valueBegin;
+      children.push_back(child);
+    });
+    if (nScanned != valueSize) {
+      children.resize(element.firstChild);
+    }
+
+    element.nChildren = children.size() - element.firstChild;
+    elements.push_back(element);
+  });
+}
+
 std::ostream&
 operator<<(std::ostream& os, SignatureTypeValue st)
 {
@@ -282,6 +282,62 @@ sizeOfNonNegativeInteger(uint64_t integer) noexcept;
 size_t
 writeNonNegativeInteger(std::ostream& os, uint64_t integer);
 
+/**
+ * @brief Location of a TLV element, as offsets from the beginning of the scanned buffer.
+ */
+struct ElementBounds
+{
+  uint32_t type;
+  size_t begin;      ///< offset of the first octet of TLV-TYPE
+  size_t valueBegin; ///< offset of the first octet of TLV-VALUE
+  size_t end;        ///< offset past the last octet of TLV-VALUE
+  size_t firstChild = 0; ///< index of the first sub-element in the table of sub-elements
+  size_t nChildren = 0;  ///< number of sub-elements in the table of sub-elements
+};
+
+/**
+ * @brief Locate the boundaries of concatenated TLV elements in a single pass.
+ * @tparam Fn a callable accepting `const ElementBounds&`
+ *
+ * @param buf       Begin of the buffer
+ * @param size      Size of the buffer
+ * @param onElement Invoked for each complete element, in order
+ *
+ * @return number of octets occupied by the complete elements; this is less than @p size if the
+ *         buffer ends with an incomplete element or contains a malformed TLV-TYPE or TLV-LENGTH,
+ *         in which case scanning stops at that element
+ * @note TLV-TYPE and TLV-LENGTH that both fit in one octet, which is the common case for the
+ *       sub-elements of network packets, are decoded without going through readVarNumber().
+ */
+template<typename Fn>
+size_t
+scanElements(const uint8_t* buf, size_t size, Fn&& onElement);
+
+/**
+ * @brief Locate the boundaries of concatenated TLV elements in a single pass.
+ * @param [out] elements Appended with the bounds of each complete element
+ * @return number of octets occupied by the complete elements
+ * @sa scanElements(const uint8_t*, size_t, Fn&&)
+ */
+size_t
+scanElements(const uint8_t* buf, size_t size, std::vector<ElementBounds>& elements);
+
+/**
+ * @brief Locate the boundaries of concatenated TLV elements and of their immediate
+ *        sub-elements in a single pass.
+ * @param [out] elements Appended with the bounds of each complete element
+ * @param [out] children Appended with the bounds of the sub-elements of each complete element,
+ *                       as offsets from @p buf; the sub-elements of `elements[i]` are the
+ *                       `elements[i].nChildren` entries starting at `elements[i].firstChild`
+ * @return number of octets occupied by the complete elements
+ * @note An element whose TLV-VALUE is not a sequence of complete sub-elements, e.g., one that
+ *       holds a NonNegativeInteger or opaque content, has no entries in @p children.
+ * @sa scanElements(const uint8_t*, size_t, Fn&&)
+ */
+size_t
+scanElements(const uint8_t* buf, size_t size, std::vector<ElementBounds>& elements,
+             std::vector<ElementBounds>& children);
+
 /////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////
@@ -531,6 +587,40 @@ writeNonNegativeInteger(std::ostream& os, uint64_t integer)
   }
 }
 
+template<typename Fn>
+size_t
+scanElements(const uint8_t* buf, size_t size, Fn&& onElement)
+{
+  size_t pos = 0;
+  while (pos < size) {
+    ElementBounds bounds;
+    bounds.begin = pos;
+    uint64_t length = 0;
+
+    if (size - pos >= 2 && buf[pos] < 253 && buf[pos + 1] < 253) {
+      bounds.type = buf[pos];
+      if (bounds.type == Invalid)
+        break;
+      length = buf[pos + 1];
+      bounds.valueBegin = pos + 2;
+    }
+    else {
+      const uint8_t* p = buf + pos;
+      if (!readType(p, buf + size, bounds.type) || !readVarNumber(p, buf + size, length))
+        break;
+      bounds.valueBegin = static_cast<size_t>(p - buf);
+    }
+
+    if (length > size - bounds.valueBegin)
+      break;
+    bounds.end = bounds.valueBegin + static_cast<size_t>(length);
+
+    onElement(static_cast<const ElementBounds&>(bounds));
+    pos = bounds.end;
+  }
+  return pos;
+}
+
 } // namespace tlv
 } // namespace ndn
 
@@ -0,0 +1,61 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/wire-sequence.hpp"
+
+#include <boost/asio/buffer.hpp>
+
+namespace ndn {
+
+WireRegion::WireRegion(const Block& block)
+  : m_owner(block.getBuffer())
+  , m_data(block.wire())
+  , m_size(block.size())
+{
+}
+
+WireRegion::operator boost::asio::const_buffer() const
+{
+  return boost::asio::const_buffer(m_data, m_size);
+}
+
+size_t
+getTotalSize(const WireSequence& sequence) noexcept
+{
+  size_t totalSize = 0;
+  for (const auto& region : sequence) {
+    totalSize += region.size();
+  }
+  return totalSize;
+}
+
+Block
+concatenate(const WireSequence& sequence)
+{
+  auto buffer = make_shared<Buffer>(getTotalSize(sequence));
+  auto out = buffer->begin();
+  for (const auto& region : sequence) {
+    out = std::copy(region.data(), region.data() + region.size(), out);
+  }
+  return Block(std::move(buffer));
+}
+
+} // namespace ndn
@@ -0,0 +1,94 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_ENCODING_WIRE_SEQUENCE_HPP
+#define NDN_CXX_ENCODING_WIRE_SEQUENCE_HPP
+
+#include "ndn-cxx/encoding/block.hpp"
+
+namespace ndn {
+
+/** @brief A read-only memory region that is part of a wire encoding.
+ *
+ *  The memory stays valid as long as the object referenced by the owner pointer is alive.
+ *  Unlike Block, the region does not have to be a TLV element, and does not have to reside
+ *  in a Buffer; e.g., it can be a part of a memory-mapped file.
+ */
+class WireRegion
+{
+public:
+  /** @brief Create a region that refers to the wire encoding of @p block.
+   *  @throw Block::Error @p block does not have a wire encoding
+   */
+  WireRegion(const Block& block);
+
+  /** @brief Create a region that refers to a memory area kept alive by @p owner.
+   */
+  WireRegion(shared_ptr<const void> owner, const uint8_t* data, size_t size) noexcept
+    : m_owner(std::move(owner))
+    , m_data(data)
+    , m_size(size)
+  {
+  }
+
+  const uint8_t*
+  data() const noexcept
+  {
+    return m_data;
+  }
+
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+  /** @brief Implicit conversion to `boost::asio::const_buffer`
+   */
+  operator boost::asio::const_buffer() const;
+
+private:
+  shared_ptr<const void> m_owner;
+  const uint8_t* m_data;
+  size_t m_size;
+};
+
+/** @brief A sequence of memory regions that together form a wire encoding.
+ *
+ *  This type satisfies the ConstBufferSequence requirements of Boost.Asio, and thus can be
+ *  passed directly to scatter/gather I/O operations.
+ */
+using WireSequence = std::vector<WireRegion>;
+
+/** @brief Return the total size of all regions in @p sequence.
+ */
+size_t
+getTotalSize(const WireSequence& sequence) noexcept;
+
+/** @brief Copy all regions of @p sequence into a contiguous buffer and parse it as a Block.
+ *  @throw tlv::Error the concatenated regions do not form a single TLV element
+ */
+Block
+concatenate(const WireSequence& sequence);
+
+} // namespace ndn
+
+#endif // NDN_CXX_ENCODING_WIRE_SEQUENCE_HPP
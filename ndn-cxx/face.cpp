@@ -289,6 +289,39 @@ Face::doProcessEvents(time::milliseconds timeout, bool keepThread)
   }
 }
 
+size_t
+Face::poll()
+{
+  if (m_ioService.stopped()) {
+    m_ioService.reset(); // ensure that poll() will do some work
+  }
+
+  try {
+    return m_ioService.poll();
+  }
+  catch (...) {
+    m_impl->shutdown();
+    throw;
+  }
+}
+
+int
+Face::getNativeHandle() const
+{
+  return m_transport->getNativeHandle();
+}
+
+optional<time::steady_clock::TimePoint>
+Face::getNextDeadline() const
+{
+  auto deadline = m_impl->m_scheduler.getNextExpiry();
+  auto connectDeadline = m_transport->getConnectDeadline();
+  if (!deadline || (connectDeadline && *connectDeadline < *deadline)) {
+    return connectDeadline;
+  }
+  return deadline;
+}
+
 void
 Face::shutdown()
 {
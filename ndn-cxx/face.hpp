@@ -400,6 +400,48 @@ public: // IO routine
     this->doProcessEvents(timeout, keepThread);
   }
 
+  /**
+   * @brief Run the handlers that are ready to run, without blocking.
+   *
+   * This is the step function for driving the face from an external event loop or executor,
+   * so that many faces can be multiplexed on a few threads. Unlike processEvents(), it never
+   * blocks and never stops the io_service. An external loop should call poll():
+   *  - when getNativeHandle() becomes readable,
+   *  - when getNextDeadline() is reached,
+   *  - after calling any other method of this face, because it may have posted work.
+   *
+   * The io_service must be dedicated to this face: poll() restarts it if it was stopped, runs
+   * and counts every ready handler on it, and shuts down the face if any of them throws.
+   * Faces that share an io_service should instead be driven by polling the io_service directly.
+   *
+   * @return number of handlers that were run
+   * @note The same exceptions as processEvents() may be thrown; the face is then shut down.
+   */
+  size_t
+  poll();
+
+  /**
+   * @brief Get the file descriptor of the connection to the forwarder.
+   * @return the file descriptor, or -1 if the face is not connected or the transport is not
+   *         backed by a socket
+   * @note The face connects on first use, so this returns -1 until an Interest is expressed,
+   *       a packet is sent, or a prefix is registered.
+   * @sa Transport::getNativeHandle()
+   */
+  int
+  getNativeHandle() const;
+
+  /**
+   * @brief Get the time at which the earliest internal timer of the face expires.
+   *
+   * This covers the Interest and prefix registration timers of the face, as well as the
+   * timeout of a pending connection attempt of the transport.
+   *
+   * @retval nullopt no timer is pending, e.g., no Interest is awaiting a reply
+   */
+  optional<time::steady_clock::TimePoint>
+  getNextDeadline() const;
+
   /**
    * @brief Shutdown face operations.
    *
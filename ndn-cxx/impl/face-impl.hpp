@@ -225,8 +225,14 @@ public: // producer
     addFieldFromTag<lp::CachePolicyField, lp::CachePolicyTag>(lpPacket, data);
     addFieldFromTag<lp::CongestionMarkField, lp::CongestionMarkTag>(lpPacket, data);
 
-    m_face.m_transport->send(finishEncoding(std::move(lpPacket), data.wireEncode(),
-                                            'D', data.getName()));
+    if (data.hasExternalContent()) {
+      m_face.m_transport->send(finishEncoding(std::move(lpPacket), data.wireEncodeScattered(),
+                                              'D', data.getName()));
+    }
+    else {
+      m_face.m_transport->send(finishEncoding(std::move(lpPacket), data.wireEncode(),
+                                              'D', data.getName()));
+    }
   }
 
   void
@@ -345,6 +351,47 @@ private:
     return wire;
   }
 
+  /** @brief Finish packet encoding without copying the network packet
+   *  @param lpPacket NDNLP packet without FragmentField
+   *  @param sequence wire encoding of Interest or Data as a sequence of memory regions
+   *  @param pktType packet type, 'I' for Interest, 'D' for Data, 'N' for Nack
+   *  @param name packet name
+   *  @return @p sequence, preceded by NDNLP header if needed
+   *  @throw Face::OversizedPacketError wire encoding exceeds limit
+   */
+  WireSequence
+  finishEncoding(lp::Packet&& lpPacket, WireSequence sequence, char pktType, const Name& name)
+  {
+    size_t fragmentSize = getTotalSize(sequence);
+    size_t totalSize = fragmentSize;
+
+    if (!lpPacket.empty()) {
+      // LpPacket = LP-PACKET-TYPE TLV-LENGTH *LpHeaderField [Fragment]
+      const Block& lpWire = lpPacket.wireEncode();
+      size_t valueLength = lpWire.value_size() + tlv::sizeOfVarNumber(lp::tlv::Fragment) +
+                           tlv::sizeOfVarNumber(fragmentSize) + fragmentSize;
+      size_t headerLength = tlv::sizeOfVarNumber(lp::tlv::LpPacket) +
+                            tlv::sizeOfVarNumber(valueLength) + valueLength - fragmentSize;
+
+      EncodingBuffer header(headerLength, 0);
+      header.prependVarNumber(fragmentSize);
+      header.prependVarNumber(lp::tlv::Fragment);
+      header.prependByteArray(lpWire.value(), lpWire.value_size());
+      header.prependVarNumber(valueLength);
+      header.prependVarNumber(lp::tlv::LpPacket);
+      BOOST_ASSERT(header.size() == headerLength);
+
+      sequence.emplace(sequence.begin(), header.getBuffer(), header.buf(), header.size());
+      totalSize += headerLength;
+    }
+
+    if (totalSize > MAX_NDN_PACKET_SIZE) {
+      NDN_THROW(Face::OversizedPacketError(pktType, name, totalSize));
+    }
+
+    return sequence;
+  }
+
   void
   dispatchInterest(PendingInterest& entry, const Interest& interest)
   {
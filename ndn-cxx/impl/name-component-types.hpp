@@ -27,12 +27,116 @@
 #include "ndn-cxx/util/string-helper.hpp"
 
 #include <array>
-#include <unordered_map>
+#include <cstring>
+#include <limits>
 
 namespace ndn {
 namespace name {
 namespace detail {
 
+/** \brief Bounded output buffer for URI representation.
+ *
+ *  Characters beyond the capacity are not stored but are still counted, so that the caller
+ *  can learn the size required for the complete output.
+ */
+class UriBuffer : noncopyable
+{
+public:
+  UriBuffer(char* buf, size_t capacity) noexcept
+    : m_buf(buf)
+    , m_capacity(capacity)
+  {
+  }
+
+  /** \brief Return the size of the complete output, which may exceed the capacity.
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+  void
+  append(char c) noexcept
+  {
+    if (m_size < m_capacity) {
+      m_buf[m_size] = c;
+    }
+    ++m_size;
+  }
+
+  void
+  append(const char* str, size_t len) noexcept
+  {
+    if (m_size < m_capacity) {
+      std::memcpy(m_buf + m_size, str, std::min(len, m_capacity - m_size));
+    }
+    m_size += len;
+  }
+
+  /** \brief Append \p len bytes starting at \p str, percent-encoded.
+   */
+  void
+  appendEscaped(const char* str, size_t len)
+  {
+    if (getRemaining() >= 3 * len) {
+      m_size += escape(m_buf + m_size, str, len);
+      return;
+    }
+
+    char tmp[3 * 64];
+    for (size_t i = 0; i < len; i += 64) {
+      size_t n = std::min<size_t>(64, len - i);
+      append(tmp, escape(tmp, str + i, n));
+    }
+  }
+
+  void
+  appendDecimal(uint64_t n) noexcept
+  {
+    char tmp[20];
+    char* p = tmp + sizeof(tmp);
+    do {
+      *--p = static_cast<char>('0' + n % 10);
+      n /= 10;
+    } while (n != 0);
+    append(p, static_cast<size_t>(tmp + sizeof(tmp) - p));
+  }
+
+  /** \brief Append \p len bytes starting at \p bytes, as lower-case hexadecimal.
+   */
+  void
+  appendHex(const uint8_t* bytes, size_t len) noexcept
+  {
+    if (getRemaining() >= 2 * len) {
+      char* p = m_buf + m_size;
+      for (size_t i = 0; i < len; ++i) {
+        *p++ = toHexChar(bytes[i] >> 4, false);
+        *p++ = toHexChar(bytes[i] & 0xf, false);
+      }
+      m_size += 2 * len;
+      return;
+    }
+
+    for (size_t i = 0; i < len; ++i) {
+      append(toHexChar(bytes[i] >> 4, false));
+      append(toHexChar(bytes[i] & 0xf, false));
+    }
+  }
+
+private:
+  size_t
+  getRemaining() const noexcept
+  {
+    return m_size < m_capacity ? m_capacity - m_size : 0;
+  }
+
+private:
+  char* m_buf;
+  size_t m_capacity;
+  size_t m_size = 0;
+};
+
 /** \brief Declare rules for a NameComponent type.
  */
 class ComponentType : noncopyable
@@ -87,25 +191,27 @@ public:
 
   /** \brief Parse component from alternate URI representation.
    *  \param input the `<value>` portion of the alternate URI representation.
+   *  \param len length of \p input
    *  \throw Component::Error
    *  \pre getAltUriPrefix() != nullptr
    */
   virtual Component
-  parseAltUriValue(const std::string&) const
+  parseAltUriValue(const char* input, size_t len) const
   {
     NDN_CXX_UNREACHABLE;
   }
 
-  /** \brief Write URI representation of \p comp to \p os.
+  /** \brief Write URI representation of \p comp to \p out.
    *
    *  This base class implementation encodes the component using the plain
    *  `<type-number>=<escaped-value>` syntax (aka canonical format).
    */
   virtual void
-  writeUri(std::ostream& os, const Component& comp) const
+  writeUri(UriBuffer& out, const Component& comp) const
   {
-    os << comp.type() << '=';
-    writeUriEscapedValue(os, comp);
+    out.appendDecimal(comp.type());
+    out.append('=');
+    writeUriEscapedValue(out, comp);
   }
 
 protected:
@@ -140,14 +246,14 @@ protected:
   /** \brief Write TLV-VALUE as `<escaped-value>` of NDN URI syntax.
    */
   void
-  writeUriEscapedValue(std::ostream& os, const Component& comp) const
+  writeUriEscapedValue(UriBuffer& out, const Component& comp) const
   {
     bool isAllPeriods = std::all_of(comp.value_begin(), comp.value_end(),
                                     [] (uint8_t x) { return x == '.'; });
     if (isAllPeriods) {
-      os << "...";
+      out.append("...", 3);
     }
-    escape(os, reinterpret_cast<const char*>(comp.value()), comp.value_size());
+    out.appendEscaped(reinterpret_cast<const char*>(comp.value()), comp.value_size());
   }
 };
 
@@ -160,9 +266,9 @@ class GenericNameComponentType final : public ComponentType
 {
 public:
   void
-  writeUri(std::ostream& os, const Component& comp) const final
+  writeUri(UriBuffer& out, const Component& comp) const final
   {
-    writeUriEscapedValue(os, comp);
+    writeUriEscapedValue(out, comp);
   }
 };
 
@@ -232,23 +338,29 @@ public:
   }
 
   Component
-  parseAltUriValue(const std::string& input) const final
+  parseAltUriValue(const char* input, size_t len) const final
   {
-    shared_ptr<Buffer> value;
-    try {
-      value = fromHex(input);
-    }
-    catch (const StringHelperError&) {
+    if (len % 2 != 0) {
       NDN_THROW(Error("Cannot convert to " + m_typeName + " (invalid hex encoding)"));
     }
+    auto value = make_shared<Buffer>(len / 2);
+    for (size_t i = 0; i < value->size(); ++i) {
+      int hi = fromHexChar(input[2 * i]);
+      int lo = fromHexChar(input[2 * i + 1]);
+      if (hi < 0 || lo < 0) {
+        NDN_THROW(Error("Cannot convert to " + m_typeName + " (invalid hex encoding)"));
+      }
+      (*value)[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
     return Component(m_type, std::move(value));
   }
 
   void
-  writeUri(std::ostream& os, const Component& comp) const final
+  writeUri(UriBuffer& out, const Component& comp) const final
   {
-    os << m_uriPrefix << '=';
-    printHex(os, comp.value(), comp.value_size(), false);
+    out.append(m_uriPrefix.data(), m_uriPrefix.size());
+    out.append('=');
+    out.appendHex(comp.value(), comp.value_size());
   }
 
 private:
@@ -298,32 +410,36 @@ public:
   }
 
   Component
-  parseAltUriValue(const std::string& input) const final
+  parseAltUriValue(const char* input, size_t len) const final
   {
-    uint64_t n = 0;
-    try {
-      n = std::stoull(input);
-    }
-    catch (const std::invalid_argument&) {
+    // only the canonical decimal form is accepted: no sign, whitespace, or leading zeros
+    if (len == 0 || (input[0] == '0' && len > 1)) {
       NDN_THROW(Error("Cannot convert to " + m_typeName + " (invalid format)"));
     }
-    catch (const std::out_of_range&) {
-      NDN_THROW(Error("Cannot convert to " + m_typeName + " (out of range)"));
-    }
-    if (to_string(n) != input) {
-      NDN_THROW(Error("Cannot convert to " + m_typeName + " (invalid format)"));
+    uint64_t n = 0;
+    for (size_t i = 0; i < len; ++i) {
+      if (input[i] < '0' || input[i] > '9') {
+        NDN_THROW(Error("Cannot convert to " + m_typeName + " (invalid format)"));
+      }
+      uint64_t digit = static_cast<uint64_t>(input[i] - '0');
+      if (n > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+        NDN_THROW(Error("Cannot convert to " + m_typeName + " (out of range)"));
+      }
+      n = n * 10 + digit;
     }
     return Component::fromNumber(n, m_type);
   }
 
   void
-  writeUri(std::ostream& os, const Component& comp) const final
+  writeUri(UriBuffer& out, const Component& comp) const final
   {
     if (comp.isNumber()) {
-      os << m_uriPrefix << '=' << comp.toNumber();
+      out.append(m_uriPrefix.data(), m_uriPrefix.size());
+      out.append('=');
+      out.appendDecimal(comp.toNumber());
     }
     else {
-      ComponentType::writeUri(os, comp);
+      ComponentType::writeUri(out, comp);
     }
   }
 
@@ -354,13 +470,16 @@ public:
   /** \brief Retrieve ComponentType by alternate URI prefix.
    */
   const ComponentType*
-  findByUriPrefix(const std::string& prefix) const
+  findByUriPrefix(const char* prefix, size_t len) const
   {
-    auto it = m_uriPrefixes.find(prefix);
-    if (it == m_uriPrefixes.end()) {
-      return nullptr;
+    // there are only a handful of prefixes, so a linear scan beats hashing a temporary string
+    for (const auto& ct : m_uriPrefixes) {
+      if (std::strlen(ct->getAltUriPrefix()) == len &&
+          std::memcmp(ct->getAltUriPrefix(), prefix, len) == 0) {
+        return ct;
+      }
     }
-    return it->second;
+    return nullptr;
   }
 
 private:
@@ -369,14 +488,14 @@ private:
   {
     m_table.at(type) = &ct;
     if (ct.getAltUriPrefix() != nullptr) {
-      m_uriPrefixes[ct.getAltUriPrefix()] = &ct;
+      m_uriPrefixes.push_back(&ct);
     }
   }
 
 private:
   const ComponentType m_baseType;
   std::array<const ComponentType*, 38> m_table;
-  std::unordered_map<std::string, const ComponentType*> m_uriPrefixes;
+  std::vector<const ComponentType*> m_uriPrefixes;
 };
 
 inline
@@ -31,6 +31,7 @@ InMemoryStorageEntry::InMemoryStorageEntry()
 void
 InMemoryStorageEntry::release()
 {
+  m_fullName = nullopt;
   m_dataPacket.reset();
   m_markStaleEventId.cancel();
 }
@@ -39,6 +40,7 @@ void
 InMemoryStorageEntry::setData(const Data& data)
 {
   m_dataPacket = data.shared_from_this();
+  m_fullName.emplace(*m_dataPacket);
   m_isFresh = true;
 }
 
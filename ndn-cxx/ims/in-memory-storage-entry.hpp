@@ -22,6 +22,7 @@
 #ifndef NDN_IMS_IN_MEMORY_STORAGE_ENTRY_HPP
 #define NDN_IMS_IN_MEMORY_STORAGE_ENTRY_HPP
 
+#include "ndn-cxx/compact-full-name.hpp"
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
@@ -59,6 +60,15 @@ public:
     return m_dataPacket->getFullName();
   }
 
+  /** @brief Returns the full name of the Data packet stored in the in-memory storage entry,
+   *         without materializing it as a Name
+   */
+  const CompactFullName&
+  getCompactFullName() const
+  {
+    return *m_fullName;
+  }
+
   /** @brief Returns the Data packet stored in the in-memory storage entry
    */
   const Data&
@@ -89,6 +99,7 @@ public:
 
 private:
   shared_ptr<const Data> m_dataPacket;
+  optional<CompactFullName> m_fullName;
 
   bool m_isFresh;
   scheduler::ScopedEventId m_markStaleEventId;
@@ -48,7 +48,7 @@ InMemoryStorageLfu::evictItem()
 {
   if (!m_cleanupIndex.get<byFrequency>().empty()) {
     CleanupIndex::index<byFrequency>::type::iterator it = m_cleanupIndex.get<byFrequency>().begin();
-    eraseImpl(((*it).entry)->getFullName());
+    eraseImpl(((*it).entry)->getCompactFullName());
     m_cleanupIndex.get<byFrequency>().erase(it);
     return true;
   }
@@ -161,7 +161,7 @@ void
 InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow)
 {
   // check if identical Data/Name already exists
-  auto it = m_cache.get<byFullName>().find(data.getFullName());
+  auto it = m_cache.get<byFullName>().find(CompactFullName(data));
   if (it != m_cache.get<byFullName>().end())
     return;
 
@@ -205,7 +205,7 @@ InMemoryStorage::find(const Name& name)
   }
 
   // if the given name is not the prefix of the lower_bound, return null
-  if (!name.isPrefixOf((*it)->getFullName())) {
+  if (!(*it)->getCompactFullName().hasPrefix(name)) {
     return nullptr;
   }
 
@@ -265,7 +265,7 @@ InMemoryStorage::selectChild(const Interest& interest,
   BOOST_ASSERT(startingPoint != m_cache.get<byFullName>().end());
 
   if (startingPoint != m_cache.get<byFullName>().begin()) {
-    BOOST_ASSERT((*startingPoint)->getFullName() < interest.getName());
+    BOOST_ASSERT((*startingPoint)->getCompactFullName() < interest.getName());
   }
 
   // filter out non-fresh data
@@ -292,7 +292,7 @@ InMemoryStorage::selectChild(const Interest& interest,
 
     bool isInPrefix = false;
     if (rightmostCandidate != m_cache.get<byFullName>().end()) {
-      isInPrefix = interest.getName().isPrefixOf((*rightmostCandidate)->getFullName());
+      isInPrefix = (*rightmostCandidate)->getCompactFullName().hasPrefix(interest.getName());
     }
     if (isInPrefix) {
       if (interest.matchesData((*rightmostCandidate)->getData())) {
@@ -310,11 +310,15 @@ InMemoryStorage::selectChild(const Interest& interest,
 InMemoryStorage::Cache::iterator
 InMemoryStorage::freeEntry(Cache::iterator it)
 {
+  // the entry's key refers to its Data packet, so remove it from the index before releasing
+  InMemoryStorageEntry* entry = *it;
+  auto next = m_cache.erase(it);
+
   // push the *empty* entry into mem pool
-  (*it)->release();
-  m_freeEntries.push(*it);
+  entry->release();
+  m_freeEntries.push(entry);
   m_nPackets--;
-  return m_cache.erase(it);
+  return next;
 }
 
 void
@@ -352,6 +356,16 @@ InMemoryStorage::eraseImpl(const Name& name)
   freeEntry(it);
 }
 
+void
+InMemoryStorage::eraseImpl(const CompactFullName& fullName)
+{
+  auto it = m_cache.get<byFullName>().find(fullName);
+  if (it == m_cache.get<byFullName>().end())
+    return;
+
+  freeEntry(it);
+}
+
 InMemoryStorage::const_iterator
 InMemoryStorage::begin() const
 {
@@ -386,7 +400,7 @@ InMemoryStorage::printCache(std::ostream& os) const
 {
   // start from the upper layer towards bottom
   for (const auto& elem : m_cache.get<byFullName>())
-    os << elem->getFullName() << std::endl;
+    os << elem->getCompactFullName() << std::endl;
 }
 
 } // namespace ndn
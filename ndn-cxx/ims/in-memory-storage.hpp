@@ -51,9 +51,9 @@ public:
       // by Full Name
       boost::multi_index::ordered_unique<
         boost::multi_index::tag<byFullName>,
-        boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
-                                          &InMemoryStorageEntry::getFullName>,
-        std::less<Name>
+        boost::multi_index::const_mem_fun<InMemoryStorageEntry, const CompactFullName&,
+                                          &InMemoryStorageEntry::getCompactFullName>,
+        std::less<>
       >
 
     >
@@ -280,6 +280,12 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PROTECTED:
   void
   eraseImpl(const Name& name);
 
+  /** @brief deletes in-memory storage entries by their full name.
+   *  @sa eraseImpl(const Name&)
+   */
+  void
+  eraseImpl(const CompactFullName& fullName);
+
   /** @brief Prints contents of the in-memory storage
    */
   void
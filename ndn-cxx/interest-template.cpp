@@ -0,0 +1,177 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/interest-template.hpp"
+#include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/util/random.hpp"
+
+namespace ndn {
+
+static bool
+hasParametersDigest(const Name& name)
+{
+  return std::any_of(name.begin(), name.end(),
+                     [] (const name::Component& comp) { return comp.isParametersSha256Digest(); });
+}
+
+InterestTemplate::InterestTemplate(const Name& prefix, time::milliseconds lifetime)
+  : m_interestLifetime(DEFAULT_INTEREST_LIFETIME)
+{
+  setPrefix(prefix);
+  setInterestLifetime(lifetime);
+}
+
+InterestTemplate&
+InterestTemplate::setPrefix(const Name& prefix)
+{
+  if (hasParametersDigest(prefix)) {
+    NDN_THROW(std::invalid_argument("InterestTemplate does not support ParametersSha256DigestComponent"));
+  }
+  m_prefix = prefix;
+  m_prefix.wireEncode(); // ensure the prefix wire is cached for encode()
+  return *this;
+}
+
+InterestTemplate&
+InterestTemplate::setCanBePrefix(bool canBePrefix)
+{
+  m_canBePrefix = canBePrefix;
+  updateWire();
+  return *this;
+}
+
+InterestTemplate&
+InterestTemplate::setMustBeFresh(bool mustBeFresh)
+{
+  m_mustBeFresh = mustBeFresh;
+  updateWire();
+  return *this;
+}
+
+InterestTemplate&
+InterestTemplate::setForwardingHint(const DelegationList& value)
+{
+  m_forwardingHint = value;
+  updateWire();
+  return *this;
+}
+
+InterestTemplate&
+InterestTemplate::setInterestLifetime(time::milliseconds lifetime)
+{
+  if (lifetime < 0_ms) {
+    NDN_THROW(std::invalid_argument("InterestLifetime must be >= 0"));
+  }
+  m_interestLifetime = lifetime;
+  updateWire();
+  return *this;
+}
+
+InterestTemplate&
+InterestTemplate::setHopLimit(optional<uint8_t> hopLimit)
+{
+  m_hopLimit = hopLimit;
+  updateWire();
+  return *this;
+}
+
+void
+InterestTemplate::updateWire()
+{
+  EncodingBuffer before;
+  if (!m_forwardingHint.empty()) {
+    m_forwardingHint.wireEncode(before);
+  }
+  if (m_mustBeFresh) {
+    prependEmptyBlock(before, tlv::MustBeFresh);
+  }
+  if (m_canBePrefix) {
+    prependEmptyBlock(before, tlv::CanBePrefix);
+  }
+  m_beforeNonce.assign(before.begin(), before.end());
+
+  EncodingBuffer after;
+  if (m_hopLimit) {
+    after.prependByteArrayBlock(tlv::HopLimit, &*m_hopLimit, 1);
+  }
+  if (m_interestLifetime != DEFAULT_INTEREST_LIFETIME) {
+    prependNonNegativeIntegerBlock(after, tlv::InterestLifetime,
+                                   static_cast<uint64_t>(m_interestLifetime.count()));
+  }
+  m_afterNonce.assign(after.begin(), after.end());
+}
+
+Block
+InterestTemplate::encode(const PartialName& nameSuffix, optional<Interest::Nonce> nonce) const
+{
+  if (m_prefix.empty() && nameSuffix.empty()) {
+    NDN_THROW(std::invalid_argument("Interest name cannot be empty"));
+  }
+  if (hasParametersDigest(nameSuffix)) {
+    NDN_THROW(std::invalid_argument("InterestTemplate does not support ParametersSha256DigestComponent"));
+  }
+
+  if (!nonce) {
+    nonce.emplace();
+    random::generateNonceBytes(nonce->data(), nonce->size());
+  }
+
+  // Interest = INTEREST-TYPE TLV-LENGTH
+  //              Name
+  //              [CanBePrefix]
+  //              [MustBeFresh]
+  //              [ForwardingHint]
+  //              [Nonce]
+  //              [InterestLifetime]
+  //              [HopLimit]
+
+  const Block& prefixWire = m_prefix.wireEncode();
+  size_t nameValueLength = prefixWire.value_size();
+  for (const auto& component : nameSuffix) {
+    nameValueLength += component.size();
+  }
+
+  size_t valueLength = tlv::sizeOfVarNumber(tlv::Name) + tlv::sizeOfVarNumber(nameValueLength) +
+                       nameValueLength + m_beforeNonce.size() +
+                       tlv::sizeOfVarNumber(tlv::Nonce) + tlv::sizeOfVarNumber(nonce->size()) +
+                       nonce->size() + m_afterNonce.size();
+  size_t totalLength = tlv::sizeOfVarNumber(tlv::Interest) + tlv::sizeOfVarNumber(valueLength) +
+                       valueLength;
+
+  EncodingBuffer encoder(totalLength, 0);
+  encoder.prependByteArray(m_afterNonce.data(), m_afterNonce.size());
+  encoder.prependByteArrayBlock(tlv::Nonce, nonce->data(), nonce->size());
+  encoder.prependByteArray(m_beforeNonce.data(), m_beforeNonce.size());
+  for (auto i = nameSuffix.rbegin(); i != nameSuffix.rend(); ++i) {
+    encoder.prependBlock(*i);
+  }
+  encoder.prependByteArray(prefixWire.value(), prefixWire.value_size());
+  encoder.prependVarNumber(nameValueLength);
+  encoder.prependVarNumber(tlv::Name);
+  encoder.prependVarNumber(valueLength);
+  encoder.prependVarNumber(tlv::Interest);
+  BOOST_ASSERT(encoder.size() == totalLength);
+
+  return encoder.block();
+}
+
+} // namespace ndn
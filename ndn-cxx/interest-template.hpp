@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_INTEREST_TEMPLATE_HPP
+#define NDN_CXX_INTEREST_TEMPLATE_HPP
+
+#include "ndn-cxx/interest.hpp"
+
+namespace ndn {
+
+/** @brief Template for high-rate construction of %Interest packets.
+ *
+ *  An InterestTemplate holds the fields that are shared by many Interests, namely the name
+ *  prefix, CanBePrefix, MustBeFresh, ForwardingHint, InterestLifetime, and HopLimit, in
+ *  pre-encoded form. Each packet produced from the template only needs to encode its name
+ *  suffix and Nonce. The whole packet is encoded into a single, right-sized buffer.
+ *
+ *  Unlike Interest, CanBePrefix is false unless explicitly set, and the template does not
+ *  support ApplicationParameters.
+ */
+class InterestTemplate
+{
+public:
+  /** @brief Create a template with the given name prefix and InterestLifetime.
+   *  @throw std::invalid_argument @p lifetime is negative
+   */
+  explicit
+  InterestTemplate(const Name& prefix = Name(),
+                   time::milliseconds lifetime = DEFAULT_INTEREST_LIFETIME);
+
+  const Name&
+  getPrefix() const noexcept
+  {
+    return m_prefix;
+  }
+
+  /** @brief Set the name prefix shared by all packets produced from this template.
+   *  @throw std::invalid_argument @p prefix contains a ParametersSha256DigestComponent
+   */
+  InterestTemplate&
+  setPrefix(const Name& prefix);
+
+  bool
+  getCanBePrefix() const noexcept
+  {
+    return m_canBePrefix;
+  }
+
+  InterestTemplate&
+  setCanBePrefix(bool canBePrefix);
+
+  bool
+  getMustBeFresh() const noexcept
+  {
+    return m_mustBeFresh;
+  }
+
+  InterestTemplate&
+  setMustBeFresh(bool mustBeFresh);
+
+  const DelegationList&
+  getForwardingHint() const noexcept
+  {
+    return m_forwardingHint;
+  }
+
+  InterestTemplate&
+  setForwardingHint(const DelegationList& value);
+
+  time::milliseconds
+  getInterestLifetime() const noexcept
+  {
+    return m_interestLifetime;
+  }
+
+  /** @brief Set the InterestLifetime of all packets produced from this template.
+   *  @throw std::invalid_argument @p lifetime is negative
+   */
+  InterestTemplate&
+  setInterestLifetime(time::milliseconds lifetime);
+
+  optional<uint8_t>
+  getHopLimit() const noexcept
+  {
+    return m_hopLimit;
+  }
+
+  InterestTemplate&
+  setHopLimit(optional<uint8_t> hopLimit);
+
+  /** @brief Encode an Interest packet.
+   *  @param nameSuffix name components appended to the template prefix
+   *  @param nonce Nonce of the Interest; if nullopt, a random nonce is generated
+   *  @return wire encoding of the Interest packet
+   *  @throw std::invalid_argument the resulting name is empty or @p nameSuffix contains a
+   *                               ParametersSha256DigestComponent
+   */
+  Block
+  encode(const PartialName& nameSuffix = {}, optional<Interest::Nonce> nonce = nullopt) const;
+
+  /** @brief Create an Interest packet.
+   *  @sa encode()
+   */
+  shared_ptr<Interest>
+  makeInterest(const PartialName& nameSuffix = {}, optional<Interest::Nonce> nonce = nullopt) const
+  {
+    return make_shared<Interest>(encode(nameSuffix, nonce));
+  }
+
+private:
+  /** @brief Re-encode the invariant elements that precede and follow the Nonce.
+   */
+  void
+  updateWire();
+
+private:
+  Name m_prefix;
+  bool m_canBePrefix = false;
+  bool m_mustBeFresh = false;
+  DelegationList m_forwardingHint;
+  time::milliseconds m_interestLifetime;
+  optional<uint8_t> m_hopLimit;
+
+  Buffer m_beforeNonce; ///< encoded [CanBePrefix] [MustBeFresh] [ForwardingHint]
+  Buffer m_afterNonce; ///< encoded [InterestLifetime] [HopLimit]
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_INTEREST_TEMPLATE_HPP
@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/compact-full-name.hpp"
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/security/transform/digest-filter.hpp"
@@ -143,8 +144,8 @@ Interest::wireEncode(EncodingImpl<TAG>& encoder) const
   totalLength += encoder.prependByteArrayBlock(tlv::Nonce, m_nonce->data(), m_nonce->size());
 
   // ForwardingHint
-  if (!getForwardingHint().empty()) {
-    totalLength += getForwardingHint().wireEncode(encoder);
+  if (m_forwardingHint != nullptr) {
+    totalLength += encoder.prependBlock(m_forwardingHint->wireEncode());
   }
 
   // MustBeFresh
@@ -173,18 +174,46 @@ Interest::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
+  // the packet is not decoded again after encoding, so the checks that wireDecode() would
+  // perform on the fields must be done here
+  if (getName().empty()) {
+    NDN_THROW(Error("Name has zero name components"));
+  }
+
+  // cache the Name encoding, so that both passes below copy it as a single block
+  getName().wireEncode();
+
   EncodingEstimator estimator;
   size_t estimatedSize = wireEncode(estimator);
 
   EncodingBuffer encoder(estimatedSize, 0);
   wireEncode(encoder);
 
-  const_cast<Interest*>(this)->wireDecode(encoder.block());
+  // the fields already hold the encoded values, so there is no need to decode the packet again;
+  // the encoded parameters are identical to m_parameters, so their digest is still valid
+  m_wire = encoder.block();
+  m_wire.parse();
+  m_isCanBePrefixSet = true; // same as a decoded packet
+
+  // rebind ApplicationParameters and following elements to the new buffer
+  BOOST_ASSERT(m_wire.elements_size() >= m_parameters.size());
+  std::copy(m_wire.elements_end() - m_parameters.size(), m_wire.elements_end(),
+            const_cast<Interest*>(this)->m_parameters.begin());
   return m_wire;
 }
 
 void
 Interest::wireDecode(const Block& wire)
+{
+  wireDecodeImpl(wire);
+
+  if (s_autoCheckParametersDigest && !isParametersDigestValid()) {
+    NDN_THROW(Error("ParametersSha256DigestComponent does not match the SHA-256 of Interest parameters"));
+  }
+}
+
+void
+Interest::wireDecodeImpl(const Block& wire)
 {
   if (wire.type() != tlv::Interest) {
     NDN_THROW(Error("Interest", wire.type()));
@@ -220,11 +249,12 @@ Interest::wireDecode(const Block& wire)
 
   m_isCanBePrefixSet = true; // don't trigger warning from decoded packet
   m_canBePrefix = m_mustBeFresh = false;
-  m_forwardingHint = {};
+  m_forwardingHint = nullptr;
   m_nonce.reset();
   m_interestLifetime = DEFAULT_INTEREST_LIFETIME;
   m_hopLimit.reset();
   m_parameters.clear();
+  m_parametersDigest.reset();
 
   int lastElement = 1; // last recognized element index, in spec order
   for (++element; element != m_wire.elements_end(); ++element) {
@@ -255,7 +285,7 @@ Interest::wireDecode(const Block& wire)
         if (lastElement >= 4) {
           NDN_THROW(Error("ForwardingHint element is out of order"));
         }
-        m_forwardingHint.wireDecode(*element);
+        m_forwardingHint = SharedForwardingHint::create(*element);
         lastElement = 4;
         break;
       }
@@ -313,10 +343,6 @@ Interest::wireDecode(const Block& wire)
       }
     }
   }
-
-  if (s_autoCheckParametersDigest && !isParametersDigestValid()) {
-    NDN_THROW(Error("ParametersSha256DigestComponent does not match the SHA-256 of Interest parameters"));
-  }
 }
 
 std::string
@@ -339,7 +365,7 @@ Interest::matchesData(const Data& data) const
   // check Name and CanBePrefix
   if (interestNameLength == fullNameLength) {
     if (m_name.get(-1).isImplicitSha256Digest()) {
-      if (m_name != data.getFullName()) {
+      if (CompactFullName(data) != m_name) {
         return false;
       }
     }
@@ -388,10 +414,26 @@ Interest::setName(const Name& name)
   return *this;
 }
 
+const DelegationList&
+Interest::getForwardingHint() const noexcept
+{
+  static const DelegationList emptyForwardingHint;
+  return m_forwardingHint == nullptr ? emptyForwardingHint : m_forwardingHint->getDelegations();
+}
+
 Interest&
 Interest::setForwardingHint(const DelegationList& value)
 {
-  m_forwardingHint = value;
+  if (value.empty()) {
+    return setSharedForwardingHint(nullptr);
+  }
+  return setSharedForwardingHint(SharedForwardingHint::create(value));
+}
+
+Interest&
+Interest::setSharedForwardingHint(shared_ptr<const SharedForwardingHint> value)
+{
+  m_forwardingHint = std::move(value);
   m_wire.reset();
   return *this;
 }
@@ -399,9 +441,8 @@ Interest::setForwardingHint(const DelegationList& value)
 static auto
 generateNonce()
 {
-  uint32_t r = random::generateWord32();
   Interest::Nonce n;
-  std::memcpy(n.data(), &r, sizeof(r));
+  random::generateNonceBytes(n.data(), n.size());
   return n;
 }
 
@@ -472,6 +513,7 @@ Interest::setApplicationParametersInternal(Block parameters)
     BOOST_ASSERT(m_parameters[0].type() == tlv::ApplicationParameters);
     m_parameters[0] = std::move(parameters);
   }
+  m_parametersDigest.reset();
 }
 
 Interest&
@@ -519,6 +561,7 @@ Interest&
 Interest::unsetApplicationParameters()
 {
   m_parameters.clear();
+  m_parametersDigest.reset();
   ssize_t digestIndex = findParametersDigestComponent(getName());
   if (digestIndex >= 0) {
     m_name.erase(digestIndex);
@@ -576,6 +619,7 @@ Interest::setSignatureInfo(const SignatureInfo& info)
     m_parameters.insert(valueIt, std::move(encodedInfo));
   }
 
+  m_parametersDigest.reset();
   addOrReplaceParametersDigestComponent();
   m_wire.reset();
   return *this;
@@ -626,6 +670,7 @@ Interest::setSignatureValue(ConstBufferPtr value)
   // computeParametersDigest needs encoded SignatureValue
   valueIt->encode();
 
+  m_parametersDigest.reset();
   addOrReplaceParametersDigestComponent();
   m_wire.reset();
   return *this;
@@ -686,9 +731,13 @@ Interest::isParametersDigestValid() const
                     digest->begin(), digest->end());
 }
 
-shared_ptr<Buffer>
+ConstBufferPtr
 Interest::computeParametersDigest() const
 {
+  if (m_parametersDigest != nullptr) {
+    return m_parametersDigest;
+  }
+
   using namespace security::transform;
 
   StepSource in;
@@ -700,7 +749,8 @@ Interest::computeParametersDigest() const
   }
   in.end();
 
-  return out.buf();
+  m_parametersDigest = out.buf();
+  return m_parametersDigest;
 }
 
 void
@@ -26,6 +26,7 @@
 #include "ndn-cxx/detail/packet-base.hpp"
 #include "ndn-cxx/name.hpp"
 #include "ndn-cxx/security/security-common.hpp"
+#include "ndn-cxx/shared-forwarding-hint.hpp"
 #include "ndn-cxx/signature-info.hpp"
 #include "ndn-cxx/util/string-helper.hpp"
 #include "ndn-cxx/util/time.hpp"
@@ -241,32 +242,61 @@ public: // element access
     return *this;
   }
 
+  /** @brief Get the ForwardingHint delegations.
+   *
+   *  The returned list is sorted and is empty if the ForwardingHint element is absent.
+   */
   const DelegationList&
-  getForwardingHint() const noexcept
+  getForwardingHint() const noexcept;
+
+  /** @brief Get the ForwardingHint as a shared object.
+   *  @return the shared ForwardingHint, or nullptr if the ForwardingHint element is absent
+   */
+  const shared_ptr<const SharedForwardingHint>&
+  getSharedForwardingHint() const noexcept
   {
     return m_forwardingHint;
   }
 
+  /** @brief Set the ForwardingHint delegations.
+   *
+   *  The delegations are sorted and encoded immediately. An empty list removes the
+   *  ForwardingHint element.
+   */
   Interest&
   setForwardingHint(const DelegationList& value);
 
+  /** @brief Set the ForwardingHint to a shared, pre-encoded object.
+   *
+   *  This avoids copying, sorting, and encoding the delegations when the same hint is attached
+   *  to many Interests. Passing nullptr removes the ForwardingHint element.
+   */
+  Interest&
+  setSharedForwardingHint(shared_ptr<const SharedForwardingHint> value);
+
   /** @brief Modify ForwardingHint in-place.
    *  @tparam Modifier a unary function that accepts DelegationList&
    *
-   *  This is equivalent to, but more efficient (avoids copying) than:
+   *  This is equivalent to:
    *  @code
    *  auto fh = interest.getForwardingHint();
    *  modifier(fh);
    *  interest.setForwardingHint(fh);
    *  @endcode
+   *
+   *  @note Because the ForwardingHint may be shared with other Interests, the delegations are
+   *        always copied before being modified.
    */
   template<typename Modifier>
   Interest&
   modifyForwardingHint(const Modifier& modifier)
   {
-    modifier(m_forwardingHint);
-    m_wire.reset();
-    return *this;
+    DelegationList fh = getForwardingHint();
+    modifier(fh);
+    if (fh.empty()) {
+      return setSharedForwardingHint(nullptr);
+    }
+    return setSharedForwardingHint(SharedForwardingHint::create(std::move(fh)));
   }
 
   /** @brief Check if the Nonce element is present.
@@ -456,10 +486,20 @@ public: // ParametersSha256DigestComponent support
   isParametersDigestValid() const;
 
 private:
+  /** @brief Decode from @p wire without checking the ParametersSha256DigestComponent.
+   */
+  void
+  wireDecodeImpl(const Block& wire);
+
   void
   setApplicationParametersInternal(Block parameters);
 
-  NDN_CXX_NODISCARD shared_ptr<Buffer>
+  /** @brief Return the SHA-256 digest of the Interest parameters.
+   *
+   *  The digest is computed at most once for each distinct set of parameters and cached
+   *  until the parameters are modified or a different wire encoding is decoded.
+   */
+  NDN_CXX_NODISCARD ConstBufferPtr
   computeParametersDigest() const;
 
   /** @brief Append a ParametersSha256DigestComponent to the Interest's name
@@ -495,7 +535,7 @@ private:
   static bool s_autoCheckParametersDigest;
 
   Name m_name;
-  DelegationList m_forwardingHint;
+  shared_ptr<const SharedForwardingHint> m_forwardingHint;
   mutable optional<Nonce> m_nonce;
   time::milliseconds m_interestLifetime;
   optional<uint8_t> m_hopLimit;
@@ -510,6 +550,7 @@ private:
   // be an ApplicationParameters block. All blocks in this vector are covered by the
   // digest in the ParametersSha256DigestComponent.
   std::vector<Block> m_parameters;
+  mutable ConstBufferPtr m_parametersDigest; ///< cached digest of m_parameters, may be nullptr
 
   mutable Block m_wire;
 };
@@ -47,6 +47,7 @@ Link::Link(const Name& name, std::initializer_list<Delegation> dels)
 void
 Link::encodeContent()
 {
+  m_forwardingHint.reset();
   setContentType(tlv::ContentType_Link);
 
   if (m_delList.size() > 0) {
@@ -72,6 +73,7 @@ Link::wireDecode(const Block& wire, bool wantSort)
     NDN_THROW(Error("Expecting ContentType Link, got " + to_string(getContentType())));
   }
 
+  m_forwardingHint.reset();
   m_delList.wireDecode(getContent(), wantSort);
 }
 
@@ -99,4 +101,13 @@ Link::removeDelegation(const Name& name)
   return nErased > 0;
 }
 
+shared_ptr<const SharedForwardingHint>
+Link::getForwardingHint() const
+{
+  if (m_forwardingHint == nullptr && !m_delList.empty()) {
+    m_forwardingHint = SharedForwardingHint::create(m_delList);
+  }
+  return m_forwardingHint;
+}
+
 } // namespace ndn
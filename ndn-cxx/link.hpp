@@ -24,6 +24,7 @@
 
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/delegation-list.hpp"
+#include "ndn-cxx/shared-forwarding-hint.hpp"
 
 namespace ndn {
 
@@ -107,12 +108,22 @@ public:
   bool
   removeDelegation(const Name& name);
 
+  /** @brief Get the delegations as a ForwardingHint that can be shared among many Interests
+   *  @return the ForwardingHint, or nullptr if there is no delegation
+   *
+   *  The ForwardingHint is created upon first use and returned again until the delegations
+   *  are modified.
+   */
+  shared_ptr<const SharedForwardingHint>
+  getForwardingHint() const;
+
 private:
   void
   encodeContent();
 
 private:
   DelegationList m_delList;
+  mutable shared_ptr<const SharedForwardingHint> m_forwardingHint;
 };
 
 } // namespace ndn
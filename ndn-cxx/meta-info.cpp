@@ -130,6 +130,10 @@ MetaInfo::wireEncode(EncodingImpl<TAG>& encoder) const
   //                FinalBlockId?
   //                AppMetaInfo*
 
+  if (m_wire.hasWire()) {
+    return encoder.prependBlock(m_wire);
+  }
+
   size_t totalLength = 0;
 
   for (auto it = m_appMetaInfo.rbegin(); it != m_appMetaInfo.rend(); ++it) {
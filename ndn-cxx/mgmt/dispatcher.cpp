@@ -21,8 +21,11 @@
 
 #include "ndn-cxx/mgmt/dispatcher.hpp"
 #include "ndn-cxx/lp/tags.hpp"
+#include "ndn-cxx/detail/thread-pool.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
+#include <boost/asio/io_service.hpp>
+
 NDN_LOG_INIT(ndn.mgmt.Dispatcher);
 
 namespace ndn {
@@ -77,10 +80,13 @@ Dispatcher::addTopPrefix(const Name& prefix, bool wantRegister,
       signingInfo);
   }
 
-  for (const auto& entry : m_handlers) {
-    Name fullPrefix = Name(prefix).append(entry.first);
-    auto filterHdl = m_face.setInterestFilter(fullPrefix, bind(entry.second, prefix, _2));
-    topPrefixEntry.interestFilters.push_back(filterHdl);
+  // a single InterestFilter covers all handlers; the relative prefix is resolved by walking
+  // m_handlers over the remaining name components
+  if (!m_handlers.empty()) {
+    topPrefixEntry.interestFilter = m_face.setInterestFilter(prefix,
+      [this, prefix] (const InterestFilter&, const Interest& interest) {
+        processInterest(prefix, interest);
+      });
   }
 }
 
@@ -93,18 +99,17 @@ Dispatcher::removeTopPrefix(const Name& prefix)
 bool
 Dispatcher::isOverlappedWithOthers(const PartialName& relPrefix) const
 {
-  bool hasOverlapWithHandlers =
-    std::any_of(m_handlers.begin(), m_handlers.end(),
-                [&] (const auto& entry) {
-                  return entry.first.isPrefixOf(relPrefix) || relPrefix.isPrefixOf(entry.first);
-                });
-  bool hasOverlapWithStreams =
-    std::any_of(m_streams.begin(), m_streams.end(),
-                [&] (const auto& entry) {
-                  return entry.first.isPrefixOf(relPrefix) || relPrefix.isPrefixOf(entry.first);
-                });
-
-  return hasOverlapWithHandlers || hasOverlapWithStreams;
+  // notification streams have their handlers in m_handlers as well
+  return m_handlers.hasOverlap(relPrefix);
+}
+
+void
+Dispatcher::processInterest(const Name& prefix, const Interest& interest)
+{
+  const InterestHandler* handler = m_handlers.findLongestPrefix(interest.getName(), prefix.size());
+  if (handler != nullptr) {
+    (*handler)(prefix, interest);
+  }
 }
 
 void
@@ -184,11 +189,143 @@ Dispatcher::processControlCommandInterest(const Name& prefix,
     return;
   }
 
+  if (m_authorizationPool != nullptr) {
+    authorizeInOrder(prefix, interest, parameters, authorization, accepted, rejected);
+    return;
+  }
+
   AcceptContinuation accept = [=] (const auto& req) { accepted(req, prefix, interest, parameters); };
   RejectContinuation reject = [=] (RejectReply reply) { rejected(reply, interest); };
   authorization(prefix, interest, parameters.get(), accept, reject);
 }
 
+void
+Dispatcher::setAuthorizationThreads(size_t nThreads, size_t maxPending)
+{
+  if (nThreads > 0 && maxPending == 0) {
+    NDN_THROW(std::invalid_argument("maxPending must be positive"));
+  }
+
+  // waits for running verifications; their outcomes are still delivered on the Face thread
+  m_authorizationPool.reset();
+  if (nThreads > 0) {
+    m_authorizationPool = make_unique<detail::ThreadPool>(nThreads, maxPending);
+  }
+  m_maxPendingCommands = maxPending;
+}
+
+security::Validator::VerificationExecutor
+Dispatcher::getVerificationExecutor()
+{
+  return [this] (std::function<bool()> verify, std::function<void(bool)> done) {
+    if (m_authorizationPool != nullptr) {
+      boost::asio::io_service& io = m_face.getIoService();
+      bool isPosted = m_authorizationPool->tryPost([&io, verify, done] {
+        bool isVerified = verify();
+        io.post([done, isVerified] { done(isVerified); });
+      });
+      if (isPosted) {
+        return;
+      }
+    }
+    done(verify());
+  };
+}
+
+static Name
+getRequesterKey(const Interest& interest)
+{
+  try {
+    auto sigInfo = interest.getSignatureInfo();
+    const Name& name = interest.getName();
+    if (!sigInfo && name.size() >= signed_interest::MIN_SIZE) {
+      sigInfo.emplace(name[signed_interest::POS_SIG_INFO].blockFromValue());
+    }
+    if (sigInfo && sigInfo->hasKeyLocator() && sigInfo->getKeyLocator().getType() == tlv::Name) {
+      return sigInfo->getKeyLocator().getName();
+    }
+  }
+  catch (const tlv::Error&) {
+  }
+  // unsigned or malformed commands share a single queue
+  return Name();
+}
+
+void
+Dispatcher::authorizeInOrder(const Name& prefix,
+                             const Interest& interest,
+                             const shared_ptr<ControlParameters>& parameters,
+                             const Authorization& authorization,
+                             const AuthorizationAcceptedCallback& accepted,
+                             const AuthorizationRejectedCallback& rejected)
+{
+  if (m_nPendingCommands >= m_maxPendingCommands) {
+    NDN_LOG_DEBUG("authorization queue is full, dropping " << interest.getName());
+    try {
+      m_face.put(lp::Nack(interest).setReason(lp::NackReason::CONGESTION));
+    }
+    catch (const Face::Error& e) {
+      NDN_LOG_ERROR("authorizeInOrder: " << e.what());
+    }
+    return;
+  }
+
+  Name requesterKey = getRequesterKey(interest);
+  auto& queue = m_pendingCommands[requesterKey];
+  auto command = make_shared<PendingCommand>();
+  queue.push_back(command);
+  ++m_nPendingCommands;
+
+  auto interestCopy = make_shared<Interest>(interest);
+  weak_ptr<int> guard = m_lifetimeGuard;
+  boost::asio::io_service& io = m_face.getIoService();
+
+  // invoked on any thread; the reply is always processed on the Face thread
+  auto complete = [this, guard, &io, command, requesterKey] (std::function<void()> reply) {
+    io.post([this, guard, command, requesterKey, reply = std::move(reply)] {
+      if (guard.expired() || command->isAuthorized) {
+        return;
+      }
+      command->isAuthorized = true;
+      command->reply = reply;
+      processPendingCommands(requesterKey);
+    });
+  };
+
+  AcceptContinuation accept = [=] (const std::string& requester) {
+    complete([=] { accepted(requester, prefix, *interestCopy, parameters); });
+  };
+  RejectContinuation reject = [=] (RejectReply reply) {
+    complete([=] { rejected(reply, *interestCopy); });
+  };
+  authorization(prefix, *interestCopy, parameters.get(), accept, reject);
+}
+
+void
+Dispatcher::processPendingCommands(const Name& requesterKey)
+{
+  auto it = m_pendingCommands.find(requesterKey);
+  if (it == m_pendingCommands.end()) {
+    return;
+  }
+
+  std::vector<std::function<void()>> replies;
+  auto& queue = it->second;
+  while (!queue.empty() && queue.front()->isAuthorized) {
+    replies.push_back(std::move(queue.front()->reply));
+    queue.pop_front();
+  }
+  if (queue.empty()) {
+    m_pendingCommands.erase(it);
+  }
+  m_nPendingCommands -= replies.size();
+
+  // replies may re-enter the Dispatcher, so they are invoked after the queue is updated
+  for (const auto& reply : replies) {
+    reply();
+  }
+}
+
 void
 Dispatcher::processAuthorizedControlCommandInterest(const std::string& requester,
                                                     const Name& prefix,
@@ -241,9 +378,9 @@ Dispatcher::addStatusDataset(const PartialName& relPrefix,
   InterestHandler missContinuation = bind(&Dispatcher::processStatusDatasetInterest, this, _1, _2,
                                           std::move(authorize), std::move(accepted), std::move(rejected));
 
-  m_handlers[relPrefix] = [this, miss = std::move(missContinuation)] (auto&&... args) {
+  m_handlers.insert(relPrefix, [this, miss = std::move(missContinuation)] (auto&&... args) {
     this->queryStorage(std::forward<decltype(args)>(args)..., miss);
-  };
+  });
 }
 
 void
@@ -309,9 +446,9 @@ Dispatcher::addNotificationStream(const PartialName& relPrefix)
 
   // register a handler for the subscriber of this notification stream
   // keep silent if Interest does not match a stored notification
-  m_handlers[relPrefix] = [this] (auto&&... args) {
+  m_handlers.insert(relPrefix, [this] (auto&&... args) {
     this->queryStorage(std::forward<decltype(args)>(args)..., nullptr);
-  };
+  });
   m_streams[relPrefix] = 0;
 
   return [=] (const Block& b) { postNotification(b, relPrefix); };
@@ -23,16 +23,24 @@
 #define NDN_MGMT_DISPATCHER_HPP
 
 #include "ndn-cxx/face.hpp"
+#include "ndn-cxx/detail/component-trie.hpp"
 #include "ndn-cxx/encoding/block.hpp"
 #include "ndn-cxx/ims/in-memory-storage-fifo.hpp"
 #include "ndn-cxx/mgmt/control-response.hpp"
 #include "ndn-cxx/mgmt/control-parameters.hpp"
 #include "ndn-cxx/mgmt/status-dataset-context.hpp"
 #include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/validator.hpp"
 
+#include <deque>
 #include <unordered_map>
 
 namespace ndn {
+
+namespace detail {
+class ThreadPool;
+} // namespace detail
+
 namespace mgmt {
 
 // ---- AUTHORIZATION ----
@@ -155,12 +163,12 @@ public:
    *  2. if \p wantRegister is true, invoke Face::registerPrefix for the top-level prefix;
    *     the returned RegisteredPrefixHandle shall be recorded internally, indexed by the top-level
    *     prefix.
-   *  3. for each `relPrefix` from ControlCommands and StatusDatasets,
-   *     join the top-level prefix with `relPrefix` to obtain the full prefix,
-   *     and invoke non-registering overload of Face::setInterestFilter,
-   *     with the InterestHandler set to an appropriate private method to handle incoming Interests
-   *     for the ControlCommand or StatusDataset; the returned InterestFilterHandle shall be
-   *     recorded internally, indexed by the top-level prefix.
+   *  3. if any ControlCommand, StatusDataset, or NotificationStream has been added, invoke
+   *     non-registering overload of Face::setInterestFilter for the top-level prefix, with the
+   *     InterestHandler set to a private method that finds the `relPrefix` matching the remaining
+   *     name components of an incoming Interest and dispatches the Interest to its handler;
+   *     the returned InterestFilterHandle shall be recorded internally, indexed by the top-level
+   *     prefix.
    */
   void
   addTopPrefix(const Name& prefix, bool wantRegister = true,
@@ -177,6 +185,39 @@ public:
   void
   removeTopPrefix(const Name& prefix);
 
+  /** \brief verify the signatures of ControlCommands on worker threads
+   *  \param nThreads number of worker threads; zero restores synchronous authorization
+   *  \param maxPending maximum number of ControlCommands that are waiting for authorization,
+   *                    or for an earlier command of the same requester; further commands are
+   *                    answered with a Nack with reason Congestion
+   *  \throw std::invalid_argument \p nThreads is positive and \p maxPending is zero
+   *
+   *  In this mode, the Authorization of a ControlCommand is still invoked on the Face thread,
+   *  but may complete asynchronously: it may pass the signature verification to the worker
+   *  threads through getVerificationExecutor(), typically by installing that executor on its
+   *  security::Validator with Validator::setVerificationExecutor(). The validation policy,
+   *  including the state of ValidationPolicyCommandInterest, stays on the Face thread, while
+   *  only the stateless signature check runs on a worker thread. Commands from the same
+   *  requester, as identified by the KeyLocator of the signed Interest, are processed in the
+   *  order in which they have arrived, while a slow requester does not delay the others.
+   *
+   *  This method blocks until the running and queued verifications of the previous
+   *  configuration have finished.
+   */
+  void
+  setAuthorizationThreads(size_t nThreads, size_t maxPending = 1024);
+
+  /** \brief get an executor that runs signature verification on the authorization threads
+   *
+   *  The executor calls the \p done function of a job on the Face thread. If no authorization
+   *  threads are configured when a job is submitted, or all of them are busy, the job is executed
+   *  synchronously. The executor must not be used after the Dispatcher is destroyed.
+   *
+   *  \sa setAuthorizationThreads
+   */
+  security::Validator::VerificationExecutor
+  getVerificationExecutor();
+
 public: // ControlCommand
   /** \brief register a ControlCommand
    *  \tparam CP subclass of ControlParameters used by this command
@@ -292,6 +333,15 @@ private:
   bool
   isOverlappedWithOthers(const PartialName& relPrefix) const;
 
+  /**
+   * @brief dispatch an Interest under a top-level prefix to the matching handler
+   *
+   * @param prefix the top-level prefix
+   * @param interest the incoming Interest
+   */
+  void
+  processInterest(const Name& prefix, const Interest& interest);
+
   /**
    * @brief process unauthorized request
    * @param act action to reply
@@ -385,6 +435,33 @@ private:
                                           const ValidateParameters& validate,
                                           const ControlCommandHandler& handler);
 
+  /**
+   * @brief invoke the authorization of a control command that may complete asynchronously.
+   *
+   * The outcome is delivered to @p accepted or @p rejected on the Face thread, after the
+   * outcomes of all earlier commands of the same requester.
+   *
+   * @param prefix the top-level prefix
+   * @param interest the incoming Interest
+   * @param parameters control parameters of this command
+   * @param authorization to process validation on this command
+   * @param accepted the callback for successful authorization
+   * @param rejected the callback for failed authorization
+   */
+  void
+  authorizeInOrder(const Name& prefix,
+                   const Interest& interest,
+                   const shared_ptr<ControlParameters>& parameters,
+                   const Authorization& authorization,
+                   const AuthorizationAcceptedCallback& accepted,
+                   const AuthorizationRejectedCallback& rejected);
+
+  /**
+   * @brief process the replies of authorized commands from @p requesterKey, in arrival order
+   */
+  void
+  processPendingCommands(const Name& requesterKey);
+
   void
   sendControlResponse(const ControlResponse& resp, const Interest& interest, bool isNack = false);
 
@@ -437,7 +514,7 @@ private:
   struct TopPrefixEntry
   {
     ScopedRegisteredPrefixHandle registeredPrefix;
-    std::vector<ScopedInterestFilterHandle> interestFilters;
+    ScopedInterestFilterHandle interestFilter;
   };
   std::unordered_map<Name, TopPrefixEntry> m_topLevelPrefixes;
 
@@ -445,11 +522,25 @@ private:
   KeyChain& m_keyChain;
   security::SigningInfo m_signingInfo;
 
-  std::unordered_map<PartialName, InterestHandler> m_handlers;
+  // relative prefix => handler; the relative prefixes do not overlap with each other
+  detail::ComponentTrie<InterestHandler> m_handlers;
 
   // NotificationStream name => next sequence number
   std::unordered_map<Name, uint64_t> m_streams;
 
+  struct PendingCommand
+  {
+    std::function<void()> reply;
+    bool isAuthorized = false;
+  };
+  // requester KeyLocator => commands in arrival order
+  std::unordered_map<Name, std::deque<shared_ptr<PendingCommand>>> m_pendingCommands;
+  size_t m_nPendingCommands = 0;
+  size_t m_maxPendingCommands = 0;
+  shared_ptr<int> m_lifetimeGuard = make_shared<int>(); ///< expires when Dispatcher is destroyed
+  // must be destroyed before the members used by the jobs
+  unique_ptr<detail::ThreadPool> m_authorizationPool;
+
 NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   InMemoryStorageFifo m_storage;
 };
@@ -480,9 +571,9 @@ Dispatcher::addControlCommand(const PartialName& relPrefix,
   AuthorizationRejectedCallback rejected =
     bind(&Dispatcher::afterAuthorizationRejected, this, _1, _2);
 
-  m_handlers[relPrefix] = bind(&Dispatcher::processControlCommandInterest, this,
-                               _1, relPrefix, _2, std::move(parser), std::move(authorize),
-                               std::move(accepted), std::move(rejected));
+  m_handlers.insert(relPrefix, bind(&Dispatcher::processControlCommandInterest, this,
+                                    _1, relPrefix, _2, std::move(parser), std::move(authorize),
+                                    std::move(accepted), std::move(rejected)));
 }
 
 } // namespace mgmt
@@ -22,11 +22,14 @@
 #include "ndn-cxx/mgmt/nfd/channel-status.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
+#include "ndn-cxx/encoding/tlv-schema.hpp"
 #include "ndn-cxx/util/concepts.hpp"
 
 namespace ndn {
 namespace nfd {
 
+namespace schema = tlv::schema;
+
 BOOST_CONCEPT_ASSERT((StatusDatasetItem<ChannelStatus>));
 
 ChannelStatus::ChannelStatus() = default;
@@ -36,15 +39,16 @@ ChannelStatus::ChannelStatus(const Block& payload)
   this->wireDecode(payload);
 }
 
+struct ChannelStatus::Schema : schema::Record<tlv::nfd::ChannelStatus,
+  schema::Required<tlv::nfd::LocalUri, NDN_CXX_TLV_SCHEMA_MEMBER(ChannelStatus::m_localUri)>>
+{
+};
+
 template<encoding::Tag TAG>
 size_t
 ChannelStatus::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-  totalLength += prependStringBlock(encoder, tlv::nfd::LocalUri, m_localUri);
-  totalLength += encoder.prependVarNumber(totalLength);
-  totalLength += encoder.prependVarNumber(tlv::nfd::ChannelStatus);
-  return totalLength;
+  return Schema::encode(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(ChannelStatus);
@@ -68,21 +72,8 @@ ChannelStatus::wireEncode() const
 void
 ChannelStatus::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::ChannelStatus) {
-    NDN_THROW(Error("ChannelStatus", block.type()));
-  }
-
+  Schema::decode(*this, block);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::LocalUri) {
-    m_localUri = readString(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("Missing required LocalUri field"));
-  }
 }
 
 ChannelStatus&
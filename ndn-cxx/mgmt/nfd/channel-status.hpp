@@ -67,6 +67,8 @@ public: // getters & setters
   setLocalUri(const std::string localUri);
 
 private:
+  struct Schema;
+
   std::string m_localUri;
 
   mutable Block m_wire;
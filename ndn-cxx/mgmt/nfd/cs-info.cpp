@@ -23,11 +23,14 @@
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
+#include "ndn-cxx/encoding/tlv-schema.hpp"
 #include "ndn-cxx/util/concepts.hpp"
 
 namespace ndn {
 namespace nfd {
 
+namespace schema = tlv::schema;
+
 BOOST_CONCEPT_ASSERT((StatusDatasetItem<CsInfo>));
 
 CsInfo::CsInfo()
@@ -43,21 +46,20 @@ CsInfo::CsInfo(const Block& block)
   this->wireDecode(block);
 }
 
+struct CsInfo::Schema : schema::Record<tlv::nfd::CsInfo,
+  schema::Required<tlv::nfd::Capacity, NDN_CXX_TLV_SCHEMA_MEMBER(CsInfo::m_capacity)>,
+  schema::Required<tlv::nfd::Flags, NDN_CXX_TLV_SCHEMA_MEMBER(CsInfo::m_flags)>,
+  schema::Required<tlv::nfd::NCsEntries, NDN_CXX_TLV_SCHEMA_MEMBER(CsInfo::m_nEntries)>,
+  schema::Required<tlv::nfd::NHits, NDN_CXX_TLV_SCHEMA_MEMBER(CsInfo::m_nHits)>,
+  schema::Required<tlv::nfd::NMisses, NDN_CXX_TLV_SCHEMA_MEMBER(CsInfo::m_nMisses)>>
+{
+};
+
 template<encoding::Tag TAG>
 size_t
 CsInfo::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NMisses, m_nMisses);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NHits, m_nHits);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NCsEntries, m_nEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::Flags, m_flags.to_ullong());
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::Capacity, m_capacity);
-
-  totalLength += encoder.prependVarNumber(totalLength);
-  totalLength += encoder.prependVarNumber(tlv::nfd::CsInfo);
-  return totalLength;
+  return Schema::encode(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(CsInfo);
@@ -81,52 +83,8 @@ CsInfo::wireEncode() const
 void
 CsInfo::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::CsInfo) {
-    NDN_THROW(Error("CsInfo", block.type()));
-  }
+  Schema::decode(*this, block);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Capacity) {
-    m_capacity = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Capacity field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Flags) {
-    m_flags = FlagsBitSet(static_cast<unsigned long long>(readNonNegativeInteger(*val)));
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Flags field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NCsEntries) {
-    m_nEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NCsEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NHits) {
-    m_nHits = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NHits field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NMisses) {
-    m_nMisses = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NMisses field"));
-  }
 }
 
 CsInfo&
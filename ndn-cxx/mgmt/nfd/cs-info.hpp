@@ -125,6 +125,8 @@ public:
   setNMisses(uint64_t nMisses);
 
 private:
+  struct Schema;
+
   using FlagsBitSet = std::bitset<2>;
 
   uint64_t m_capacity;
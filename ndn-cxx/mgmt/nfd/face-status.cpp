@@ -23,12 +23,15 @@
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
+#include "ndn-cxx/encoding/tlv-schema.hpp"
 #include "ndn-cxx/util/concepts.hpp"
 #include "ndn-cxx/util/string-helper.hpp"
 
 namespace ndn {
 namespace nfd {
 
+namespace schema = tlv::schema;
+
 BOOST_CONCEPT_ASSERT((StatusDatasetItem<FaceStatus>));
 
 FaceStatus::FaceStatus()
@@ -48,46 +51,38 @@ FaceStatus::FaceStatus(const Block& block)
   this->wireDecode(block);
 }
 
+struct FaceStatus::Schema : schema::Record<tlv::nfd::FaceStatus,
+  schema::Required<tlv::nfd::FaceId, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_faceId)>,
+  schema::Required<tlv::nfd::Uri, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_remoteUri)>,
+  schema::Required<tlv::nfd::LocalUri, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_localUri)>,
+  schema::Optional<tlv::nfd::ExpirationPeriod,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_expirationPeriod)>,
+  schema::Required<tlv::nfd::FaceScope, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_faceScope)>,
+  schema::Required<tlv::nfd::FacePersistency,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_facePersistency)>,
+  schema::Required<tlv::nfd::LinkType, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_linkType)>,
+  schema::Optional<tlv::nfd::BaseCongestionMarkingInterval,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_baseCongestionMarkingInterval)>,
+  schema::Optional<tlv::nfd::DefaultCongestionThreshold,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_defaultCongestionThreshold)>,
+  schema::Optional<tlv::nfd::Mtu, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_mtu)>,
+  schema::Required<tlv::nfd::NInInterests, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_nInInterests)>,
+  schema::Required<tlv::nfd::NInData, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_nInData)>,
+  schema::Required<tlv::nfd::NInNacks, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_nInNacks)>,
+  schema::Required<tlv::nfd::NOutInterests, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_nOutInterests)>,
+  schema::Required<tlv::nfd::NOutData, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_nOutData)>,
+  schema::Required<tlv::nfd::NOutNacks, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_nOutNacks)>,
+  schema::Required<tlv::nfd::NInBytes, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_nInBytes)>,
+  schema::Required<tlv::nfd::NOutBytes, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_nOutBytes)>,
+  schema::Required<tlv::nfd::Flags, NDN_CXX_TLV_SCHEMA_MEMBER(FaceStatus::m_flags)>>
+{
+};
+
 template<encoding::Tag TAG>
 size_t
 FaceStatus::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::Flags, m_flags);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutBytes, m_nOutBytes);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInBytes, m_nInBytes);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutNacks, m_nOutNacks);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutData, m_nOutData);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutInterests, m_nOutInterests);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInNacks, m_nInNacks);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInData, m_nInData);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInInterests, m_nInInterests);
-  if (m_mtu) {
-    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::Mtu, *m_mtu);
-  }
-  if (m_defaultCongestionThreshold) {
-    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::DefaultCongestionThreshold,
-                                                  *m_defaultCongestionThreshold);
-  }
-  if (m_baseCongestionMarkingInterval) {
-    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::BaseCongestionMarkingInterval,
-                                                  m_baseCongestionMarkingInterval->count());
-  }
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::LinkType, m_linkType);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::FacePersistency, m_facePersistency);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::FaceScope, m_faceScope);
-  if (m_expirationPeriod) {
-    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::ExpirationPeriod,
-                                                  m_expirationPeriod->count());
-  }
-  totalLength += prependStringBlock(encoder, tlv::nfd::LocalUri, m_localUri);
-  totalLength += prependStringBlock(encoder, tlv::nfd::Uri, m_remoteUri);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::FaceId, m_faceId);
-
-  totalLength += encoder.prependVarNumber(totalLength);
-  totalLength += encoder.prependVarNumber(tlv::nfd::FaceStatus);
-  return totalLength;
+  return Schema::encode(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(FaceStatus);
@@ -111,165 +106,8 @@ FaceStatus::wireEncode() const
 void
 FaceStatus::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::FaceStatus) {
-    NDN_THROW(Error("FaceStatus", block.type()));
-  }
-
+  Schema::decode(*this, block);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FaceId) {
-    m_faceId = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FaceId field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Uri) {
-    m_remoteUri = readString(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Uri field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::LocalUri) {
-    m_localUri = readString(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required LocalUri field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::ExpirationPeriod) {
-    m_expirationPeriod.emplace(readNonNegativeInteger(*val));
-    ++val;
-  }
-  else {
-    m_expirationPeriod = nullopt;
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FaceScope) {
-    m_faceScope = readNonNegativeIntegerAs<FaceScope>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FaceScope field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FacePersistency) {
-    m_facePersistency = readNonNegativeIntegerAs<FacePersistency>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FacePersistency field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::LinkType) {
-    m_linkType = readNonNegativeIntegerAs<LinkType>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required LinkType field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::BaseCongestionMarkingInterval) {
-    m_baseCongestionMarkingInterval.emplace(readNonNegativeInteger(*val));
-    ++val;
-  }
-  else {
-    m_baseCongestionMarkingInterval = nullopt;
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::DefaultCongestionThreshold) {
-    m_defaultCongestionThreshold = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    m_defaultCongestionThreshold = nullopt;
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Mtu) {
-    m_mtu = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    m_mtu = nullopt;
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInInterests) {
-    m_nInInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInInterests field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInData) {
-    m_nInData = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInData field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInNacks) {
-    m_nInNacks = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInNacks field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutInterests) {
-    m_nOutInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutInterests field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutData) {
-    m_nOutData = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutData field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutNacks) {
-    m_nOutNacks = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutNacks field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInBytes) {
-    m_nInBytes = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInBytes field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutBytes) {
-    m_nOutBytes = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutBytes field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Flags) {
-    m_flags = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Flags field"));
-  }
 }
 
 FaceStatus&
@@ -23,14 +23,15 @@
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
+#include "ndn-cxx/encoding/tlv-schema.hpp"
 #include "ndn-cxx/util/concepts.hpp"
 #include "ndn-cxx/util/ostream-joiner.hpp"
 
-#include <boost/range/adaptor/reversed.hpp>
-
 namespace ndn {
 namespace nfd {
 
+namespace schema = tlv::schema;
+
 BOOST_CONCEPT_ASSERT((StatusDatasetItem<NextHopRecord>));
 BOOST_CONCEPT_ASSERT((StatusDatasetItem<FibEntry>));
 
@@ -61,18 +62,17 @@ NextHopRecord::setCost(uint64_t cost)
   return *this;
 }
 
+struct NextHopRecord::Schema : schema::Record<tlv::nfd::NextHopRecord,
+  schema::Required<tlv::nfd::FaceId, NDN_CXX_TLV_SCHEMA_MEMBER(NextHopRecord::m_faceId)>,
+  schema::Required<tlv::nfd::Cost, NDN_CXX_TLV_SCHEMA_MEMBER(NextHopRecord::m_cost)>>
+{
+};
+
 template<encoding::Tag TAG>
 size_t
-NextHopRecord::wireEncode(EncodingImpl<TAG>& block) const
+NextHopRecord::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::Cost, m_cost);
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::FaceId, m_faceId);
-
-  totalLength += block.prependVarNumber(totalLength);
-  totalLength += block.prependVarNumber(ndn::tlv::nfd::NextHopRecord);
-  return totalLength;
+  return Schema::encode(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(NextHopRecord);
@@ -96,31 +96,8 @@ NextHopRecord::wireEncode() const
 void
 NextHopRecord::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::NextHopRecord) {
-    NDN_THROW(Error("NextHopRecord", block.type()));
-  }
-
+  Schema::decode(*this, block);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val == m_wire.elements_end()) {
-    NDN_THROW(Error("unexpected end of NextHopRecord"));
-  }
-  else if (val->type() != tlv::nfd::FaceId) {
-    NDN_THROW(Error("FaceId", val->type()));
-  }
-  m_faceId = readNonNegativeInteger(*val);
-  ++val;
-
-  if (val == m_wire.elements_end()) {
-    NDN_THROW(Error("unexpected end of NextHopRecord"));
-  }
-  else if (val->type() != tlv::nfd::Cost) {
-    NDN_THROW(Error("Cost", val->type()));
-  }
-  m_cost = readNonNegativeInteger(*val);
-  ++val;
 }
 
 bool
@@ -172,20 +149,17 @@ FibEntry::clearNextHopRecords()
   return *this;
 }
 
+struct FibEntry::Schema : schema::Record<tlv::nfd::FibEntry,
+  schema::Required<tlv::Name, NDN_CXX_TLV_SCHEMA_MEMBER(FibEntry::m_prefix)>,
+  schema::Repeated<tlv::nfd::NextHopRecord, NDN_CXX_TLV_SCHEMA_MEMBER(FibEntry::m_nextHopRecords)>>
+{
+};
+
 template<encoding::Tag TAG>
 size_t
-FibEntry::wireEncode(EncodingImpl<TAG>& block) const
+FibEntry::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  for (const auto& nh : m_nextHopRecords | boost::adaptors::reversed) {
-    totalLength += nh.wireEncode(block);
-  }
-  totalLength += m_prefix.wireEncode(block);
-
-  totalLength += block.prependVarNumber(totalLength);
-  totalLength += block.prependVarNumber(tlv::nfd::FibEntry);
-  return totalLength;
+  return Schema::encode(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(FibEntry);
@@ -209,30 +183,8 @@ FibEntry::wireEncode() const
 void
 FibEntry::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::FibEntry) {
-    NDN_THROW(Error("FibEntry", block.type()));
-  }
-
+  Schema::decode(*this, block);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val == m_wire.elements_end()) {
-    NDN_THROW(Error("unexpected end of FibEntry"));
-  }
-  else if (val->type() != tlv::Name) {
-    NDN_THROW(Error("Name", val->type()));
-  }
-  m_prefix.wireDecode(*val);
-  ++val;
-
-  m_nextHopRecords.clear();
-  for (; val != m_wire.elements_end(); ++val) {
-    if (val->type() != tlv::nfd::NextHopRecord) {
-      NDN_THROW(Error("NextHopRecord", val->type()));
-    }
-    m_nextHopRecords.emplace_back(*val);
-  }
 }
 
 bool
@@ -23,11 +23,14 @@
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
+#include "ndn-cxx/encoding/tlv-schema.hpp"
 #include "ndn-cxx/util/concepts.hpp"
 
 namespace ndn {
 namespace nfd {
 
+namespace schema = tlv::schema;
+
 BOOST_CONCEPT_ASSERT((StatusDatasetItem<ForwarderStatus>));
 
 ForwarderStatus::ForwarderStatus()
@@ -52,34 +55,41 @@ ForwarderStatus::ForwarderStatus(const Block& payload)
   this->wireDecode(payload);
 }
 
+struct ForwarderStatus::Schema : schema::Record<tlv::Content,
+  schema::Required<tlv::nfd::NfdVersion, NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nfdVersion)>,
+  schema::Required<tlv::nfd::StartTimestamp,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_startTimestamp)>,
+  schema::Required<tlv::nfd::CurrentTimestamp,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_currentTimestamp)>,
+  schema::Required<tlv::nfd::NNameTreeEntries,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nNameTreeEntries)>,
+  schema::Required<tlv::nfd::NFibEntries,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nFibEntries)>,
+  schema::Required<tlv::nfd::NPitEntries,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nPitEntries)>,
+  schema::Required<tlv::nfd::NMeasurementsEntries,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nMeasurementsEntries)>,
+  schema::Required<tlv::nfd::NCsEntries, NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nCsEntries)>,
+  schema::Required<tlv::nfd::NInInterests,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nInInterests)>,
+  schema::Required<tlv::nfd::NInData, NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nInData)>,
+  schema::Required<tlv::nfd::NInNacks, NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nInNacks)>,
+  schema::Required<tlv::nfd::NOutInterests,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nOutInterests)>,
+  schema::Required<tlv::nfd::NOutData, NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nOutData)>,
+  schema::Required<tlv::nfd::NOutNacks, NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nOutNacks)>,
+  schema::Required<tlv::nfd::NSatisfiedInterests,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nSatisfiedInterests)>,
+  schema::Required<tlv::nfd::NUnsatisfiedInterests,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(ForwarderStatus::m_nUnsatisfiedInterests)>>
+{
+};
+
 template<encoding::Tag TAG>
 size_t
 ForwarderStatus::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NUnsatisfiedInterests, m_nUnsatisfiedInterests);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NSatisfiedInterests, m_nSatisfiedInterests);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutNacks, m_nOutNacks);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutData, m_nOutData);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutInterests, m_nOutInterests);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInNacks, m_nInNacks);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInData, m_nInData);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInInterests, m_nInInterests);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NCsEntries, m_nCsEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NMeasurementsEntries, m_nMeasurementsEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NPitEntries, m_nPitEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NFibEntries, m_nFibEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NNameTreeEntries, m_nNameTreeEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::CurrentTimestamp,
-                                                time::toUnixTimestamp(m_currentTimestamp).count());
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::StartTimestamp,
-                                                time::toUnixTimestamp(m_startTimestamp).count());
-  totalLength += prependStringBlock(encoder, tlv::nfd::NfdVersion, m_nfdVersion);
-
-  totalLength += encoder.prependVarNumber(totalLength);
-  totalLength += encoder.prependVarNumber(tlv::Content);
-  return totalLength;
+  return Schema::encode(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(ForwarderStatus);
@@ -103,141 +113,8 @@ ForwarderStatus::wireEncode() const
 void
 ForwarderStatus::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::Content) {
-    NDN_THROW(Error("Content", block.type()));
-  }
-
+  Schema::decode(*this, block);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NfdVersion) {
-    m_nfdVersion = readString(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NfdVersion field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::StartTimestamp) {
-    m_startTimestamp = time::fromUnixTimestamp(time::milliseconds(readNonNegativeInteger(*val)));
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required StartTimestamp field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::CurrentTimestamp) {
-    m_currentTimestamp = time::fromUnixTimestamp(time::milliseconds(readNonNegativeInteger(*val)));
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required CurrentTimestamp field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NNameTreeEntries) {
-    m_nNameTreeEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NNameTreeEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NFibEntries) {
-    m_nFibEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NFibEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NPitEntries) {
-    m_nPitEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NPitEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NMeasurementsEntries) {
-    m_nMeasurementsEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NMeasurementsEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NCsEntries) {
-    m_nCsEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NCsEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInInterests) {
-    m_nInInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInInterests field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInData) {
-    m_nInData = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInData field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInNacks) {
-    m_nInNacks = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInNacks field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutInterests) {
-    m_nOutInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutInterests field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutData) {
-    m_nOutData = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutData field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutNacks) {
-    m_nOutNacks = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutNacks field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NSatisfiedInterests) {
-    m_nSatisfiedInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NSatisfiedInterests field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NUnsatisfiedInterests) {
-    m_nUnsatisfiedInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NUnsatisfiedInterests field"));
-  }
 }
 
 ForwarderStatus&
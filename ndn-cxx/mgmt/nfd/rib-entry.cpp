@@ -23,15 +23,16 @@
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
+#include "ndn-cxx/encoding/tlv-schema.hpp"
 #include "ndn-cxx/util/concepts.hpp"
 #include "ndn-cxx/util/ostream-joiner.hpp"
 #include "ndn-cxx/util/string-helper.hpp"
 
-#include <boost/range/adaptor/reversed.hpp>
-
 namespace ndn {
 namespace nfd {
 
+namespace schema = tlv::schema;
+
 BOOST_CONCEPT_ASSERT((StatusDatasetItem<Route>));
 BOOST_CONCEPT_ASSERT((StatusDatasetItem<RibEntry>));
 
@@ -99,24 +100,21 @@ Route::unsetExpirationPeriod()
   return *this;
 }
 
+struct Route::Schema : schema::Record<tlv::nfd::Route,
+  schema::Required<tlv::nfd::FaceId, NDN_CXX_TLV_SCHEMA_MEMBER(Route::m_faceId)>,
+  schema::Required<tlv::nfd::Origin, NDN_CXX_TLV_SCHEMA_MEMBER(Route::m_origin)>,
+  schema::Required<tlv::nfd::Cost, NDN_CXX_TLV_SCHEMA_MEMBER(Route::m_cost)>,
+  schema::Required<tlv::nfd::Flags, NDN_CXX_TLV_SCHEMA_MEMBER(Route::m_flags)>,
+  schema::Optional<tlv::nfd::ExpirationPeriod,
+                   NDN_CXX_TLV_SCHEMA_MEMBER(Route::m_expirationPeriod)>>
+{
+};
+
 template<encoding::Tag TAG>
 size_t
-Route::wireEncode(EncodingImpl<TAG>& block) const
+Route::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  if (m_expirationPeriod) {
-    totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::ExpirationPeriod,
-                                                  static_cast<uint64_t>(m_expirationPeriod->count()));
-  }
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::Flags, m_flags);
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::Cost, m_cost);
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::Origin, m_origin);
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::FaceId, m_faceId);
-
-  totalLength += block.prependVarNumber(totalLength);
-  totalLength += block.prependVarNumber(ndn::tlv::nfd::Route);
-  return totalLength;
+  return Schema::encode(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(Route);
@@ -140,53 +138,8 @@ Route::wireEncode() const
 void
 Route::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::Route) {
-    NDN_THROW(Error("Route", block.type()));
-  }
-
+  Schema::decode(*this, block);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FaceId) {
-    m_faceId = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FaceId field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Origin) {
-    m_origin = readNonNegativeIntegerAs<RouteOrigin>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Origin field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Cost) {
-    m_cost = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Cost field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Flags) {
-    m_flags = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Flags field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::ExpirationPeriod) {
-    m_expirationPeriod.emplace(readNonNegativeInteger(*val));
-    ++val;
-  }
-  else {
-    m_expirationPeriod = nullopt;
-  }
 }
 
 bool
@@ -251,20 +204,17 @@ RibEntry::clearRoutes()
   return *this;
 }
 
+struct RibEntry::Schema : schema::Record<tlv::nfd::RibEntry,
+  schema::Required<tlv::Name, NDN_CXX_TLV_SCHEMA_MEMBER(RibEntry::m_prefix)>,
+  schema::Repeated<tlv::nfd::Route, NDN_CXX_TLV_SCHEMA_MEMBER(RibEntry::m_routes)>>
+{
+};
+
 template<encoding::Tag TAG>
 size_t
-RibEntry::wireEncode(EncodingImpl<TAG>& block) const
+RibEntry::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  for (const auto& route : m_routes | boost::adaptors::reversed) {
-    totalLength += route.wireEncode(block);
-  }
-  totalLength += m_prefix.wireEncode(block);
-
-  totalLength += block.prependVarNumber(totalLength);
-  totalLength += block.prependVarNumber(tlv::nfd::RibEntry);
-  return totalLength;
+  return Schema::encode(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(RibEntry);
@@ -288,30 +238,8 @@ RibEntry::wireEncode() const
 void
 RibEntry::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::RibEntry) {
-    NDN_THROW(Error("RibEntry", block.type()));
-  }
-
+  Schema::decode(*this, block);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val == m_wire.elements_end()) {
-    NDN_THROW(Error("unexpected end of RibEntry"));
-  }
-  else if (val->type() != tlv::Name) {
-    NDN_THROW(Error("Name", val->type()));
-  }
-  m_prefix.wireDecode(*val);
-  ++val;
-
-  m_routes.clear();
-  for (; val != m_wire.elements_end(); ++val) {
-    if (val->type() != tlv::nfd::Route) {
-      NDN_THROW(Error("Route", val->type()));
-    }
-    m_routes.emplace_back(*val);
-  }
 }
 
 bool
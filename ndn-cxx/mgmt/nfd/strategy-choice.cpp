@@ -23,11 +23,14 @@
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
+#include "ndn-cxx/encoding/tlv-schema.hpp"
 #include "ndn-cxx/util/concepts.hpp"
 
 namespace ndn {
 namespace nfd {
 
+namespace schema = tlv::schema;
+
 BOOST_CONCEPT_ASSERT((StatusDatasetItem<StrategyChoice>));
 
 StrategyChoice::StrategyChoice() = default;
@@ -37,18 +40,18 @@ StrategyChoice::StrategyChoice(const Block& payload)
   this->wireDecode(payload);
 }
 
+struct StrategyChoice::Schema : schema::Record<tlv::nfd::StrategyChoice,
+  schema::Required<tlv::Name, NDN_CXX_TLV_SCHEMA_MEMBER(StrategyChoice::m_name)>,
+  schema::Required<tlv::nfd::Strategy, NDN_CXX_TLV_SCHEMA_MEMBER(StrategyChoice::m_strategy),
+                   schema::NestedCodec<Name>>>
+{
+};
+
 template<encoding::Tag TAG>
 size_t
 StrategyChoice::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  totalLength += prependNestedBlock(encoder, tlv::nfd::Strategy, m_strategy);
-  totalLength += m_name.wireEncode(encoder);
-
-  totalLength += encoder.prependVarNumber(totalLength);
-  totalLength += encoder.prependVarNumber(tlv::nfd::StrategyChoice);
-  return totalLength;
+  return Schema::encode(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(StrategyChoice);
@@ -72,35 +75,8 @@ StrategyChoice::wireEncode() const
 void
 StrategyChoice::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::StrategyChoice) {
-    NDN_THROW(Error("StrategyChoice", block.type()));
-  }
-
+  Schema::decode(*this, block);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::Name) {
-    m_name.wireDecode(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Name field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Strategy) {
-    val->parse();
-    if (val->elements().empty()) {
-      NDN_THROW(Error("expecting Strategy/Name"));
-    }
-    else {
-      m_strategy.wireDecode(*val->elements_begin());
-    }
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Strategy field"));
-  }
 }
 
 StrategyChoice&
@@ -162,59 +162,107 @@ Component::Component(const std::string& str)
 static Component
 parseUriEscapedValue(uint32_t type, const char* input, size_t len)
 {
-  std::ostringstream oss;
-  unescape(oss, input, len);
-  std::string value = oss.str();
-  if (value.find_first_not_of('.') == std::string::npos) { // all periods
-    if (value.size() < 3) {
+  // unescaping never lengthens the input; short values are decoded on the stack
+  char stackBuf[256];
+  std::unique_ptr<char[]> heapBuf;
+  char* value = stackBuf;
+  if (len > sizeof(stackBuf)) {
+    heapBuf.reset(new char[len]);
+    value = heapBuf.get();
+  }
+  size_t valueSize = unescape(value, input, len);
+
+  if (std::all_of(value, value + valueSize, [] (char c) { return c == '.'; })) {
+    if (valueSize < 3) {
       NDN_THROW(Component::Error("Illegal URI (name component cannot be . or ..)"));
     }
-    return Component(type, reinterpret_cast<const uint8_t*>(value.data()), value.size() - 3);
+    valueSize -= 3;
   }
-  return Component(type, reinterpret_cast<const uint8_t*>(value.data()), value.size());
+  return Component(type, reinterpret_cast<const uint8_t*>(value), valueSize);
+}
+
+/** @brief Parse @p input as a TLV-TYPE number in canonical decimal form.
+ *  @retval 0 @p input is not a valid NameComponent TLV-TYPE
+ */
+static uint32_t
+parseUriTypeNumber(const char* input, size_t len)
+{
+  // rejects leading zeros, as well as values too long to be a NameComponent type
+  if (len == 0 || len > 5 || (input[0] == '0' && len > 1)) {
+    return 0;
+  }
+  uint32_t type = 0;
+  for (size_t i = 0; i < len; ++i) {
+    if (input[i] < '0' || input[i] > '9') {
+      return 0;
+    }
+    type = type * 10 + static_cast<uint32_t>(input[i] - '0');
+  }
+  return type >= tlv::NameComponentMin && type <= tlv::NameComponentMax ? type : 0;
 }
 
 Component
-Component::fromEscapedString(const std::string& input)
+Component::fromEscapedString(const char* input, size_t len)
 {
-  size_t equalPos = input.find('=');
-  if (equalPos == std::string::npos) {
-    return parseUriEscapedValue(tlv::GenericNameComponent, input.data(), input.size());
+  auto equalPos = static_cast<const char*>(std::memchr(input, '=', len));
+  if (equalPos == nullptr) {
+    return parseUriEscapedValue(tlv::GenericNameComponent, input, len);
   }
 
-  auto typePrefix = input.substr(0, equalPos);
-  auto type = std::strtoul(typePrefix.data(), nullptr, 10);
-  if (type >= tlv::NameComponentMin && type <= tlv::NameComponentMax &&
-      to_string(type) == typePrefix) {
-    size_t valuePos = equalPos + 1;
-    return parseUriEscapedValue(static_cast<uint32_t>(type),
-                                input.data() + valuePos, input.size() - valuePos);
+  size_t prefixLen = static_cast<size_t>(equalPos - input);
+  const char* valuePos = equalPos + 1;
+  size_t valueLen = len - prefixLen - 1;
+
+  uint32_t type = parseUriTypeNumber(input, prefixLen);
+  if (type != 0) {
+    return parseUriEscapedValue(type, valuePos, valueLen);
   }
 
-  auto ct = detail::getComponentTypeTable().findByUriPrefix(typePrefix);
+  auto ct = detail::getComponentTypeTable().findByUriPrefix(input, prefixLen);
   if (ct == nullptr) {
-    NDN_THROW(Error("Unknown TLV-TYPE '" + typePrefix + "' in NameComponent URI"));
+    NDN_THROW(Error("Unknown TLV-TYPE '" + std::string(input, prefixLen) + "' in NameComponent URI"));
   }
-  return ct->parseAltUriValue(input.substr(equalPos + 1));
+  return ct->parseAltUriValue(valuePos, valueLen);
+}
+
+size_t
+Component::toUri(char* buf, size_t bufSize, UriFormat format) const
+{
+  detail::UriBuffer out(buf, bufSize);
+  if (wantAltUri(format)) {
+    detail::getComponentTypeTable().get(type()).writeUri(out, *this);
+  }
+  else {
+    detail::ComponentType().writeUri(out, *this);
+  }
+  return out.size();
 }
 
 void
 Component::toUri(std::ostream& os, UriFormat format) const
 {
-  if (wantAltUri(format)) {
-    detail::getComponentTypeTable().get(type()).writeUri(os, *this);
+  char buf[256];
+  size_t size = toUri(buf, sizeof(buf), format);
+  if (size <= sizeof(buf)) {
+    os.write(buf, static_cast<std::streamsize>(size));
   }
   else {
-    detail::ComponentType().writeUri(os, *this);
+    os << toUri(format);
   }
 }
 
 std::string
 Component::toUri(UriFormat format) const
 {
-  std::ostringstream os;
-  toUri(os, format);
-  return os.str();
+  // escaping at most triples the value, plus room for the type prefix
+  std::string result(3 * value_size() + 16, '\0');
+  size_t size = toUri(&result[0], result.size(), format);
+  if (size > result.size()) {
+    result.resize(size);
+    toUri(&result[0], size, format);
+  }
+  result.resize(size);
+  return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
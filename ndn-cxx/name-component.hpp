@@ -246,9 +246,18 @@ public: // encoding and URI
   static Component
   fromEscapedString(const char* input, size_t beginOffset, size_t endOffset)
   {
-    return fromEscapedString(std::string(input + beginOffset, input + endOffset));
+    return fromEscapedString(input + beginOffset, endOffset - beginOffset);
   }
 
+  /**
+   * @brief Decode NameComponent from a URI component.
+   * @param input the URI component, not necessarily null-terminated
+   * @param len length of @p input
+   * @throw Error URI component does not represent a valid NameComponent.
+   */
+  static Component
+  fromEscapedString(const char* input, size_t len);
+
   /**
    * @brief Decode NameComponent from a URI component.
    * @throw Error URI component does not represent a valid NameComponent.
@@ -256,7 +265,7 @@ public: // encoding and URI
   static Component
   fromEscapedString(const char* input)
   {
-    return fromEscapedString(std::string(input));
+    return fromEscapedString(input, std::char_traits<char>::length(input));
   }
 
   /**
@@ -264,7 +273,10 @@ public: // encoding and URI
    * @throw Error URI component does not represent a valid NameComponent.
    */
   static Component
-  fromEscapedString(const std::string& input);
+  fromEscapedString(const std::string& input)
+  {
+    return fromEscapedString(input.data(), input.size());
+  }
 
   /**
    * @brief Write *this to the output stream, escaping characters according to the NDN URI format.
@@ -280,6 +292,17 @@ public: // encoding and URI
   std::string
   toUri(UriFormat format = UriFormat::DEFAULT) const;
 
+  /**
+   * @brief Write the URI representation of *this into a caller-provided buffer.
+   * @param buf output buffer; no null terminator is written
+   * @param bufSize capacity of @p buf
+   * @return size of the complete URI representation; if greater than @p bufSize,
+   *         the output has been truncated to @p bufSize characters
+   * @sa https://named-data.net/doc/NDN-packet-spec/current/name.html#ndn-uri-scheme
+   */
+  size_t
+  toUri(char* buf, size_t bufSize, UriFormat format = UriFormat::DEFAULT) const;
+
 public: // naming conventions
   /**
    * @brief Check if the component is a nonNegativeInteger
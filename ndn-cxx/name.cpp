@@ -28,6 +28,7 @@
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/util/time.hpp"
 
+#include <cstring>
 #include <sstream>
 #include <boost/functional/hash.hpp>
 #include <boost/range/adaptor/reversed.hpp>
@@ -62,60 +63,68 @@ Name::Name(const Block& wire)
   m_wire.parse();
 }
 
-Name::Name(const char* uri)
-  : Name(std::string(uri))
-{
-}
-
-Name::Name(std::string uri)
+/** @brief Parse the NDN URI [@p uri, @p uri + @p len) and append its components to @p result.
+ */
+static void
+parseUri(Name& result, const char* uri, size_t len)
 {
-  if (uri.empty())
-    return;
+  const char* p = uri;
+  const char* end = uri + len;
 
-  size_t iColon = uri.find(':');
-  if (iColon != std::string::npos) {
+  auto colon = static_cast<const char*>(std::memchr(p, ':', len));
+  if (colon != nullptr) {
     // Make sure the colon came before a '/'.
-    size_t iFirstSlash = uri.find('/');
-    if (iFirstSlash == std::string::npos || iColon < iFirstSlash) {
+    auto firstSlash = static_cast<const char*>(std::memchr(p, '/', len));
+    if (firstSlash == nullptr || colon < firstSlash) {
       // Omit the leading protocol such as ndn:
-      uri.erase(0, iColon + 1);
+      p = colon + 1;
     }
   }
 
   // Trim the leading slash and possibly the authority.
-  if (uri[0] == '/') {
-    if (uri.size() >= 2 && uri[1] == '/') {
+  if (p < end && *p == '/') {
+    if (end - p >= 2 && p[1] == '/') {
       // Strip the authority following "//".
-      size_t iAfterAuthority = uri.find('/', 2);
-      if (iAfterAuthority == std::string::npos)
+      auto afterAuthority = static_cast<const char*>(std::memchr(p + 2, '/', end - p - 2));
+      if (afterAuthority == nullptr)
         // Unusual case: there was only an authority.
         return;
-      else {
-        uri.erase(0, iAfterAuthority + 1);
-      }
+      p = afterAuthority + 1;
     }
     else {
-      uri.erase(0, 1);
+      ++p;
     }
   }
 
-  size_t iComponentStart = 0;
-
   // Unescape the components.
-  while (iComponentStart < uri.size()) {
-    size_t iComponentEnd = uri.find("/", iComponentStart);
-    if (iComponentEnd == std::string::npos)
-      iComponentEnd = uri.size();
+  while (p < end) {
+    auto componentEnd = static_cast<const char*>(std::memchr(p, '/', end - p));
+    if (componentEnd == nullptr)
+      componentEnd = end;
 
-    append(Component::fromEscapedString(&uri[0], iComponentStart, iComponentEnd));
-    iComponentStart = iComponentEnd + 1;
+    result.append(name::Component::fromEscapedString(p, static_cast<size_t>(componentEnd - p)));
+    p = componentEnd + 1;
   }
 }
 
+Name::Name(const char* uri)
+{
+  parseUri(*this, uri, std::char_traits<char>::length(uri));
+}
+
+Name::Name(std::string uri)
+{
+  parseUri(*this, uri.data(), uri.size());
+}
+
 template<encoding::Tag TAG>
 size_t
 Name::wireEncode(EncodingImpl<TAG>& encoder) const
 {
+  if (m_wire.hasWire()) {
+    return encoder.prependBlock(m_wire);
+  }
+
   size_t totalLength = 0;
   for (const Component& comp : *this | boost::adaptors::reversed) {
     totalLength += comp.wireEncode(encoder);
@@ -134,11 +143,18 @@ Name::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
+  // the size of every component is known, so the buffer can be sized without an estimator pass
+  size_t valueLength = 0;
+  for (const Component& comp : *this) {
+    valueLength += tlv::sizeOfVarNumber(comp.type()) + tlv::sizeOfVarNumber(comp.value_size()) +
+                   comp.value_size();
+  }
+  size_t totalLength = tlv::sizeOfVarNumber(tlv::Name) + tlv::sizeOfVarNumber(valueLength) +
+                       valueLength;
 
-  EncodingBuffer buffer(estimatedSize, 0);
+  EncodingBuffer buffer(totalLength, 0);
   wireEncode(buffer);
+  BOOST_ASSERT(buffer.size() == totalLength);
 
   m_wire = buffer.block();
   m_wire.parse();
@@ -344,26 +360,57 @@ Name::compare(size_t pos1, size_t count1, const Name& other, size_t pos2, size_t
 
 // ---- URI representation ----
 
-void
-Name::toUri(std::ostream& os, name::UriFormat format) const
+size_t
+Name::toUri(char* buf, size_t bufSize, name::UriFormat format) const
 {
   if (empty()) {
-    os << "/";
-    return;
+    if (bufSize > 0) {
+      buf[0] = '/';
+    }
+    return 1;
   }
 
+  size_t size = 0;
   for (const auto& component : *this) {
-    os << "/";
-    component.toUri(os, format);
+    if (size < bufSize) {
+      buf[size] = '/';
+    }
+    ++size;
+    size_t offset = std::min(size, bufSize);
+    size += component.toUri(buf + offset, bufSize - offset, format);
+  }
+  return size;
+}
+
+void
+Name::toUri(std::ostream& os, name::UriFormat format) const
+{
+  char buf[1024];
+  size_t size = toUri(buf, sizeof(buf), format);
+  if (size <= sizeof(buf)) {
+    os.write(buf, static_cast<std::streamsize>(size));
+  }
+  else {
+    os << toUri(format);
   }
 }
 
 std::string
 Name::toUri(name::UriFormat format) const
 {
-  std::ostringstream os;
-  toUri(os, format);
-  return os.str();
+  // most URIs are not much longer than the TLV encoding of the name
+  size_t estimate = 16;
+  for (const auto& component : *this) {
+    estimate += component.size();
+  }
+  std::string result(estimate, '\0');
+  size_t size = toUri(&result[0], result.size(), format);
+  if (size > result.size()) {
+    result.resize(size);
+    toUri(&result[0], size, format);
+  }
+  result.resize(size);
+  return result;
 }
 
 std::istream&
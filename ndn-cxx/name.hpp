@@ -107,6 +107,16 @@ public: // constructors, encoding, decoding
   std::string
   toUri(name::UriFormat format = name::UriFormat::DEFAULT) const;
 
+  /** @brief Write URI representation of the name into a caller-provided buffer
+   *  @param buf output buffer; no null terminator is written
+   *  @param bufSize capacity of @p buf
+   *  @return size of the complete URI representation; if greater than @p bufSize,
+   *          the output has been truncated to @p bufSize characters
+   *  @sa https://named-data.net/doc/NDN-packet-spec/0.3/name.html#ndn-uri-scheme
+   */
+  size_t
+  toUri(char* buf, size_t bufSize, name::UriFormat format = name::UriFormat::DEFAULT) const;
+
   /** @brief Check if this instance already has wire encoding
    */
   bool
@@ -28,6 +28,10 @@
 #include <boost/asio/post.hpp>
 #endif
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+
 namespace ndn {
 namespace dns {
 
@@ -37,6 +41,8 @@ public:
   typedef boost::asio::ip::udp protocol;
   typedef protocol::resolver::iterator iterator;
   typedef protocol::resolver::query query;
+  /// receives every resolved address, or boost::asio::error::timed_out on timeout
+  typedef function<void(const boost::system::error_code&, std::vector<IpAddress>)> AllCallback;
 
 public:
   Resolver(boost::asio::io_service& ioService,
@@ -63,6 +69,16 @@ public:
     m_resolveTimeout = m_scheduler.schedule(timeout, [=] { onResolveTimeout(self); });
   }
 
+  void
+  asyncResolveAll(const query& q,
+                  const AllCallback& onDone,
+                  time::nanoseconds timeout,
+                  const shared_ptr<Resolver>& self)
+  {
+    m_onDone = onDone;
+    asyncResolve(q, nullptr, nullptr, timeout, self);
+  }
+
   iterator
   syncResolve(const query& q)
   {
@@ -83,10 +99,19 @@ private:
     m_resolver.get_io_service().post([self] {});
 #endif
 
-    if (error) {
-      if (error == boost::asio::error::operation_aborted)
-        return;
+    if (error == boost::asio::error::operation_aborted)
+      return;
+
+    if (m_onDone) {
+      std::vector<IpAddress> addresses;
+      for (it = selectAddress(it); !error && it != iterator(); it = selectAddress(++it)) {
+        addresses.push_back(it->endpoint().address());
+      }
+      m_onDone(error, std::move(addresses));
+      return;
+    }
 
+    if (error) {
       if (m_onError)
         m_onError("Hostname cannot be resolved: " + error.message());
 
@@ -115,7 +140,9 @@ private:
     m_resolver.get_io_service().post([self] {});
 #endif
 
-    if (m_onError)
+    if (m_onDone)
+      m_onDone(boost::asio::error::timed_out, {});
+    else if (m_onError)
       m_onError("Hostname resolution timed out");
   }
 
@@ -136,6 +163,7 @@ private:
   AddressSelector m_addressSelector;
   SuccessCallback m_onSuccess;
   ErrorCallback m_onError;
+  AllCallback m_onDone;
 
   Scheduler m_scheduler;
   scheduler::EventId m_resolveTimeout;
@@ -169,5 +197,215 @@ syncResolve(const std::string& host,
   return it->endpoint().address();
 }
 
+class ResolutionCache::Impl
+{
+public:
+  /// a request waiting for the outcome of a resolution
+  struct Waiter
+  {
+    boost::asio::io_service* ioService;
+    AddressSelector addressSelector;
+    SuccessCallback onSuccess;
+    ErrorCallback onError;
+  };
+
+  /// outcome of a resolution
+  struct Entry
+  {
+    std::vector<IpAddress> addresses;
+    std::string error; ///< non-empty if host cannot be resolved
+    time::steady_clock::TimePoint expiry;
+  };
+
+  Impl(time::nanoseconds positiveTtl, time::nanoseconds negativeTtl, size_t capacity)
+    : m_positiveTtl(positiveTtl)
+    , m_negativeTtl(negativeTtl)
+    , m_capacity(capacity)
+  {
+  }
+
+  /** \return whether a resolution must be started for \p host
+   */
+  bool
+  addWaiter(const std::string& host, Waiter waiter)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(host);
+    if (it != m_entries.end() && it->second.expiry > time::steady_clock::now()) {
+      ++m_nHits;
+      Entry entry = it->second;
+      lock.unlock();
+      deliver(waiter, entry.addresses, entry.error);
+      return false;
+    }
+
+    auto& waiters = m_pending[host];
+    waiters.push_back(std::move(waiter));
+    if (waiters.size() > 1) {
+      // a resolution of the same host is in progress
+      return false;
+    }
+    ++m_nLookups;
+    return true;
+  }
+
+  void
+  onResolved(const std::string& host, const boost::system::error_code& error,
+             std::vector<IpAddress> addresses)
+  {
+    std::vector<Waiter> waiters;
+    std::string reason;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      auto it = m_pending.find(host);
+      BOOST_ASSERT(it != m_pending.end());
+      waiters = std::move(it->second);
+      m_pending.erase(it);
+
+      if (error == boost::asio::error::timed_out) {
+        reason = "Hostname resolution timed out";
+      }
+      else {
+        if (error) {
+          reason = "Hostname cannot be resolved: " + error.message();
+        }
+        auto ttl = error ? m_negativeTtl : m_positiveTtl;
+        insert(host, Entry{addresses, reason, time::steady_clock::now() + ttl});
+      }
+    }
+
+    for (const auto& waiter : waiters) {
+      deliver(waiter, addresses, reason);
+    }
+  }
+
+private:
+  void
+  insert(const std::string& host, Entry entry)
+  {
+    if (m_capacity == 0) {
+      return;
+    }
+
+    if (m_entries.size() >= m_capacity && m_entries.count(host) == 0) {
+      auto now = time::steady_clock::now();
+      for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (it->second.expiry <= now)
+          it = m_entries.erase(it);
+        else
+          ++it;
+      }
+      if (m_entries.size() >= m_capacity) {
+        m_entries.erase(std::min_element(m_entries.begin(), m_entries.end(),
+                                         [] (const auto& a, const auto& b) {
+                                           return a.second.expiry < b.second.expiry;
+                                         }));
+      }
+    }
+
+    m_entries[host] = std::move(entry);
+  }
+
+  static void
+  deliver(const Waiter& waiter, const std::vector<IpAddress>& addresses, const std::string& reason)
+  {
+    auto f = [=] {
+      if (!reason.empty()) {
+        if (waiter.onError)
+          waiter.onError(reason);
+        return;
+      }
+
+      auto it = std::find_if(addresses.begin(), addresses.end(), waiter.addressSelector);
+      if (it != addresses.end()) {
+        if (waiter.onSuccess)
+          waiter.onSuccess(*it);
+      }
+      else if (waiter.onError) {
+        waiter.onError("No endpoints match the specified address selector");
+      }
+    };
+
+#if BOOST_VERSION >= 106600
+    boost::asio::post(*waiter.ioService, std::move(f));
+#else
+    waiter.ioService->post(std::move(f));
+#endif
+  }
+
+public:
+  const time::nanoseconds m_positiveTtl;
+  const time::nanoseconds m_negativeTtl;
+  const size_t m_capacity;
+
+  mutable std::mutex m_mutex;
+  std::map<std::string, Entry> m_entries;
+  std::map<std::string, std::vector<Waiter>> m_pending;
+  uint64_t m_nHits = 0;
+  uint64_t m_nLookups = 0;
+};
+
+ResolutionCache::ResolutionCache(time::nanoseconds positiveTtl,
+                                 time::nanoseconds negativeTtl,
+                                 size_t capacity)
+  : m_impl(std::make_shared<Impl>(positiveTtl, negativeTtl, capacity))
+{
+}
+
+ResolutionCache::~ResolutionCache() = default;
+
+void
+ResolutionCache::asyncResolve(const std::string& host,
+                              const SuccessCallback& onSuccess,
+                              const ErrorCallback& onError,
+                              boost::asio::io_service& ioService,
+                              const AddressSelector& addressSelector,
+                              time::nanoseconds timeout)
+{
+  BOOST_ASSERT(addressSelector != nullptr);
+  if (!m_impl->addWaiter(host, {&ioService, addressSelector, onSuccess, onError})) {
+    return;
+  }
+
+  auto resolver = make_shared<Resolver>(ref(ioService), AnyAddress());
+  // the callback holds a reference to Impl, so that the cache may be destroyed at any time
+  resolver->asyncResolveAll(Resolver::query(host, ""),
+                            [impl = m_impl, host] (const boost::system::error_code& error,
+                                                   std::vector<IpAddress> addresses) {
+                              impl->onResolved(host, error, std::move(addresses));
+                            },
+                            timeout, resolver);
+}
+
+size_t
+ResolutionCache::size() const
+{
+  std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+  return m_impl->m_entries.size();
+}
+
+void
+ResolutionCache::clear()
+{
+  std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+  m_impl->m_entries.clear();
+}
+
+uint64_t
+ResolutionCache::getNHits() const
+{
+  std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+  return m_impl->m_nHits;
+}
+
+uint64_t
+ResolutionCache::getNLookups() const
+{
+  std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+  return m_impl->m_nLookups;
+}
+
 } // namespace dns
 } // namespace ndn
@@ -109,6 +109,64 @@ syncResolve(const std::string& host,
             boost::asio::io_service& ioService,
             const AddressSelector& addressSelector = AnyAddress());
 
+/** \brief Cache of asynchronous host resolutions
+ *
+ * A successful resolution is remembered for \p positiveTtl, and a host that cannot be resolved
+ * is remembered for \p negativeTtl; timeouts are never remembered. Concurrent requests for the
+ * same host share a single resolution, whose timeout is that of the request that started it.
+ * Because the system resolver does not report record TTLs, the lifetimes are configured here.
+ *
+ * The cache can be shared among threads and io_services. Callbacks are always invoked
+ * asynchronously, on the io_service passed to the corresponding asyncResolve() call.
+ */
+class ResolutionCache : noncopyable
+{
+public:
+  explicit
+  ResolutionCache(time::nanoseconds positiveTtl = 1_min,
+                  time::nanoseconds negativeTtl = 5_s,
+                  size_t capacity = 4096);
+
+  ~ResolutionCache();
+
+  /** \brief Asynchronously resolve host, using a cached result if available
+   *  \sa dns::asyncResolve()
+   */
+  void
+  asyncResolve(const std::string& host,
+               const SuccessCallback& onSuccess,
+               const ErrorCallback& onError,
+               boost::asio::io_service& ioService,
+               const AddressSelector& addressSelector = AnyAddress(),
+               time::nanoseconds timeout = 4_s);
+
+  /** \brief Return number of cached hosts, including expired entries not yet evicted
+   */
+  size_t
+  size() const;
+
+  /** \brief Forget all cached results
+   *
+   * Resolutions in progress are not affected.
+   */
+  void
+  clear();
+
+  /** \brief Return number of requests answered from a cached result
+   */
+  uint64_t
+  getNHits() const;
+
+  /** \brief Return number of resolutions actually performed
+   */
+  uint64_t
+  getNLookups() const;
+
+private:
+  class Impl;
+  shared_ptr<Impl> m_impl;
+};
+
 } // namespace dns
 } // namespace ndn
 
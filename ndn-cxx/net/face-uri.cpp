@@ -329,7 +329,7 @@ public:
         addressSelector = dns::AnyAddress();
       }
 
-      dns::asyncResolve(unescapeHost(faceUri.getHost()),
+      FaceUri::getCanonizeCache().asyncResolve(unescapeHost(faceUri.getHost()),
         bind(&IpHostCanonizeProvider<Protocol>::onDnsSuccess, this, uri, onSuccess, onFailure, _1),
         bind(&IpHostCanonizeProvider<Protocol>::onDnsFailure, this, uri, onFailure, _1),
         io, addressSelector, timeout);
@@ -645,4 +645,95 @@ FaceUri::canonize(const CanonizeSuccessCallback& onSuccess,
                io, timeout);
 }
 
+namespace {
+
+class BatchCanonizer : public std::enable_shared_from_this<BatchCanonizer>
+{
+public:
+  BatchCanonizer(std::vector<FaceUri> uris, const FaceUri::BatchCanonizeCallback& onDone,
+                 boost::asio::io_service& io, time::nanoseconds timeout, size_t maxConcurrent)
+    : m_uris(std::move(uris))
+    , m_results(m_uris.size())
+    , m_onDone(onDone)
+    , m_io(io)
+    , m_timeout(timeout)
+    , m_maxConcurrent(maxConcurrent)
+  {
+  }
+
+  void
+  launch()
+  {
+    // canonize() may complete synchronously, in which case finish() calls back into launch()
+    if (m_isLaunching) {
+      return;
+    }
+    m_isLaunching = true;
+
+    while (m_nRunning < m_maxConcurrent && m_nextIndex < m_uris.size()) {
+      size_t i = m_nextIndex++;
+      ++m_nRunning;
+      auto self = shared_from_this();
+      m_uris[i].canonize([self, i] (const FaceUri& uri) { self->finish(i, true, uri, ""); },
+                         [self, i] (const std::string& reason) { self->finish(i, false, {}, reason); },
+                         m_io, m_timeout);
+    }
+
+    m_isLaunching = false;
+
+    if (m_nDone == m_uris.size() && m_onDone != nullptr) {
+      auto onDone = std::move(m_onDone);
+      m_onDone = nullptr;
+      onDone(std::move(m_results));
+    }
+  }
+
+private:
+  void
+  finish(size_t i, bool isCanonized, const FaceUri& uri, const std::string& reason)
+  {
+    auto& result = m_results[i];
+    result.isCanonized = isCanonized;
+    result.canonicalUri = uri;
+    result.reason = reason;
+
+    --m_nRunning;
+    ++m_nDone;
+    launch();
+  }
+
+private:
+  std::vector<FaceUri> m_uris;
+  std::vector<FaceUri::CanonizeResult> m_results;
+  FaceUri::BatchCanonizeCallback m_onDone;
+  boost::asio::io_service& m_io;
+  time::nanoseconds m_timeout;
+  size_t m_maxConcurrent;
+
+  size_t m_nextIndex = 0;
+  size_t m_nRunning = 0;
+  size_t m_nDone = 0;
+  bool m_isLaunching = false;
+};
+
+} // namespace
+
+void
+FaceUri::canonizeBatch(std::vector<FaceUri> uris,
+                       const BatchCanonizeCallback& onDone,
+                       boost::asio::io_service& io,
+                       time::nanoseconds timeout,
+                       size_t maxConcurrent)
+{
+  BOOST_ASSERT(maxConcurrent > 0);
+  std::make_shared<BatchCanonizer>(std::move(uris), onDone, io, timeout, maxConcurrent)->launch();
+}
+
+dns::ResolutionCache&
+FaceUri::getCanonizeCache()
+{
+  static dns::ResolutionCache cache;
+  return cache;
+}
+
 } // namespace ndn
@@ -38,6 +38,10 @@
 
 namespace ndn {
 
+namespace dns {
+class ResolutionCache;
+} // namespace dns
+
 /** \brief represents the underlying protocol and address used by a Face
  *  \sa https://redmine.named-data.net/projects/nfd/wiki/FaceMgmt#FaceUri
  */
@@ -168,6 +172,32 @@ public: // canonical FaceUri
            boost::asio::io_service& io,
            time::nanoseconds timeout) const;
 
+  struct CanonizeResult;
+  typedef function<void(std::vector<CanonizeResult>)> BatchCanonizeCallback;
+
+  /** \brief asynchronously convert many FaceUris to canonical form
+   *  \param uris          FaceUris to canonize
+   *  \param onDone        function to call once all FaceUris have been processed, with one
+   *                       result per element of \p uris, in the same order
+   *  \param io            reference to `boost::asio::io_service` instance
+   *  \param timeout       maximum allowable duration of each canonization
+   *  \param maxConcurrent maximum number of canonizations in progress at any time
+   *
+   *  Hostnames are resolved through getCanonizeCache(), so duplicate hostnames in \p uris
+   *  cause a single DNS query.
+   */
+  static void
+  canonizeBatch(std::vector<FaceUri> uris,
+                const BatchCanonizeCallback& onDone,
+                boost::asio::io_service& io,
+                time::nanoseconds timeout,
+                size_t maxConcurrent = 32);
+
+  /** \brief the cache of DNS resolutions shared by all canonize() and canonizeBatch() calls
+   */
+  static dns::ResolutionCache&
+  getCanonizeCache();
+
 private: // non-member operators
   // NOTE: the following "hidden friend" operators are available via
   //       argument-dependent lookup only and must be defined inline.
@@ -202,6 +232,15 @@ private:
 std::ostream&
 operator<<(std::ostream& os, const FaceUri& uri);
 
+/** \brief outcome of canonizing one FaceUri in FaceUri::canonizeBatch()
+ */
+struct FaceUri::CanonizeResult
+{
+  bool isCanonized = false;
+  FaceUri canonicalUri; ///< canonical form; meaningful only if isCanonized
+  std::string reason;   ///< failure reason; meaningful only if !isCanonized
+};
+
 } // namespace ndn
 
 #endif // NDN_NET_FACE_URI_HPP
@@ -0,0 +1,122 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/net/impl/netlink-coalescer.hpp"
+#include "ndn-cxx/net/impl/netlink-message.hpp"
+
+#include <linux/if_addr.h>
+
+#include <algorithm>
+
+namespace ndn {
+namespace net {
+
+void
+NetlinkCoalescer::add(const NetlinkMessage& nlmsg)
+{
+  BOOST_ASSERT(nlmsg.isValid());
+  ++m_nAdded;
+
+  auto bytes = reinterpret_cast<const uint8_t*>(&*nlmsg);
+  Entry entry(m_nextArrival++, MessageBytes(bytes, bytes + nlmsg->nlmsg_len));
+
+  switch (nlmsg->nlmsg_type) {
+    case RTM_NEWLINK:
+    case RTM_DELLINK: {
+      const ifinfomsg* ifi = nlmsg.getPayload<ifinfomsg>();
+      if (ifi == nullptr) {
+        break;
+      }
+      m_ifindexes.insert(ifi->ifi_index);
+      m_links[ifi->ifi_index] = std::move(entry);
+      return;
+    }
+
+    case RTM_NEWADDR:
+    case RTM_DELADDR: {
+      const ifaddrmsg* ifa = nlmsg.getPayload<ifaddrmsg>();
+      if (ifa == nullptr) {
+        break;
+      }
+      // identify the address the same way NetworkMonitorImplNetlink does
+      auto attrs = nlmsg.getAttributes<rtattr>(ifa);
+      boost::asio::ip::address ip;
+      if (ifa->ifa_family == AF_INET) {
+        auto v4 = attrs.getAttributeByType<boost::asio::ip::address_v4>(IFA_LOCAL);
+        if (v4)
+          ip = *v4;
+      }
+      else if (ifa->ifa_family == AF_INET6) {
+        auto v6 = attrs.getAttributeByType<boost::asio::ip::address_v6>(IFA_ADDRESS);
+        if (v6)
+          ip = *v6;
+      }
+      int ifindex = static_cast<int>(ifa->ifa_index);
+      m_ifindexes.insert(ifindex);
+      m_addresses[AddressKey(ifindex, ifa->ifa_family, ifa->ifa_prefixlen, ip)] = std::move(entry);
+      return;
+    }
+
+    case RTM_NEWROUTE:
+    case RTM_DELROUTE:
+      return;
+  }
+
+  // malformed, keep it so that the parser can report it
+  m_others.push_back(std::move(entry));
+}
+
+template<typename Map>
+static void
+appendInArrivalOrder(Map& map, std::vector<NetlinkCoalescer::MessageBytes>& out)
+{
+  std::vector<std::pair<uint64_t, NetlinkCoalescer::MessageBytes>*> entries;
+  entries.reserve(map.size());
+  for (auto& item : map) {
+    entries.push_back(&item.second);
+  }
+  std::sort(entries.begin(), entries.end(),
+            [] (const auto* a, const auto* b) { return a->first < b->first; });
+  for (auto* entry : entries) {
+    out.push_back(std::move(entry->second));
+  }
+  map.clear();
+}
+
+std::vector<NetlinkCoalescer::MessageBytes>
+NetlinkCoalescer::take()
+{
+  std::vector<MessageBytes> messages;
+  messages.reserve(size());
+  appendInArrivalOrder(m_links, messages);
+  appendInArrivalOrder(m_addresses, messages);
+  for (auto& entry : m_others) {
+    messages.push_back(std::move(entry.second));
+  }
+
+  m_others.clear();
+  m_ifindexes.clear();
+  m_nAdded = 0;
+  return messages;
+}
+
+} // namespace net
+} // namespace ndn
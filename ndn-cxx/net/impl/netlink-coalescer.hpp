@@ -0,0 +1,118 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_NET_NETLINK_COALESCER_HPP
+#define NDN_NET_NETLINK_COALESCER_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#ifndef NDN_CXX_HAVE_NETLINK
+#error "This file should not be included ..."
+#endif
+
+#include <boost/asio/ip/address.hpp>
+
+#include <map>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace ndn {
+namespace net {
+
+class NetlinkMessage;
+
+/**
+ * @brief Accumulates rtnetlink notifications and collapses them to their net effect.
+ *
+ * Of several link messages for the same interface index, only the last one is kept.
+ * Of several address messages for the same address of the same interface, only the last one
+ * is kept. Route messages are not kept, because they carry no interface state.
+ */
+class NetlinkCoalescer : noncopyable
+{
+public:
+  using MessageBytes = std::vector<uint8_t>;
+
+  /**
+   * @brief Add a notification.
+   * @pre @p nlmsg is valid and is one of RTM_{NEW,DEL}{LINK,ADDR,ROUTE}
+   *
+   * The message is copied.
+   */
+  void
+  add(const NetlinkMessage& nlmsg);
+
+  /// Returns whether no notification has been added since the last take()
+  bool
+  empty() const
+  {
+    return m_nAdded == 0;
+  }
+
+  /// Returns the number of notifications added since the last take()
+  size_t
+  getNAdded() const
+  {
+    return m_nAdded;
+  }
+
+  /// Returns the number of notifications that take() would return
+  size_t
+  size() const
+  {
+    return m_links.size() + m_addresses.size() + m_others.size();
+  }
+
+  /// Returns the indexes of all interfaces referenced by the kept notifications
+  const std::set<int>&
+  getInterfaceIndexes() const
+  {
+    return m_ifindexes;
+  }
+
+  /**
+   * @brief Return the kept notifications and reset.
+   *
+   * Link messages come first, followed by address messages, because the latter refer to
+   * interfaces created by the former. Within each group, messages are in order of arrival
+   * of their last instance. Messages that cannot be attributed to an interface come last.
+   */
+  std::vector<MessageBytes>
+  take();
+
+private:
+  using Entry = std::pair<uint64_t, MessageBytes>; ///< arrival number, message
+  // interface index, address family, prefix length, address
+  using AddressKey = std::tuple<int, uint8_t, uint8_t, boost::asio::ip::address>;
+
+  std::map<int, Entry> m_links;
+  std::map<AddressKey, Entry> m_addresses;
+  std::vector<Entry> m_others;
+  std::set<int> m_ifindexes;
+  uint64_t m_nextArrival = 0;
+  size_t m_nAdded = 0;
+};
+
+} // namespace net
+} // namespace ndn
+
+#endif // NDN_NET_NETLINK_COALESCER_HPP
@@ -250,6 +250,14 @@ NetlinkSocket::asyncWait()
 void
 NetlinkSocket::receiveAndValidate()
 {
+  // peek at the size of the next datagram and grow the buffer if needed, so that large
+  // multi-part dumps are never truncated
+  ssize_t nBytesPending = ::recv(m_sock->native_handle(), nullptr, 0, MSG_PEEK | MSG_TRUNC);
+  if (nBytesPending > static_cast<ssize_t>(m_buffer.size())) {
+    NDN_LOG_DEBUG("growing receive buffer to " << nBytesPending << " bytes");
+    m_buffer.resize(static_cast<size_t>(nBytesPending));
+  }
+
   sockaddr_nl sender{};
   iovec iov{};
   iov.iov_base = m_buffer.data();
@@ -279,7 +287,6 @@ NetlinkSocket::receiveAndValidate()
   if (msg.msg_flags & MSG_TRUNC) {
     NDN_LOG_ERROR("truncated message");
     NDN_THROW(Error("Received truncated netlink message"));
-    // TODO: grow the buffer and start over
   }
 
   if (msg.msg_namelen >= sizeof(sender) && sender.nl_pid != 0) {
@@ -32,6 +32,9 @@
 #include <linux/if_link.h>
 #include <net/if_arp.h>
 
+#include <algorithm>
+#include <iterator>
+
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/algorithm_ext/push_back.hpp>
 
@@ -47,6 +50,7 @@ namespace net {
 NetworkMonitorImplNetlink::NetworkMonitorImplNetlink(boost::asio::io_service& io)
   : m_rtnlSocket(io)
   , m_genlSocket(io)
+  , m_scheduler(io)
 {
   m_rtnlSocket.open();
 
@@ -55,7 +59,7 @@ NetworkMonitorImplNetlink::NetworkMonitorImplNetlink(boost::asio::io_service& io
                      RTNLGRP_IPV6_IFADDR, RTNLGRP_IPV6_ROUTE}) {
     m_rtnlSocket.joinGroup(group);
   }
-  m_rtnlSocket.registerNotificationCallback([this] (const auto& msg) { this->parseRtnlMessage(msg); });
+  m_rtnlSocket.registerNotificationCallback([this] (const auto& msg) { this->handleNotification(msg); });
 
   enumerateLinks();
 }
@@ -79,6 +83,18 @@ NetworkMonitorImplNetlink::listNetworkInterfaces() const
   return v;
 }
 
+void
+NetworkMonitorImplNetlink::setCoalescingWindow(time::nanoseconds window)
+{
+  BOOST_ASSERT(window >= 0_ns);
+  m_coalescingWindow = window;
+
+  if (m_coalescingWindow == 0_ns && !m_coalescer.empty()) {
+    m_flushEvent.cancel();
+    flushCoalescedChanges();
+  }
+}
+
 void
 NetworkMonitorImplNetlink::enumerateLinks()
 {
@@ -134,30 +150,135 @@ NetworkMonitorImplNetlink::enumerateRoutes()
   this->emitSignal(onEnumerationCompleted);
 }
 
+void
+NetworkMonitorImplNetlink::handleNotification(const NetlinkMessage& nlmsg)
+{
+  switch (nlmsg->nlmsg_type) {
+  case RTM_NEWLINK:
+  case RTM_DELLINK:
+  case RTM_NEWADDR:
+  case RTM_DELADDR:
+  case RTM_NEWROUTE:
+  case RTM_DELROUTE:
+    if (m_coalescingWindow > 0_ns && m_phase == ENUMERATION_COMPLETE) {
+      m_coalescer.add(nlmsg);
+      if (!m_flushEvent) {
+        m_flushEvent = m_scheduler.schedule(m_coalescingWindow, [this] { flushCoalescedChanges(); });
+      }
+      return;
+    }
+    break;
+  }
+
+  parseRtnlMessage(nlmsg);
+}
+
+namespace {
+
+struct InterfaceSnapshot
+{
+  shared_ptr<const NetworkInterface> interface;
+  InterfaceState state;
+  uint32_t mtu;
+  std::set<NetworkAddress> addresses;
+};
+
+} // namespace
+
+void
+NetworkMonitorImplNetlink::flushCoalescedChanges()
+{
+  if (m_coalescer.empty()) {
+    return;
+  }
+  NDN_LOG_DEBUG("applying " << m_coalescer.size() << " of " << m_coalescer.getNAdded() <<
+                " coalesced notifications");
+
+  std::map<int, InterfaceSnapshot> before;
+  for (int ifindex : m_coalescer.getInterfaceIndexes()) {
+    auto it = m_interfaces.find(ifindex);
+    if (it != m_interfaces.end()) {
+      const auto& interface = it->second;
+      before.emplace(ifindex, InterfaceSnapshot{interface, interface->getState(),
+                                                interface->getMtu(),
+                                                interface->getNetworkAddresses()});
+    }
+  }
+  std::set<int> ifindexes = m_coalescer.getInterfaceIndexes();
+
+  for (const auto& bytes : m_coalescer.take()) {
+    NetlinkMessage nlmsg(bytes.data(), bytes.size());
+    if (nlmsg.isValid()) {
+      applyRtnlMessage(nlmsg);
+    }
+  }
+
+  NetworkChangeSet changes;
+  for (int ifindex : ifindexes) {
+    auto oldIt = before.find(ifindex);
+    auto newIt = m_interfaces.find(ifindex);
+    bool existedBefore = oldIt != before.end();
+    bool existsAfter = newIt != m_interfaces.end();
+
+    if (!existedBefore && existsAfter) {
+      changes.addedInterfaces.push_back(newIt->second);
+    }
+    else if (existedBefore && !existsAfter) {
+      changes.removedInterfaces.push_back(oldIt->second.interface);
+    }
+    else if (existedBefore && existsAfter) {
+      const InterfaceSnapshot& old = oldIt->second;
+      const NetworkInterface& now = *newIt->second;
+
+      NetworkChangeSet::InterfaceDiff diff;
+      diff.interface = newIt->second;
+      diff.isStateChanged = old.state != now.getState();
+      diff.isMtuChanged = old.mtu != now.getMtu();
+      std::set_difference(now.getNetworkAddresses().begin(), now.getNetworkAddresses().end(),
+                          old.addresses.begin(), old.addresses.end(),
+                          std::back_inserter(diff.addedAddresses));
+      std::set_difference(old.addresses.begin(), old.addresses.end(),
+                          now.getNetworkAddresses().begin(), now.getNetworkAddresses().end(),
+                          std::back_inserter(diff.removedAddresses));
+
+      if (diff.isStateChanged || diff.isMtuChanged ||
+          !diff.addedAddresses.empty() || !diff.removedAddresses.empty()) {
+        changes.modifiedInterfaces.push_back(std::move(diff));
+      }
+    }
+  }
+
+  if (!changes.empty()) {
+    this->emitSignal(onNetworkChanged, changes);
+  }
+  this->emitSignal(onNetworkStateChanged); // backward compat
+}
+
 void
 NetworkMonitorImplNetlink::parseRtnlMessage(const NetlinkMessage& nlmsg)
+{
+  if (applyRtnlMessage(nlmsg) && m_phase == ENUMERATION_COMPLETE)
+    this->emitSignal(onNetworkStateChanged); // backward compat
+}
+
+bool
+NetworkMonitorImplNetlink::applyRtnlMessage(const NetlinkMessage& nlmsg)
 {
   switch (nlmsg->nlmsg_type) {
   case RTM_NEWLINK:
   case RTM_DELLINK:
     parseLinkMessage(nlmsg);
-    if (m_phase == ENUMERATION_COMPLETE)
-      this->emitSignal(onNetworkStateChanged); // backward compat
-    break;
+    return true;
 
   case RTM_NEWADDR:
   case RTM_DELADDR:
     parseAddressMessage(nlmsg);
-    if (m_phase == ENUMERATION_COMPLETE)
-      this->emitSignal(onNetworkStateChanged); // backward compat
-    break;
+    return true;
 
   case RTM_NEWROUTE:
   case RTM_DELROUTE:
     parseRouteMessage(nlmsg);
-    if (m_phase == ENUMERATION_COMPLETE)
-      this->emitSignal(onNetworkStateChanged); // backward compat
-    break;
+    return true;
 
   case NLMSG_DONE:
     parseDoneMessage(nlmsg);
@@ -167,6 +288,7 @@ NetworkMonitorImplNetlink::parseRtnlMessage(const NetlinkMessage& nlmsg)
     parseErrorMessage(nlmsg);
     break;
   }
+  return false;
 }
 
 static InterfaceType
@@ -31,7 +31,9 @@
 #error "This file should not be included ..."
 #endif
 
+#include "ndn-cxx/net/impl/netlink-coalescer.hpp"
 #include "ndn-cxx/net/impl/netlink-socket.hpp"
+#include "ndn-cxx/util/scheduler.hpp"
 
 #include <map>
 
@@ -53,7 +55,8 @@ public:
            NetworkMonitor::CAP_IF_ADD_REMOVE |
            NetworkMonitor::CAP_STATE_CHANGE |
            NetworkMonitor::CAP_MTU_CHANGE |
-           NetworkMonitor::CAP_ADDR_ADD_REMOVE;
+           NetworkMonitor::CAP_ADDR_ADD_REMOVE |
+           NetworkMonitor::CAP_COALESCE;
   }
 
   shared_ptr<const NetworkInterface>
@@ -62,6 +65,9 @@ public:
   std::vector<shared_ptr<const NetworkInterface>>
   listNetworkInterfaces() const final;
 
+  void
+  setCoalescingWindow(time::nanoseconds window) final;
+
 private:
   void
   enumerateLinks();
@@ -72,9 +78,23 @@ private:
   void
   enumerateRoutes();
 
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  void
+  handleNotification(const NetlinkMessage& nlmsg);
+
+private:
+  void
+  flushCoalescedChanges();
+
   void
   parseRtnlMessage(const NetlinkMessage& nlmsg);
 
+  /** \brief apply a link, address, route, done, or error message to the interface table
+   *  \return whether @p nlmsg is a link, address, or route message
+   */
+  bool
+  applyRtnlMessage(const NetlinkMessage& nlmsg);
+
   void
   parseLinkMessage(const NetlinkMessage& nlmsg);
 
@@ -102,6 +122,11 @@ private:
     ENUMERATING_ROUTES,   ///< a dump of all routes (RTM_GETROUTE) is in progress (unimplemented)
     ENUMERATION_COMPLETE,
   } m_phase = ENUMERATION_NOT_STARTED;
+
+  time::nanoseconds m_coalescingWindow = 0_ns;
+  NetlinkCoalescer m_coalescer;
+  Scheduler m_scheduler;
+  scheduler::ScopedEventId m_flushEvent;
 };
 
 } // namespace net
@@ -66,6 +66,7 @@ NetworkMonitor::NetworkMonitor(unique_ptr<NetworkMonitorImpl> impl)
   , onInterfaceAdded(m_impl->onInterfaceAdded)
   , onInterfaceRemoved(m_impl->onInterfaceRemoved)
   , onNetworkStateChanged(m_impl->onNetworkStateChanged)
+  , onNetworkChanged(m_impl->onNetworkChanged)
 {
 }
 
@@ -87,6 +88,12 @@ NetworkMonitor::listNetworkInterfaces() const
   return m_impl->listNetworkInterfaces();
 }
 
+void
+NetworkMonitor::setCoalescingWindow(time::nanoseconds window)
+{
+  m_impl->setCoalescingWindow(window);
+}
+
 shared_ptr<NetworkInterface>
 NetworkMonitorImpl::makeNetworkInterface()
 {
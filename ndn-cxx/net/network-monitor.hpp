@@ -27,6 +27,7 @@
 
 #include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/net/network-interface.hpp"
+#include "ndn-cxx/util/time.hpp"
 
 #include <vector>
 
@@ -35,6 +36,35 @@ namespace net {
 
 class NetworkMonitorImpl;
 
+/**
+ * @brief Net changes to the network interfaces over a period of time.
+ *
+ * An interface that is added and then removed within the same period does not appear at all;
+ * an address that is added and then removed again is not reported.
+ */
+struct NetworkChangeSet
+{
+  /// Changes to an interface that exists before and after the period
+  struct InterfaceDiff
+  {
+    shared_ptr<const NetworkInterface> interface;
+    bool isStateChanged = false;
+    bool isMtuChanged = false;
+    std::vector<NetworkAddress> addedAddresses;
+    std::vector<NetworkAddress> removedAddresses;
+  };
+
+  std::vector<shared_ptr<const NetworkInterface>> addedInterfaces;
+  std::vector<shared_ptr<const NetworkInterface>> removedInterfaces;
+  std::vector<InterfaceDiff> modifiedInterfaces;
+
+  bool
+  empty() const
+  {
+    return addedInterfaces.empty() && removedInterfaces.empty() && modifiedInterfaces.empty();
+  }
+};
+
 /**
  * @brief Network interface monitor.
  *
@@ -76,7 +106,9 @@ public:
     /// NetworkInterface onMtuChanged signal is supported
     CAP_MTU_CHANGE = 1 << 3,
     /// NetworkInterface onAddressAdded and onAddressRemoved signals are supported
-    CAP_ADDR_ADD_REMOVE = 1 << 4
+    CAP_ADDR_ADD_REMOVE = 1 << 4,
+    /// setCoalescingWindow() and the onNetworkChanged signal are supported
+    CAP_COALESCE = 1 << 5
   };
 
   /// Returns a bitwise OR'ed set of #Capability flags supported on the current platform.
@@ -95,6 +127,22 @@ public:
   NDN_CXX_NODISCARD std::vector<shared_ptr<const NetworkInterface>>
   listNetworkInterfaces() const;
 
+  /**
+   * @brief Coalesce network change notifications.
+   * @param window time during which notifications are accumulated after the first one;
+   *               zero disables coalescing
+   *
+   * When coalescing is enabled, notifications received after the initial enumeration are
+   * collapsed to their net effect before being applied, so that an interface or address that
+   * flaps within @p window causes at most one emission of each per-interface signal.
+   * Afterwards, the accumulated changes are reported by a single #onNetworkChanged emission,
+   * followed by a single #onNetworkStateChanged emission.
+   *
+   * This has no effect unless getCapabilities() includes #CAP_COALESCE.
+   */
+  void
+  setCoalescingWindow(time::nanoseconds window);
+
 protected:
   explicit
   NetworkMonitor(unique_ptr<NetworkMonitorImpl> impl);
@@ -126,6 +174,12 @@ public: // signals
 
   /// @deprecated Only for backward compatibility
   util::Signal<NetworkMonitorImpl>& onNetworkStateChanged;
+
+  /**
+   * @brief Fires once per coalescing window with the changes accumulated during the window.
+   * @sa setCoalescingWindow()
+   */
+  util::Signal<NetworkMonitorImpl, NetworkChangeSet>& onNetworkChanged;
 };
 
 class NetworkMonitorImpl : noncopyable
@@ -145,6 +199,11 @@ public:
   virtual std::vector<shared_ptr<const NetworkInterface>>
   listNetworkInterfaces() const = 0;
 
+  virtual void
+  setCoalescingWindow(time::nanoseconds window)
+  {
+  }
+
 protected:
   static shared_ptr<NetworkInterface>
   makeNetworkInterface();
@@ -154,12 +213,14 @@ public:
   util::Signal<NetworkMonitorImpl, shared_ptr<const NetworkInterface>> onInterfaceAdded;
   util::Signal<NetworkMonitorImpl, shared_ptr<const NetworkInterface>> onInterfaceRemoved;
   util::Signal<NetworkMonitorImpl> onNetworkStateChanged;
+  util::Signal<NetworkMonitorImpl, NetworkChangeSet> onNetworkChanged;
 
 protected:
   DECLARE_SIGNAL_EMIT(onEnumerationCompleted)
   DECLARE_SIGNAL_EMIT(onInterfaceAdded)
   DECLARE_SIGNAL_EMIT(onInterfaceRemoved)
   DECLARE_SIGNAL_EMIT(onNetworkStateChanged)
+  DECLARE_SIGNAL_EMIT(onNetworkChanged)
 };
 
 } // namespace net
@@ -64,6 +64,100 @@ CertificateBundleFetcher::setCertificateStorage(CertificateStorage& certStorage)
   m_inner->setCertificateStorage(certStorage);
 }
 
+void
+CertificateBundleFetcher::prefetchBundles(const std::vector<Name>& dataNames,
+                                          const PrefetchCallback& onComplete)
+{
+  BOOST_ASSERT(m_certStorage != nullptr);
+
+  auto nRetrieved = make_shared<size_t>(0);
+  auto nPending = make_shared<size_t>(0);
+  auto finishOne = [=] {
+    BOOST_ASSERT(*nPending > 0);
+    if (--*nPending == 0) {
+      onComplete(*nRetrieved);
+    }
+  };
+
+  std::vector<Interest> bundleInterests;
+  for (const auto& dataName : dataNames) {
+    if (dataName.empty()) {
+      continue;
+    }
+    Interest bundleInterest(deriveBundleName(dataName));
+    bundleInterest.setCanBePrefix(true);
+    bundleInterest.setMustBeFresh(true);
+    bundleInterest.setInterestLifetime(m_bundleInterestLifetime);
+    bundleInterests.push_back(std::move(bundleInterest));
+  }
+
+  NDN_LOG_DEBUG("Prefetching " << bundleInterests.size() << " certificate bundles");
+  if (bundleInterests.empty()) {
+    onComplete(0);
+    return;
+  }
+
+  *nPending = bundleInterests.size();
+  for (const auto& bundleInterest : bundleInterests) {
+    prefetchBundleSegment(bundleInterest, true, nRetrieved, finishOne);
+  }
+}
+
+void
+CertificateBundleFetcher::prefetchBundleSegment(const Interest& bundleInterest, bool isSegmentZeroExpected,
+                                                const shared_ptr<size_t>& nRetrieved,
+                                                const std::function<void()>& onDone)
+{
+  auto fetchSegment = [=] (const Name& bundleName, const name::Component& segmentNo) {
+    Interest nextInterest(bundleName.getPrefix(-1).append(segmentNo));
+    nextInterest.setCanBePrefix(false);
+    nextInterest.setMustBeFresh(false);
+    nextInterest.setInterestLifetime(m_bundleInterestLifetime);
+    prefetchBundleSegment(nextInterest, false, nRetrieved, onDone);
+  };
+
+  m_face.expressInterest(bundleInterest,
+    [=] (const Interest&, const Data& bundleData) {
+      NDN_LOG_DEBUG("Prefetched certificate bundle " << bundleData.getName());
+
+      name::Component currentSegment = bundleData.getName().get(-1);
+      if (!currentSegment.isSegment()) {
+        return onDone();
+      }
+      if (isSegmentZeroExpected && currentSegment.toSegment() != 0) {
+        return fetchSegment(bundleData.getName(), name::Component::fromSegment(0));
+      }
+
+      try {
+        Block bundleContent = bundleData.getContent();
+        bundleContent.parse();
+        for (const auto& block : bundleContent.elements()) {
+          m_certStorage->cacheUnverifiedCert(Certificate(block));
+          ++*nRetrieved;
+        }
+      }
+      catch (const tlv::Error& e) {
+        NDN_LOG_DEBUG("Malformed certificate bundle " << bundleData.getName() << " (" << e.what() << ")");
+        return onDone();
+      }
+
+      const auto& finalBlockId = bundleData.getFinalBlock();
+      if (!finalBlockId || currentSegment >= *finalBlockId) {
+        return onDone();
+      }
+      fetchSegment(bundleData.getName(), currentSegment.getSuccessor());
+    },
+    [=] (const Interest&, const lp::Nack& nack) {
+      NDN_LOG_DEBUG("NACK (" << nack.getReason() << ") while prefetching certificate bundle "
+                    << bundleInterest.getName());
+      onDone();
+    },
+    [=] (const Interest&) {
+      NDN_LOG_DEBUG("Timeout while prefetching certificate bundle " << bundleInterest.getName());
+      onDone();
+    });
+}
+
 void
 CertificateBundleFetcher::doFetch(const shared_ptr<CertificateRequest>& certRequest,
                                   const shared_ptr<ValidationState>& state,
@@ -92,6 +186,13 @@ CertificateBundleFetcher::doFetch(const shared_ptr<CertificateRequest>& certRequ
   }
 }
 
+void
+CertificateBundleFetcher::doPrefetch(const std::vector<Name>& certPrefixes,
+                                     const PrefetchCallback& onComplete)
+{
+  m_inner->prefetch(certPrefixes, onComplete);
+}
+
 void
 CertificateBundleFetcher::fetchFirstBundleSegment(const Name& bundleNamePrefix,
                                                   const shared_ptr<CertificateRequest>& certRequest,
@@ -178,7 +279,7 @@ CertificateBundleFetcher::dataCallback(const Data& bundleData,
       m_certStorage->cacheUnverifiedCert(Certificate(block));
     }
 
-    auto cert = m_certStorage->getUnverifiedCertCache().find(certRequest->interest);
+    auto cert = m_certStorage->findUnverifiedCert(certRequest->interest);
     continueValidation(*cert, state);
   }
 }
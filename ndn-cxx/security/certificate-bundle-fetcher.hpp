@@ -22,6 +22,7 @@
 #ifndef NDN_SECURITY_CERTIFICATE_BUNDLE_FETCHER_HPP
 #define NDN_SECURITY_CERTIFICATE_BUNDLE_FETCHER_HPP
 
+#include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/name.hpp"
 #include "ndn-cxx/tag.hpp"
 #include "ndn-cxx/security/certificate-fetcher-from-network.hpp"
@@ -65,11 +66,31 @@ public:
   void
   setCertificateStorage(CertificateStorage& certStorage) override;
 
+  /**
+   * @brief Asynchronously retrieve the certificate bundles of the given data names
+   *
+   * For each name in @p dataNames, the bundle name is derived as during Data validation, and
+   * every segment of the bundle is retrieved. All bundles are retrieved concurrently, and the
+   * certificates they contain are placed into the unverified cache of the certificate storage.
+   *
+   * @param dataNames names of Data packets that are expected to be validated
+   * @param onComplete callback invoked once every bundle has been retrieved or has failed,
+   *                   with the number of certificates that were placed into the cache
+   */
+  void
+  prefetchBundles(const std::vector<Name>& dataNames, const PrefetchCallback& onComplete);
+
 protected:
   void
   doFetch(const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state,
           const ValidationContinuation& continueValidation) override;
 
+  /**
+   * @brief Prefetch individual certificates using the inner fetcher
+   */
+  void
+  doPrefetch(const std::vector<Name>& certPrefixes, const PrefetchCallback& onComplete) override;
+
 private:
   /**
    * @brief Fetch the first bundle segment.
@@ -94,6 +115,14 @@ private:
                          const shared_ptr<ValidationState>& state,
                          const ValidationContinuation& continueValidation);
 
+  /**
+   * @brief Fetch a bundle segment as part of prefetchBundles, continuing with the next segment
+   *        until FinalBlockId is reached.
+   */
+  void
+  prefetchBundleSegment(const Interest& bundleInterest, bool isSegmentZeroExpected,
+                        const shared_ptr<size_t>& nRetrieved, const std::function<void()>& onDone);
+
   /**
    * @brief Derive bundle name from data name.
    *
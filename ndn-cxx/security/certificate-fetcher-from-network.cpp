@@ -23,6 +23,7 @@
 
 #include "ndn-cxx/face.hpp"
 #include "ndn-cxx/security/certificate-request.hpp"
+#include "ndn-cxx/security/certificate-storage.hpp"
 #include "ndn-cxx/security/validation-state.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
@@ -58,6 +59,45 @@ CertificateFetcherFromNetwork::doFetch(const shared_ptr<CertificateRequest>& cer
                          });
 }
 
+void
+CertificateFetcherFromNetwork::doPrefetch(const std::vector<Name>& certPrefixes,
+                                          const PrefetchCallback& onComplete)
+{
+  auto nPending = make_shared<size_t>(certPrefixes.size());
+  auto nRetrieved = make_shared<size_t>(0);
+  auto finishOne = [=] {
+    BOOST_ASSERT(*nPending > 0);
+    if (--*nPending == 0) {
+      onComplete(*nRetrieved);
+    }
+  };
+
+  for (const auto& certPrefix : certPrefixes) {
+    CertificateRequest certRequest(certPrefix);
+    m_face.expressInterest(certRequest.interest,
+                           [=] (const Interest&, const Data& data) {
+                             try {
+                               m_certStorage->cacheUnverifiedCert(Certificate(data));
+                               ++*nRetrieved;
+                             }
+                             catch (const tlv::Error& e) {
+                               NDN_LOG_DEBUG("Prefetched a malformed certificate " << data.getName()
+                                             << " (" << e.what() << ")");
+                             }
+                             finishOne();
+                           },
+                           [=] (const Interest&, const lp::Nack& nack) {
+                             NDN_LOG_DEBUG("NACK (" << nack.getReason() << ") while prefetching "
+                                           "certificate " << certPrefix);
+                             finishOne();
+                           },
+                           [=] (const Interest&) {
+                             NDN_LOG_DEBUG("Timeout while prefetching certificate " << certPrefix);
+                             finishOne();
+                           });
+  }
+}
+
 void
 CertificateFetcherFromNetwork::dataCallback(const Data& data,
                                             const shared_ptr<CertificateRequest>&,
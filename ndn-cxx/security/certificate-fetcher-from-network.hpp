@@ -51,6 +51,12 @@ protected:
   doFetch(const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state,
           const ValidationContinuation& continueValidation) override;
 
+  /**
+   * @brief Express one Interest for each certificate, without retries.
+   */
+  void
+  doPrefetch(const std::vector<Name>& certPrefixes, const PrefetchCallback& onComplete) override;
+
   /**
    * @brief Callback invoked when certificate is retrieved.
    */
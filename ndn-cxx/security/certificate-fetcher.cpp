@@ -52,7 +52,7 @@ CertificateFetcher::fetch(const shared_ptr<CertificateRequest>& certRequest,
                           const ValidationContinuation& continueValidation)
 {
   BOOST_ASSERT(m_certStorage != nullptr);
-  auto cert = m_certStorage->getUnverifiedCertCache().find(certRequest->interest);
+  auto cert = m_certStorage->findUnverifiedCert(certRequest->interest);
   if (cert != nullptr) {
     NDN_LOG_DEBUG_DEPTH("Found certificate in **un**verified key cache " << cert->getName());
     continueValidation(*cert, state);
@@ -66,6 +66,28 @@ CertificateFetcher::fetch(const shared_ptr<CertificateRequest>& certRequest,
           });
 }
 
+void
+CertificateFetcher::prefetch(const std::vector<Name>& certPrefixes, const PrefetchCallback& onComplete)
+{
+  BOOST_ASSERT(m_certStorage != nullptr);
+  std::vector<Name> unknownCerts;
+  std::copy_if(certPrefixes.begin(), certPrefixes.end(), std::back_inserter(unknownCerts),
+               [this] (const Name& certPrefix) { return !m_certStorage->isCertKnown(certPrefix); });
+
+  NDN_LOG_DEBUG("Prefetching " << unknownCerts.size() << " of " << certPrefixes.size() << " certificates");
+  if (unknownCerts.empty()) {
+    onComplete(0);
+    return;
+  }
+  doPrefetch(unknownCerts, onComplete);
+}
+
+void
+CertificateFetcher::doPrefetch(const std::vector<Name>&, const PrefetchCallback& onComplete)
+{
+  onComplete(0);
+}
+
 } // inline namespace v2
 } // namespace security
 } // namespace ndn
@@ -22,7 +22,7 @@
 #ifndef NDN_SECURITY_CERTIFICATE_FETCHER_HPP
 #define NDN_SECURITY_CERTIFICATE_FETCHER_HPP
 
-#include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/name.hpp"
 
 namespace ndn {
 namespace security {
@@ -42,6 +42,12 @@ public:
   using ValidationContinuation = std::function<void(const Certificate& cert,
                                                     const shared_ptr<ValidationState>& state)>;
 
+  /**
+   * @brief Callback invoked when prefetching finishes
+   * @param nRetrieved number of certificates placed into the unverified cache
+   */
+  using PrefetchCallback = std::function<void(size_t nRetrieved)>;
+
   CertificateFetcher();
 
   virtual
@@ -72,7 +78,31 @@ public:
   fetch(const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state,
         const ValidationContinuation& continueValidation);
 
+  /**
+   * @brief Asynchronously retrieve certificates ahead of validation
+   * @pre m_certStorage != nullptr
+   *
+   * Names in @p certPrefixes that are already known to the certificate storage are skipped.
+   * The remaining certificates are retrieved concurrently by the implementation-specific
+   * doPrefetch and placed into the unverified cache of the certificate storage, so that
+   * subsequent validations do not need to wait for them.
+   *
+   * @param certPrefixes names or name prefixes of the certificates to retrieve
+   * @param onComplete callback invoked once every retrieval has either succeeded or failed
+   */
+  void
+  prefetch(const std::vector<Name>& certPrefixes, const PrefetchCallback& onComplete);
+
 private:
+  /**
+   * @brief Asynchronous certificate prefetching implementation
+   *
+   * The default implementation does not retrieve anything and immediately invokes
+   * @p onComplete with zero.
+   */
+  virtual void
+  doPrefetch(const std::vector<Name>& certPrefixes, const PrefetchCallback& onComplete);
+
   /**
    * @brief Asynchronous certificate fetching implementation
    */
@@ -25,9 +25,12 @@ namespace ndn {
 namespace security {
 inline namespace v2 {
 
-CertificateStorage::CertificateStorage()
-  : m_verifiedCertCache(1_h)
-  , m_unverifiedCertCache(5_min)
+CertificateStorage::CertificateStorage(time::nanoseconds verifiedCertLifetime,
+                                       time::nanoseconds unverifiedCertLifetime)
+  : m_verifiedCertCache(verifiedCertLifetime)
+  , m_unverifiedCertCache(unverifiedCertLifetime)
+  , m_verifiedCertLifetime(verifiedCertLifetime)
+  , m_unverifiedCertLifetime(unverifiedCertLifetime)
 {
 }
 
@@ -39,16 +42,47 @@ CertificateStorage::findTrustedCert(const Interest& interestForCert) const
     return cert;
   }
 
-  cert = m_verifiedCertCache.find(interestForCert);
-  return cert;
+  if (m_lruVerifiedCertCache != nullptr) {
+    return m_lruVerifiedCertCache->peek(interestForCert);
+  }
+  return m_verifiedCertCache.find(interestForCert);
+}
+
+const Certificate*
+CertificateStorage::lookupTrustedCert(const Interest& interestForCert)
+{
+  auto cert = m_trustAnchors.find(interestForCert);
+  if (cert != nullptr) {
+    return cert;
+  }
+
+  if (m_lruVerifiedCertCache != nullptr) {
+    return m_lruVerifiedCertCache->find(interestForCert);
+  }
+  return m_verifiedCertCache.find(interestForCert);
+}
+
+const Certificate*
+CertificateStorage::findUnverifiedCert(const Interest& interestForCert) const
+{
+  if (m_lruUnverifiedCertCache != nullptr) {
+    return m_lruUnverifiedCertCache->find(interestForCert);
+  }
+  return m_unverifiedCertCache.find(interestForCert);
 }
 
 bool
 CertificateStorage::isCertKnown(const Name& certName) const
 {
-  return (m_trustAnchors.find(certName) != nullptr ||
-          m_verifiedCertCache.find(certName) != nullptr ||
-          m_unverifiedCertCache.find(certName) != nullptr);
+  if (m_trustAnchors.find(certName) != nullptr) {
+    return true;
+  }
+  if (m_lruVerifiedCertCache != nullptr) {
+    return m_lruVerifiedCertCache->peek(certName) != nullptr ||
+           m_lruUnverifiedCertCache->peek(certName) != nullptr;
+  }
+  return m_verifiedCertCache.find(certName) != nullptr ||
+         m_unverifiedCertCache.find(certName) != nullptr;
 }
 
 void
@@ -73,19 +107,32 @@ CertificateStorage::resetAnchors()
 void
 CertificateStorage::cacheVerifiedCert(Certificate&& cert)
 {
-  m_verifiedCertCache.insert(std::move(cert));
+  if (m_lruVerifiedCertCache != nullptr) {
+    m_lruVerifiedCertCache->insert(cert);
+  }
+  else {
+    m_verifiedCertCache.insert(cert);
+  }
 }
 
 void
 CertificateStorage::resetVerifiedCerts()
 {
   m_verifiedCertCache.clear();
+  if (m_lruVerifiedCertCache != nullptr) {
+    m_lruVerifiedCertCache->clear();
+  }
 }
 
 void
 CertificateStorage::cacheUnverifiedCert(Certificate&& cert)
 {
-  m_unverifiedCertCache.insert(std::move(cert));
+  if (m_lruUnverifiedCertCache != nullptr) {
+    m_lruUnverifiedCertCache->insert(cert);
+  }
+  else {
+    m_unverifiedCertCache.insert(cert);
+  }
 }
 
 const TrustAnchorContainer&
@@ -106,6 +153,18 @@ CertificateStorage::getUnverifiedCertCache() const
   return m_unverifiedCertCache;
 }
 
+void
+CertificateStorage::useLruCertCaches(boost::asio::io_service& ioService,
+                                     size_t verifiedLimit, size_t unverifiedLimit)
+{
+  auto verified = make_unique<LruCertificateCache>(ioService, verifiedLimit, m_verifiedCertLifetime);
+  auto unverified = make_unique<LruCertificateCache>(ioService, unverifiedLimit, m_unverifiedCertLifetime);
+  m_lruVerifiedCertCache = std::move(verified);
+  m_lruUnverifiedCertCache = std::move(unverified);
+  m_verifiedCertCache.clear();
+  m_unverifiedCertCache.clear();
+}
+
 } // inline namespace v2
 } // namespace security
 } // namespace ndn
@@ -24,6 +24,7 @@
 
 #include "ndn-cxx/security/certificate.hpp"
 #include "ndn-cxx/security/certificate-cache.hpp"
+#include "ndn-cxx/security/lru-certificate-cache.hpp"
 #include "ndn-cxx/security/trust-anchor-container.hpp"
 
 namespace ndn {
@@ -36,30 +37,50 @@ inline namespace v2 {
 class CertificateStorage : noncopyable
 {
 public:
-  CertificateStorage();
+  /**
+   * @brief Create a certificate storage.
+   *
+   * @param verifiedCertLifetime    maximum time that verified certificates could live inside cache
+   * @param unverifiedCertLifetime  maximum time that unverified certificates could live inside cache
+   */
+  explicit
+  CertificateStorage(time::nanoseconds verifiedCertLifetime = 1_h,
+                     time::nanoseconds unverifiedCertLifetime = 5_min);
 
   /**
    * @brief Find a trusted certificate in trust anchor container or in verified cache
    * @param interestForCert Interest for certificate
    * @return found certificate, nullptr if not found.
    *
+   * This lookup does not affect the eviction order or the counters of the LRU caches.
+   *
    * @note The returned pointer may get invalidated after next findTrustedCert or findCert calls.
    */
   const Certificate*
   findTrustedCert(const Interest& interestForCert) const;
 
+  /**
+   * @brief Find a certificate in unverified cache
+   * @param interestForCert Interest for certificate
+   * @return found certificate, nullptr if not found.
+   *
+   * @note The returned pointer may get invalidated after next cacheUnverifiedCert call.
+   */
+  const Certificate*
+  findUnverifiedCert(const Interest& interestForCert) const;
+
   /**
    * @brief Check if certificate exists in verified, unverified cache, or in the set of trust
    *        anchors
+   *
+   * This lookup does not affect the eviction order or the counters of the LRU caches.
    */
   bool
   isCertKnown(const Name& certPrefix) const;
 
   /**
-   * @brief Cache unverified certificate for a period of time (5 minutes)
+   * @brief Cache unverified certificate for a period of time (5 minutes by default)
    * @param cert  The certificate packet
-   *
-   * @todo Add ability to customize time period
    */
   void
   cacheUnverifiedCert(Certificate&& cert);
@@ -82,6 +103,40 @@ public:
   const CertificateCache&
   getUnverifiedCertCache() const;
 
+  /**
+   * @brief Use LruCertificateCache for verified and unverified certificates
+   *
+   * The LRU caches are bounded in size, look up certificates by key name with a hash index,
+   * and remove expired certificates in a periodic sweep scheduled on @p ioService, which is
+   * suitable for validators that keep many certificates. Certificates cached so far are
+   * discarded, and getVerifiedCertCache() and getUnverifiedCertCache() remain empty from then on.
+   *
+   * @param ioService        io_service on which the expiry sweeps are scheduled
+   * @param verifiedLimit    maximum number of verified certificates, must be positive
+   * @param unverifiedLimit  maximum number of unverified certificates, must be positive
+   * @throw std::invalid_argument a limit is zero
+   */
+  void
+  useLruCertCaches(boost::asio::io_service& ioService, size_t verifiedLimit, size_t unverifiedLimit);
+
+  /**
+   * @return Verified LRU certificate cache, nullptr if useLruCertCaches() has not been called
+   */
+  const LruCertificateCache*
+  getLruVerifiedCertCache() const
+  {
+    return m_lruVerifiedCertCache.get();
+  }
+
+  /**
+   * @return Unverified LRU certificate cache, nullptr if useLruCertCaches() has not been called
+   */
+  const LruCertificateCache*
+  getLruUnverifiedCertCache() const
+  {
+    return m_lruUnverifiedCertCache.get();
+  }
+
 protected:
   /**
    * @brief load static trust anchor.
@@ -116,10 +171,20 @@ protected:
   resetAnchors();
 
   /**
-   * @brief Cache verified certificate a period of time (1 hour)
-   * @param cert  The certificate packet
+   * @brief Find a trusted certificate in trust anchor container or in verified cache, in order
+   *        to use it
+   *
+   * Unlike findTrustedCert(), a certificate found in the verified LRU cache becomes the most
+   * recently used one, and the lookup is counted as a hit or a miss.
    *
-   * @todo Add ability to customize time period
+   * @note The returned pointer may get invalidated after next findTrustedCert or findCert calls.
+   */
+  const Certificate*
+  lookupTrustedCert(const Interest& interestForCert);
+
+  /**
+   * @brief Cache verified certificate a period of time (1 hour by default)
+   * @param cert  The certificate packet
    */
   void
   cacheVerifiedCert(Certificate&& cert);
@@ -134,6 +199,10 @@ protected:
   TrustAnchorContainer m_trustAnchors;
   CertificateCache m_verifiedCertCache;
   CertificateCache m_unverifiedCertCache;
+  unique_ptr<LruCertificateCache> m_lruVerifiedCertCache;
+  unique_ptr<LruCertificateCache> m_lruUnverifiedCertCache;
+  time::nanoseconds m_verifiedCertLifetime;
+  time::nanoseconds m_unverifiedCertLifetime;
 };
 
 } // inline namespace v2
@@ -41,7 +41,7 @@ CommandInterestPreparer::prepareCommandInterestName(Name name)
 
   name
     .append(name::Component::fromNumber(timestamp.count()))
-    .append(name::Component::fromNumber(random::generateWord64())) // nonce
+    .append(name::Component::fromNumber(random::generateNonceWord64())) // nonce
     ;
 
   return name;
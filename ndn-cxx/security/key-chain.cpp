@@ -22,7 +22,9 @@
 #include "ndn-cxx/security/key-chain.hpp"
 
 #include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/detail/thread-pool.hpp"
 #include "ndn-cxx/util/config-file.hpp"
+#include "ndn-cxx/util/io.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
 #include "ndn-cxx/security/pib/impl/pib-memory.hpp"
@@ -42,6 +44,7 @@
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/verifier-filter.hpp"
 
+#include <boost/asio/io_service.hpp>
 #include <boost/lexical_cast.hpp>
 
 namespace ndn {
@@ -371,6 +374,80 @@ KeyChain::exportSafeBag(const Certificate& certificate, const char* pw, size_t p
 
 void
 KeyChain::importSafeBag(const SafeBag& safeBag, const char* pw, size_t pwLen)
+{
+  importSafeBagsImpl(&safeBag, 1, [&] (size_t, const Name& keyName) {
+    m_tpm->importPrivateKey(keyName,
+                            safeBag.getEncryptedKeyBag().data(), safeBag.getEncryptedKeyBag().size(),
+                            pw, pwLen);
+  });
+}
+
+std::vector<shared_ptr<SafeBag>>
+KeyChain::exportSafeBags(const std::vector<Certificate>& certificates, const char* pw, size_t pwLen,
+                         size_t nThreads)
+{
+  std::vector<shared_ptr<SafeBag>> safeBags(certificates.size());
+  io::detail::parallelFor(certificates.size(), nThreads, [&] (size_t i) {
+    safeBags[i] = exportSafeBag(certificates[i], pw, pwLen);
+  });
+  return safeBags;
+}
+
+void
+KeyChain::importSafeBags(const std::vector<SafeBag>& safeBags, const char* pw, size_t pwLen,
+                         size_t nThreads)
+{
+  std::vector<shared_ptr<transform::PrivateKey>> keys(safeBags.size());
+  io::detail::parallelFor(safeBags.size(), nThreads, [&] (size_t i) {
+    const auto& keyBag = safeBags[i].getEncryptedKeyBag();
+    auto key = make_shared<transform::PrivateKey>();
+    try {
+      key->loadPkcs8(keyBag.data(), keyBag.size(), pw, pwLen);
+    }
+    catch (const transform::PrivateKey::Error&) {
+      NDN_THROW_NESTED(Error("Failed to decrypt private key in SafeBag #" + to_string(i)));
+    }
+    keys[i] = std::move(key);
+  });
+
+  importSafeBagsImpl(safeBags.data(), safeBags.size(), [&] (size_t i, const Name& keyName) {
+    m_tpm->importPrivateKey(keyName, std::move(keys[i]));
+  });
+}
+
+void
+KeyChain::importSafeBagsImpl(const SafeBag* safeBags, size_t nSafeBags,
+                             const std::function<void(size_t i, const Name& keyName)>& importKey)
+{
+  ImportedItems imported;
+
+  // add all identities, keys, and certificates in one PIB transaction
+  auto pibImpl = m_pib->getImpl();
+  pibImpl->beginTransaction();
+  try {
+    for (size_t i = 0; i < nSafeBags; ++i) {
+      importSafeBagImpl(safeBags[i], [&] (const Name& keyName) { importKey(i, keyName); }, imported);
+    }
+  }
+  catch (const std::exception&) {
+    pibImpl->rollbackTransaction();
+    undoImport(imported);
+    throw;
+  }
+
+  try {
+    pibImpl->commitTransaction();
+  }
+  catch (const std::exception&) {
+    undoImport(imported);
+    throw;
+  }
+}
+
+void
+KeyChain::importSafeBagImpl(const SafeBag& safeBag,
+                            const std::function<void(const Name& keyName)>& importKey,
+                            ImportedItems& imported)
 {
   Data certData = safeBag.getCertificate();
   Certificate cert(std::move(certData));
@@ -392,9 +469,7 @@ KeyChain::importSafeBag(const SafeBag& safeBag, const char* pw, size_t pwLen)
   }
 
   try {
-    m_tpm->importPrivateKey(keyName,
-                            safeBag.getEncryptedKeyBag().data(), safeBag.getEncryptedKeyBag().size(),
-                            pw, pwLen);
+    importKey(keyName);
   }
   catch (const Tpm::Error&) {
     NDN_THROW_NESTED(Error("Failed to import private key `" + keyName.toUri() + "`"));
@@ -425,11 +500,39 @@ KeyChain::importSafeBag(const SafeBag& safeBag, const char* pw, size_t pwLen)
                     "and private key `" + keyName.toUri() + "` do not match"));
   }
 
+  imported.keys.push_back(keyName);
+  if (!m_pib->getImpl()->hasIdentity(identity)) {
+    imported.identities.push_back(identity);
+  }
+
   Identity id = m_pib->addIdentity(identity);
   Key key = id.addKey(cert.getPublicKey().data(), cert.getPublicKey().size(), keyName);
   key.addCertificate(cert);
 }
 
+void
+KeyChain::undoImport(const ImportedItems& imported) noexcept
+{
+  // the error that caused the undo is more relevant to the caller than any error here
+  try {
+    m_pib->forgetAdded(imported.identities, imported.keys);
+  }
+  catch (const std::exception& e) {
+    NDN_LOG_ERROR("Cannot undo the import in the PIB: " << e.what());
+  }
+
+  for (const auto& keyName : imported.keys) {
+    try {
+      if (m_tpm->hasKey(keyName)) {
+        m_tpm->deleteKey(keyName);
+      }
+    }
+    catch (const std::exception& e) {
+      NDN_LOG_ERROR("Cannot delete imported private key " << keyName << ": " << e.what());
+    }
+  }
+}
+
 void
 KeyChain::importPrivateKey(const Name& keyName, shared_ptr<transform::PrivateKey> key)
 {
@@ -457,12 +560,15 @@ KeyChain::sign(Data& data, const SigningInfo& params)
   data.setSignatureInfo(sigInfo);
 
   EncodingBuffer encoder;
-  data.wireEncode(encoder, true);
+  auto sigValue = sign(data.extractSignedRanges(encoder), keyName, params.getDigestAlgorithm());
 
-  Block sigValue(tlv::SignatureValue,
-                 sign({{encoder.buf(), encoder.size()}}, keyName, params.getDigestAlgorithm()));
-
-  data.wireEncode(encoder, sigValue);
+  if (data.hasExternalContent()) {
+    // the external content is not copied into a contiguous encoding
+    data.setSignatureValue(std::move(sigValue));
+  }
+  else {
+    data.wireEncode(encoder, Block(tlv::SignatureValue, std::move(sigValue)));
+  }
 }
 
 void
@@ -492,6 +598,19 @@ KeyChain::sign(Interest& interest, const SigningInfo& params)
   }
 }
 
+void
+KeyChain::prepareTemplate(DataTemplate& tpl, const SigningInfo& params)
+{
+  Name keyName;
+  SignatureInfo sigInfo;
+  std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
+
+  auto digestAlgorithm = params.getDigestAlgorithm();
+  tpl.setSigner(sigInfo, [this, keyName, digestAlgorithm] (const InputBuffers& bufs) {
+    return sign(bufs, keyName, digestAlgorithm);
+  });
+}
+
 Block
 KeyChain::sign(const uint8_t* buffer, size_t bufferLength, const SigningInfo& params)
 {
@@ -503,6 +622,79 @@ KeyChain::sign(const uint8_t* buffer, size_t bufferLength, const SigningInfo& pa
                sign({{buffer, bufferLength}}, keyName, params.getDigestAlgorithm()));
 }
 
+// public: asynchronous signing
+
+void
+KeyChain::setSigningThreads(size_t nThreads, size_t maxPending)
+{
+  auto pool = make_unique<ndn::detail::ThreadPool>(nThreads, maxPending);
+  m_signingPool = std::move(pool);
+}
+
+bool
+KeyChain::asyncSign(const shared_ptr<Data>& data, const SigningInfo& params,
+                    boost::asio::io_service& io,
+                    const DataSignedCallback& onSigned, const SignFailureCallback& onFailure)
+{
+  BOOST_ASSERT(data != nullptr);
+
+  if (m_signingPool == nullptr) {
+    setSigningThreads(1);
+  }
+  // reserve the slot before touching data, so that a full pool leaves data unchanged
+  if (!m_signingPool->tryReserve()) {
+    return false;
+  }
+
+  Name keyName;
+  SignatureInfo sigInfo;
+  auto encoder = make_shared<EncodingBuffer>();
+  InputBuffers signedRanges;
+  try {
+    std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
+    data->setSignatureInfo(sigInfo);
+    signedRanges = data->extractSignedRanges(*encoder);
+  }
+  catch (...) {
+    m_signingPool->cancelReservation();
+    throw;
+  }
+
+  auto digestAlgorithm = params.getDigestAlgorithm();
+  // keep io.run() from returning while the signature is being computed
+  auto work = make_shared<boost::asio::io_service::work>(io);
+  m_signingPool->post([this, &io, work, data, encoder, signedRanges, keyName,
+                       digestAlgorithm, onSigned, onFailure] {
+    ConstBufferPtr sigValue;
+    std::string reason;
+    try {
+      sigValue = sign(signedRanges, keyName, digestAlgorithm);
+    }
+    catch (const std::exception& e) {
+      reason = e.what();
+    }
+
+    io.post([data, encoder, sigValue, reason, onSigned, onFailure] {
+      if (sigValue == nullptr) {
+        if (onFailure) {
+          onFailure(reason);
+        }
+        return;
+      }
+      if (data->hasExternalContent()) {
+        data->setSignatureValue(sigValue);
+      }
+      else {
+        data->wireEncode(*encoder, Block(tlv::SignatureValue, sigValue));
+      }
+      if (onSigned) {
+        onSigned(data);
+      }
+    });
+  });
+  return true;
+}
+
 // public: PIB/TPM creation helpers
 
 static inline std::tuple<std::string/*type*/, std::string/*location*/>
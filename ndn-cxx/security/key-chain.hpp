@@ -22,7 +22,9 @@
 #ifndef NDN_SECURITY_KEY_CHAIN_HPP
 #define NDN_SECURITY_KEY_CHAIN_HPP
 
+#include "ndn-cxx/data-template.hpp"
 #include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/security/certificate.hpp"
 #include "ndn-cxx/security/key-params.hpp"
 #include "ndn-cxx/security/pib/pib.hpp"
@@ -31,6 +33,11 @@
 #include "ndn-cxx/security/tpm/tpm.hpp"
 
 namespace ndn {
+
+namespace detail {
+class ThreadPool;
+} // namespace detail
+
 namespace security {
 inline namespace v2 {
 
@@ -287,6 +294,22 @@ public: // signing
   void
   sign(Interest& interest, const SigningInfo& params = SigningInfo());
 
+  /**
+   * @brief Configure a DataTemplate to sign its packets according to the supplied signing information
+   *
+   * The signing key and SignatureInfo are selected once, as in sign(Data&, const SigningInfo&).
+   * Every Data subsequently produced by @p tpl is signed with that key, without consulting
+   * the PIB again.
+   *
+   * @param tpl The template to configure
+   * @param params The signing parameters
+   * @throw InvalidSigningInfoError Invalid @p params was specified or the specified identity, key,
+   *                                or certificate does not exist
+   * @warning @p tpl keeps a reference to this KeyChain, which must outlive it.
+   */
+  void
+  prepareTemplate(DataTemplate& tpl, const SigningInfo& params = SigningInfo());
+
   /**
    * @brief Sign buffer according to the supplied signing information @p params
    * @deprecated Sign Interests and Data directly
@@ -306,6 +329,59 @@ public: // signing
   Block
   sign(const uint8_t* buffer, size_t bufferLength, const SigningInfo& params = SigningInfo());
 
+public: // asynchronous signing
+  /**
+   * @brief Callback invoked when asyncSign() has signed a Data packet
+   */
+  using DataSignedCallback = std::function<void(const shared_ptr<Data>& data)>;
+
+  /**
+   * @brief Callback invoked when asyncSign() has failed to sign a Data packet
+   */
+  using SignFailureCallback = std::function<void(const std::string& reason)>;
+
+  /**
+   * @brief Configure the thread pool used by asyncSign()
+   *
+   * Jobs that are already queued are completed before the previous pool is destroyed.
+   * This call blocks until they are, so it should not be invoked from a thread that must
+   * remain responsive while many packets are pending.
+   *
+   * @param nThreads number of signing threads, must be positive
+   * @param maxPending maximum number of packets that are being signed or waiting to be signed;
+   *                   asyncSign() refuses new packets when this limit is reached
+   * @throw std::invalid_argument @p nThreads or @p maxPending is zero
+   */
+  void
+  setSigningThreads(size_t nThreads, size_t maxPending = 1024);
+
+  /**
+   * @brief Sign a Data packet on a signing thread
+   *
+   * The signing key and SignatureInfo are selected on the calling thread, as in
+   * sign(Data&, const SigningInfo&), and the unsigned portion of @p data is encoded.
+   * The signature is then computed on a signing thread, so that the calling thread, e.g.,
+   * a Face event loop, is not blocked by the private key operation. Finally, @p onSigned
+   * or @p onFailure is posted to @p io.
+   *
+   * If setSigningThreads() has not been called, a pool with one thread is created.
+   *
+   * @param data The data to sign; it must not be accessed until a callback is invoked
+   * @param params The signing parameters
+   * @param io The io_service on which the callback is invoked
+   * @param onSigned Callback invoked with the signed @p data
+   * @param onFailure Callback invoked if the TPM could not sign @p data
+   * @return true if signing has been scheduled; false if the signing queue is full, in which
+   *         case neither callback is invoked and the caller should retry later
+   * @throw InvalidSigningInfoError Invalid @p params was specified or the specified identity,
+   *                                key, or certificate does not exist
+   * @note The TPM back-end must support concurrent signing with the same key. This is true for
+   *       the file-based and in-memory TPMs.
+   */
+  bool
+  asyncSign(const shared_ptr<Data>& data, const SigningInfo& params, boost::asio::io_service& io,
+            const DataSignedCallback& onSigned, const SignFailureCallback& onFailure);
+
 public: // export & import
   /**
    * @brief Export a certificate and its corresponding private key.
@@ -333,10 +409,49 @@ public: // export & import
    *              - private key cannot be imported;
    *              - a private/public key of the same name already exists;
    *              - a certificate of the same name already exists.
+   *        In that case, neither the PIB nor the TPM is modified.
    */
   void
   importSafeBag(const SafeBag& safeBag, const char* pw, size_t pwLen);
 
+  /**
+   * @brief Export several certificates and their corresponding private keys.
+   *
+   * The private keys are encrypted concurrently, which is considerably faster than calling
+   * exportSafeBag() for each certificate when there are many keys.
+   *
+   * @param certificates The certificates to export.
+   * @param pw The password to secure the private keys.
+   * @param pwLen The length of password.
+   * @param nThreads Number of threads; zero selects the number of hardware threads.
+   * @return SafeBags in the same order as @p certificates.
+   * @throw Error a certificate or private key does not exist
+   * @note The keys are encrypted concurrently only if the TPM back-end gives access to the key
+   *       material, which is true for the file-based and in-memory TPMs. Otherwise, they are
+   *       exported one at a time.
+   */
+  std::vector<shared_ptr<SafeBag>>
+  exportSafeBags(const std::vector<Certificate>& certificates, const char* pw, size_t pwLen,
+                 size_t nThreads = 0);
+
+  /**
+   * @brief Import certificates and their corresponding private keys from several SafeBags.
+   *
+   * All private keys are decrypted concurrently before anything is imported, so that a wrong
+   * password or a corrupted SafeBag leaves the KeyChain unchanged. The SafeBags are then imported
+   * in order, as if by importSafeBag(), within one PIB transaction; if one of them cannot be
+   * imported, the private keys and PIB entries of the preceding ones are removed again.
+   *
+   * @param safeBags The SafeBags to import.
+   * @param pw The password that secures the private keys.
+   * @param pwLen The length of password.
+   * @param nThreads Number of decryption threads; zero selects the number of hardware threads.
+   * @throw Error see importSafeBag()
+   */
+  void
+  importSafeBags(const std::vector<SafeBag>& safeBags, const char* pw, size_t pwLen,
+                 size_t nThreads = 0);
+
   /**
    * @brief Import a private key into the TPM.
    */
@@ -412,6 +527,42 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   static const std::string&
   getDefaultTpmLocator();
 
+private: // import
+  /**
+   * @brief Identities and keys added by importSafeBagImpl().
+   */
+  struct ImportedItems
+  {
+    std::vector<Name> identities; ///< identities that did not exist in the PIB before
+    std::vector<Name> keys;       ///< keys whose private key has been imported into the TPM
+  };
+
+  /**
+   * @brief Import the certificates carried in @p safeBags in one PIB transaction.
+   * @param importKey imports the private key of the i-th certificate into the TPM
+   *
+   * If any of them cannot be imported, the PIB transaction is rolled back, and the imported
+   * private keys and the cached PIB entries are removed, before the error is rethrown.
+   */
+  void
+  importSafeBagsImpl(const SafeBag* safeBags, size_t nSafeBags,
+                     const std::function<void(size_t i, const Name& keyName)>& importKey);
+
+  /**
+   * @brief Import the certificate carried in @p safeBag within the current PIB transaction.
+   * @param importKey imports the private key of the certificate into the TPM
+   * @param[out] imported records what has been added, even if an exception is thrown
+   */
+  void
+  importSafeBagImpl(const SafeBag& safeBag, const std::function<void(const Name& keyName)>& importKey,
+                    ImportedItems& imported);
+
+  /**
+   * @brief Remove what an unsuccessful importSafeBagsImpl() has added.
+   */
+  void
+  undoImport(const ImportedItems& imported) noexcept;
+
 private: // signing
   /**
    * @brief Generate a self-signed certificate for a public key.
@@ -453,6 +604,7 @@ public:
 private:
   std::unique_ptr<Pib> m_pib;
   std::unique_ptr<Tpm> m_tpm;
+  std::unique_ptr<ndn::detail::ThreadPool> m_signingPool; // must be destroyed before m_tpm
 
   static std::string s_defaultPibLocator;
   static std::string s_defaultTpmLocator;
@@ -0,0 +1,228 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/lru-certificate-cache.hpp"
+#include "ndn-cxx/util/logger.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+
+NDN_LOG_INIT(ndn.security.LruCertificateCache);
+
+time::nanoseconds
+LruCertificateCache::getDefaultLifetime()
+{
+  return 1_h;
+}
+
+time::nanoseconds
+LruCertificateCache::getDefaultSweepInterval()
+{
+  return 1_min;
+}
+
+LruCertificateCache::LruCertificateCache(boost::asio::io_service& ioService, size_t limit,
+                                         time::nanoseconds maxLifetime,
+                                         time::nanoseconds sweepInterval)
+  : m_certsByUse(m_certs.get<0>())
+  , m_certsByKeyName(m_certs.get<1>())
+  , m_certsByName(m_certs.get<2>())
+  , m_certsByTime(m_certs.get<3>())
+  , m_limit(limit)
+  , m_maxLifetime(maxLifetime)
+  , m_sweepInterval(sweepInterval)
+  , m_scheduler(ioService)
+{
+  if (limit == 0) {
+    NDN_THROW(std::invalid_argument("Certificate cache limit must be positive"));
+  }
+  if (sweepInterval <= 0_ns) {
+    NDN_THROW(std::invalid_argument("Sweep interval must be positive"));
+  }
+  scheduleSweep();
+}
+
+void
+LruCertificateCache::insert(const Certificate& cert)
+{
+  time::system_clock::TimePoint notAfterTime = cert.getValidityPeriod().getPeriod().second;
+  time::system_clock::TimePoint now = time::system_clock::now();
+  if (notAfterTime < now) {
+    NDN_LOG_DEBUG("Not adding " << cert.getName() << ": already expired at " << time::toIsoString(notAfterTime));
+    return;
+  }
+
+  time::system_clock::TimePoint removalTime = std::min(notAfterTime, now + m_maxLifetime);
+
+  auto it = m_certsByName.find(cert.getName());
+  if (it != m_certsByName.end()) {
+    NDN_LOG_TRACE("Refreshing " << cert.getName());
+    m_certsByName.modify(it, [removalTime] (Entry& entry) { entry.removalTime = removalTime; });
+    m_certsByUse.relocate(m_certsByUse.begin(), m_certs.project<0>(it));
+    return;
+  }
+
+  while (m_certs.size() >= m_limit) {
+    evict();
+  }
+
+  NDN_LOG_DEBUG("Adding " << cert.getName() << ", will remove in "
+                << time::duration_cast<time::seconds>(removalTime - now));
+  m_certsByUse.push_front(Entry(cert, removalTime));
+}
+
+void
+LruCertificateCache::clear()
+{
+  m_certs.clear();
+}
+
+template<typename Predicate>
+LruCertificateCache::CertIndexByUse::const_iterator
+LruCertificateCache::lookup(const Name& prefix, const Predicate& pred) const
+{
+  time::system_clock::TimePoint now = time::system_clock::now();
+  auto isUsable = [&] (const Entry& entry) { return entry.removalTime >= now && pred(entry.cert); };
+
+  // fast path: the prefix is a key name
+  auto range = m_certsByKeyName.equal_range(prefix);
+  auto byKeyName = std::find_if(range.first, range.second, isUsable);
+  if (byKeyName != range.second) {
+    return m_certs.project<0>(byKeyName);
+  }
+
+  // slow path: the prefix is a certificate name or a shorter prefix, e.g., an identity name
+  for (auto i = m_certsByName.lower_bound(prefix);
+       i != m_certsByName.end() && prefix.isPrefixOf(i->getCertName());
+       ++i) {
+    if (isUsable(*i)) {
+      return m_certs.project<0>(i);
+    }
+  }
+  return m_certsByUse.end();
+}
+
+template<typename Predicate>
+const Certificate*
+LruCertificateCache::findImpl(const Name& prefix, const Predicate& pred)
+{
+  auto found = lookup(prefix, pred);
+  if (found == m_certsByUse.end()) {
+    ++m_nMisses;
+    return nullptr;
+  }
+
+  ++m_nHits;
+  m_certsByUse.relocate(m_certsByUse.begin(), found);
+  return &found->cert;
+}
+
+const Certificate*
+LruCertificateCache::find(const Name& certPrefix)
+{
+  if (certPrefix.size() > 0 && certPrefix[-1].isImplicitSha256Digest()) {
+    NDN_LOG_INFO("Certificate search using name with the implicit digest is not yet supported");
+  }
+  return findImpl(certPrefix, [] (const Certificate&) { return true; });
+}
+
+const Certificate*
+LruCertificateCache::find(const Interest& interest)
+{
+  if (interest.getName().size() > 0 && interest.getName()[-1].isImplicitSha256Digest()) {
+    NDN_LOG_INFO("Certificate search using name with implicit digest is not yet supported");
+  }
+  return findImpl(interest.getName(), [&interest] (const Certificate& cert) {
+    return interest.matchesData(cert);
+  });
+}
+
+const Certificate*
+LruCertificateCache::peek(const Name& certPrefix) const
+{
+  auto found = lookup(certPrefix, [] (const Certificate&) { return true; });
+  return found == m_certsByUse.end() ? nullptr : &found->cert;
+}
+
+const Certificate*
+LruCertificateCache::peek(const Interest& interest) const
+{
+  auto found = lookup(interest.getName(), [&interest] (const Certificate& cert) {
+    return interest.matchesData(cert);
+  });
+  return found == m_certsByUse.end() ? nullptr : &found->cert;
+}
+
+void
+LruCertificateCache::sweep()
+{
+  time::system_clock::TimePoint now = time::system_clock::now();
+
+  auto end = m_certsByTime.lower_bound(now);
+  size_t nErased = std::distance(m_certsByTime.begin(), end);
+  m_certsByTime.erase(m_certsByTime.begin(), end);
+  if (nErased > 0) {
+    NDN_LOG_DEBUG("Removed " << nErased << " expired certificates");
+  }
+}
+
+void
+LruCertificateCache::setLimit(size_t limit)
+{
+  if (limit == 0) {
+    NDN_THROW(std::invalid_argument("Certificate cache limit must be positive"));
+  }
+  m_limit = limit;
+  while (m_certs.size() > m_limit) {
+    evict();
+  }
+}
+
+void
+LruCertificateCache::resetCounters()
+{
+  m_nHits = 0;
+  m_nMisses = 0;
+  m_nEvictions = 0;
+}
+
+void
+LruCertificateCache::scheduleSweep()
+{
+  m_sweepEvent = m_scheduler.schedule(m_sweepInterval, [this] {
+    sweep();
+    scheduleSweep();
+  });
+}
+
+void
+LruCertificateCache::evict()
+{
+  BOOST_ASSERT(!m_certs.empty());
+  NDN_LOG_DEBUG("Evicting " << m_certsByUse.back().getCertName());
+  m_certsByUse.pop_back();
+  ++m_nEvictions;
+}
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
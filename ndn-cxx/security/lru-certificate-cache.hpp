@@ -0,0 +1,272 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_SECURITY_LRU_CERTIFICATE_CACHE_HPP
+#define NDN_SECURITY_LRU_CERTIFICATE_CACHE_HPP
+
+#include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/security/certificate.hpp"
+#include "ndn-cxx/util/scheduler.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/mem_fun.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+
+/**
+ * @brief Represents a bounded container for certificates, optimized for large caches.
+ *
+ * Compared with CertificateCache, this container:
+ * - looks up certificates by key name, the common case during validation, with a hash index;
+ * - removes expired certificates in a periodic sweep driven by a Scheduler, instead of on
+ *   every insert and lookup (expired certificates are never returned by lookups);
+ * - holds at most a configurable number of certificates, evicting the least recently used
+ *   certificate when the limit is reached;
+ * - counts lookup hits and misses.
+ *
+ * As in CertificateCache, a certificate is removed no later than its NotAfter time, or
+ * maxLifetime after it has been added to the cache.
+ */
+class LruCertificateCache : noncopyable
+{
+public:
+  /**
+   * @brief Create a certificate cache.
+   *
+   * @param ioService     io_service on which the expiry sweep is scheduled
+   * @param limit         maximum number of certificates in the cache, must be positive
+   * @param maxLifetime   maximum time that certificates could live inside cache
+   * @param sweepInterval interval between two consecutive sweeps of expired certificates
+   * @throw std::invalid_argument @p limit is zero or @p sweepInterval is not positive
+   */
+  LruCertificateCache(boost::asio::io_service& ioService, size_t limit,
+                      time::nanoseconds maxLifetime = getDefaultLifetime(),
+                      time::nanoseconds sweepInterval = getDefaultSweepInterval());
+
+  /**
+   * @brief Insert certificate into cache.
+   *
+   * If a certificate with the same name is already in the cache, its removal time is updated.
+   * If the cache is full, the least recently used certificate is evicted.
+   */
+  void
+  insert(const Certificate& cert);
+
+  /**
+   * @brief Remove all certificates from cache.
+   */
+  void
+  clear();
+
+  /**
+   * @brief Get certificate given key name, certificate name, or other certificate prefix.
+   * @return The found certificate, nullptr if not found.
+   *
+   * @note The returned value may be invalidated by the next insert or expiry sweep.
+   */
+  const Certificate*
+  find(const Name& certPrefix);
+
+  /**
+   * @brief Find certificate given interest.
+   * @return The found certificate that matches the interest, nullptr if not found.
+   *
+   * @note The returned value may be invalidated by the next insert or expiry sweep.
+   */
+  const Certificate*
+  find(const Interest& interest);
+
+  /**
+   * @brief Get certificate given key name, certificate name, or other certificate prefix,
+   *        without affecting the eviction order or the hit and miss counters.
+   * @return The found certificate, nullptr if not found.
+   *
+   * @note The returned value may be invalidated by the next insert or expiry sweep.
+   */
+  const Certificate*
+  peek(const Name& certPrefix) const;
+
+  /**
+   * @brief Find certificate given interest, without affecting the eviction order or the hit
+   *        and miss counters.
+   * @return The found certificate that matches the interest, nullptr if not found.
+   *
+   * @note The returned value may be invalidated by the next insert or expiry sweep.
+   */
+  const Certificate*
+  peek(const Interest& interest) const;
+
+  /**
+   * @brief Remove all outdated certificate entries.
+   *
+   * This is invoked periodically, but can also be invoked explicitly.
+   */
+  void
+  sweep();
+
+  size_t
+  size() const
+  {
+    return m_certs.size();
+  }
+
+  size_t
+  getLimit() const
+  {
+    return m_limit;
+  }
+
+  /**
+   * @brief Change the maximum number of certificates, evicting certificates if necessary.
+   * @throw std::invalid_argument @p limit is zero
+   */
+  void
+  setLimit(size_t limit);
+
+  /**
+   * @return number of lookups that returned a certificate
+   */
+  uint64_t
+  getNHits() const
+  {
+    return m_nHits;
+  }
+
+  /**
+   * @return number of lookups that did not return a certificate
+   */
+  uint64_t
+  getNMisses() const
+  {
+    return m_nMisses;
+  }
+
+  /**
+   * @return number of certificates evicted because the cache was full
+   */
+  uint64_t
+  getNEvictions() const
+  {
+    return m_nEvictions;
+  }
+
+  /**
+   * @brief Reset the hit, miss, and eviction counters to zero.
+   */
+  void
+  resetCounters();
+
+public:
+  static time::nanoseconds
+  getDefaultLifetime();
+
+  static time::nanoseconds
+  getDefaultSweepInterval();
+
+private:
+  class Entry
+  {
+  public:
+    Entry(const Certificate& cert, const time::system_clock::TimePoint& removalTime)
+      : cert(cert)
+      , keyName(cert.getKeyName())
+      , removalTime(removalTime)
+    {
+    }
+
+    const Name&
+    getCertName() const
+    {
+      return cert.getName();
+    }
+
+  public:
+    Certificate cert;
+    Name keyName;
+    time::system_clock::TimePoint removalTime;
+  };
+
+  using CertIndex = boost::multi_index::multi_index_container<
+    Entry,
+    boost::multi_index::indexed_by<
+      boost::multi_index::sequenced<>,
+      boost::multi_index::hashed_non_unique<
+        boost::multi_index::member<Entry, Name, &Entry::keyName>,
+        std::hash<Name>
+      >,
+      boost::multi_index::ordered_unique<
+        boost::multi_index::const_mem_fun<Entry, const Name&, &Entry::getCertName>
+      >,
+      boost::multi_index::ordered_non_unique<
+        boost::multi_index::member<Entry, time::system_clock::TimePoint, &Entry::removalTime>
+      >
+    >
+  >;
+
+  using CertIndexByUse = CertIndex::nth_index<0>::type;
+  using CertIndexByKeyName = CertIndex::nth_index<1>::type;
+  using CertIndexByName = CertIndex::nth_index<2>::type;
+  using CertIndexByTime = CertIndex::nth_index<3>::type;
+
+  template<typename Predicate>
+  CertIndexByUse::const_iterator
+  lookup(const Name& prefix, const Predicate& pred) const;
+
+  template<typename Predicate>
+  const Certificate*
+  findImpl(const Name& prefix, const Predicate& pred);
+
+  void
+  scheduleSweep();
+
+  void
+  evict();
+
+private:
+  CertIndex m_certs;
+  CertIndexByUse& m_certsByUse;
+  CertIndexByKeyName& m_certsByKeyName;
+  CertIndexByName& m_certsByName;
+  CertIndexByTime& m_certsByTime;
+
+  size_t m_limit;
+  time::nanoseconds m_maxLifetime;
+  time::nanoseconds m_sweepInterval;
+
+  uint64_t m_nHits = 0;
+  uint64_t m_nMisses = 0;
+  uint64_t m_nEvictions = 0;
+
+  Scheduler m_scheduler;
+  scheduler::ScopedEventId m_sweepEvent;
+};
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_SECURITY_LRU_CERTIFICATE_CACHE_HPP
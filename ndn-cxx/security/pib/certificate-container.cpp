@@ -157,6 +157,15 @@ CertificateContainer::get(const Name& certName) const
   return m_certs[certName];
 }
 
+void
+CertificateContainer::prefetch() const
+{
+  for (auto& cert : m_pib->getCertificatesDataOfKey(m_keyName)) {
+    Name certName = cert.getName();
+    m_certs[certName] = std::move(cert);
+  }
+}
+
 bool
 CertificateContainer::isConsistent() const
 {
@@ -120,6 +120,15 @@ public:
   v2::Certificate
   get(const Name& certName) const;
 
+  /**
+   * @brief Load all certificates of the key from the backend with a single query
+   *
+   * Afterwards, iterating over the container and get() do not access the backend for the
+   * certificates that were loaded.
+   */
+  void
+  prefetch() const;
+
   /**
    * @brief Check if the container is consistent with the backend storage
    * @note this method is heavyweight and should be used in debugging mode only.
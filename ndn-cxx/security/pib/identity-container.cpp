@@ -129,6 +129,22 @@ IdentityContainer::remove(const Name& identityName)
   m_pibImpl->removeIdentity(identityName);
 }
 
+void
+IdentityContainer::forget(const Name& identityName)
+{
+  m_identityNames.erase(identityName);
+  m_identities.erase(identityName);
+}
+
+void
+IdentityContainer::forgetKey(const Name& keyName)
+{
+  auto it = m_identities.find(v2::extractIdentityFromKeyName(keyName));
+  if (it != m_identities.end()) {
+    it->second->forgetKey(keyName);
+  }
+}
+
 Identity
 IdentityContainer::get(const Name& identityName) const
 {
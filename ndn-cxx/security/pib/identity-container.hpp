@@ -154,6 +154,19 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     return m_identities;
   }
 
+private:
+  /**
+   * @brief Drop @p identity from the container without touching the backend
+   */
+  void
+  forget(const Name& identity);
+
+  /**
+   * @brief Drop the key with @p keyName from its loaded identity without touching the backend
+   */
+  void
+  forgetKey(const Name& keyName);
+
 private:
   std::set<Name> m_identityNames;
   /// @brief Cache of loaded detail::IdentityImpl.
@@ -62,6 +62,14 @@ IdentityImpl::removeKey(const Name& keyName)
   m_keys.remove(keyName);
 }
 
+void
+IdentityImpl::forgetKey(const Name& keyName)
+{
+  // the default key may have changed along with the backend
+  m_isDefaultKeyLoaded = false;
+  m_keys.forget(keyName);
+}
+
 Key
 IdentityImpl::getKey(const Name& keyName) const
 {
@@ -81,6 +81,12 @@ public:
   void
   removeKey(const Name& keyName);
 
+  /**
+   * @brief Drop the cached state of the key with @p keyName without touching the backend
+   */
+  void
+  forgetKey(const Name& keyName);
+
   /**
    * @brief Get a key with id @p keyName.
    *
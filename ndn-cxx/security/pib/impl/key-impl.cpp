@@ -67,6 +67,21 @@ KeyImpl::KeyImpl(const Name& keyName, shared_ptr<PibImpl> pibImpl)
   m_keyType = key.getKeyType();
 }
 
+KeyImpl::KeyImpl(const Name& keyName, Buffer keyBits, shared_ptr<PibImpl> pibImpl)
+  : m_identity(v2::extractIdentityFromKeyName(keyName))
+  , m_keyName(keyName)
+  , m_key(std::move(keyBits))
+  , m_pib(std::move(pibImpl))
+  , m_certificates(keyName, m_pib)
+  , m_isDefaultCertificateLoaded(false)
+{
+  BOOST_ASSERT(m_pib != nullptr);
+
+  transform::PublicKey key;
+  key.loadPkcs8(m_key.data(), m_key.size());
+  m_keyType = key.getKeyType();
+}
+
 void
 KeyImpl::addCertificate(const v2::Certificate& certificate)
 {
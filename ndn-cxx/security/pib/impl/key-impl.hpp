@@ -67,6 +67,17 @@ public:
    */
   KeyImpl(const Name& keyName, shared_ptr<PibImpl> pibImpl);
 
+  /**
+   * @brief Create a KeyImpl with @p keyName from key bits already retrieved from the backend.
+   *
+   * The key is not added to the backend.
+   *
+   * @param keyName The name of the key.
+   * @param keyBits The public key, as stored in the backend.
+   * @param pibImpl The Pib backend implementation.
+   */
+  KeyImpl(const Name& keyName, Buffer keyBits, shared_ptr<PibImpl> pibImpl);
+
   /**
    * @brief Get the name of the key.
    */
@@ -26,6 +26,8 @@
 
 #include <sqlite3.h>
 
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
 #include <boost/filesystem.hpp>
 
 namespace ndn {
@@ -190,7 +192,66 @@ CREATE TRIGGER IF NOT EXISTS
   END;
 )SQL";
 
+static std::string
+getLocationPath(const std::string& location)
+{
+  return location.substr(0, location.find('?'));
+}
+
+static PibSqlite3::Options
+parseLocationOptions(const std::string& location)
+{
+  PibSqlite3::Options options;
+  size_t pos = location.find('?');
+  if (pos == std::string::npos) {
+    return options;
+  }
+
+  std::vector<std::string> params;
+  boost::split(params, location.substr(pos + 1), boost::is_any_of("&"));
+  for (const auto& param : params) {
+    size_t eq = param.find('=');
+    std::string key = param.substr(0, eq);
+    std::string value = eq == std::string::npos ? "" : param.substr(eq + 1);
+
+    auto parseFlag = [&] {
+      if (value != "0" && value != "1") {
+        NDN_THROW(PibImpl::Error("PIB locator parameter `" + key + "` must be 0 or 1"));
+      }
+      return value == "1";
+    };
+
+    if (key == "wal") {
+      options.useWal = parseFlag();
+    }
+    else if (key == "read-only") {
+      options.isReadOnly = parseFlag();
+    }
+    else if (key == "busy-timeout") {
+      if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos) {
+        NDN_THROW(PibImpl::Error("PIB locator parameter `busy-timeout` must be a number"));
+      }
+      try {
+        options.busyTimeout = time::milliseconds(std::stoi(value));
+      }
+      catch (const std::logic_error&) { // std::invalid_argument or std::out_of_range
+        NDN_THROW_NESTED(PibImpl::Error("PIB locator parameter `busy-timeout` is out of range"));
+      }
+    }
+    else {
+      NDN_THROW(PibImpl::Error("Unrecognized PIB locator parameter `" + key + "`"));
+    }
+  }
+  return options;
+}
+
 PibSqlite3::PibSqlite3(const std::string& location)
+  : PibSqlite3(getLocationPath(location), parseLocationOptions(location))
+{
+}
+
+PibSqlite3::PibSqlite3(const std::string& location, const Options& options)
+  : m_isReadOnly(options.isReadOnly)
 {
   // Determine the path of PIB DB
   boost::filesystem::path dbDir;
@@ -208,11 +269,14 @@ PibSqlite3::PibSqlite3(const std::string& location)
   else {
     dbDir = boost::filesystem::current_path() / ".ndn";
   }
-  boost::filesystem::create_directories(dbDir);
+  if (!m_isReadOnly) {
+    boost::filesystem::create_directories(dbDir);
+  }
 
   // Open PIB
-  int result = sqlite3_open_v2((dbDir / "pib.db").c_str(), &m_database,
-                               SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE,
+  int flags = m_isReadOnly ? (SQLITE_OPEN_READONLY | SQLITE_OPEN_SHAREDCACHE)
+                           : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+  int result = sqlite3_open_v2((dbDir / "pib.db").c_str(), &m_database, flags,
 #ifdef NDN_CXX_DISABLE_SQLITE3_FS_LOCKING
                                "unix-dotfile"
 #else
@@ -221,24 +285,44 @@ PibSqlite3::PibSqlite3(const std::string& location)
                                );
 
   if (result != SQLITE_OK) {
+    sqlite3_close(m_database);
     NDN_THROW(PibImpl::Error("PIB database cannot be opened/created in " + dbDir.string()));
   }
 
+  if (options.busyTimeout > time::milliseconds::zero()) {
+    sqlite3_busy_timeout(m_database, static_cast<int>(options.busyTimeout.count()));
+  }
+
   // enable foreign key
   sqlite3_exec(m_database, "PRAGMA foreign_keys=ON", nullptr, nullptr, nullptr);
 
-  // initialize PIB tables
-  char* errmsg = nullptr;
-  result = sqlite3_exec(m_database, INITIALIZATION.c_str(), nullptr, nullptr, &errmsg);
-  if (result != SQLITE_OK && errmsg != nullptr) {
-    std::string what = "PIB database cannot be initialized: "s + errmsg;
-    sqlite3_free(errmsg);
-    NDN_THROW(PibImpl::Error(what));
+  if (!m_isReadOnly) {
+    if (options.useWal) {
+      // NORMAL synchronization is safe in WAL mode and avoids an fsync on every commit
+      sqlite3_exec(m_database, "PRAGMA journal_mode=WAL", nullptr, nullptr, nullptr);
+      sqlite3_exec(m_database, "PRAGMA synchronous=NORMAL", nullptr, nullptr, nullptr);
+    }
+
+    // initialize PIB tables
+    char* errmsg = nullptr;
+    result = sqlite3_exec(m_database, INITIALIZATION.c_str(), nullptr, nullptr, &errmsg);
+    if (result != SQLITE_OK && errmsg != nullptr) {
+      std::string what = "PIB database cannot be initialized: "s + errmsg;
+      sqlite3_free(errmsg);
+      sqlite3_close(m_database);
+      NDN_THROW(PibImpl::Error(what));
+    }
   }
+
+  m_statements = make_unique<util::Sqlite3StatementCache>(m_database);
 }
 
 PibSqlite3::~PibSqlite3()
 {
+  if (m_transactionDepth > 0 && !m_isRollbackOnly) {
+    sqlite3_exec(m_database, "ROLLBACK", nullptr, nullptr, nullptr);
+  }
+  m_statements.reset(); // cached statements must be finalized before closing the database
   sqlite3_close(m_database);
 }
 
@@ -252,13 +336,15 @@ PibSqlite3::getScheme()
 void
 PibSqlite3::setTpmLocator(const std::string& tpmLocator)
 {
-  Sqlite3Statement statement(m_database, "UPDATE tpmInfo SET tpm_locator=?");
+  ensureWritable();
+
+  Sqlite3Statement statement(*m_statements, "UPDATE tpmInfo SET tpm_locator=?");
   statement.bind(1, tpmLocator, SQLITE_TRANSIENT);
   statement.step();
 
   if (sqlite3_changes(m_database) == 0) {
     // no row is updated, tpm_locator does not exist, insert it directly
-    Sqlite3Statement insertStatement(m_database, "INSERT INTO tpmInfo (tpm_locator) values (?)");
+    Sqlite3Statement insertStatement(*m_statements, "INSERT INTO tpmInfo (tpm_locator) values (?)");
     insertStatement.bind(1, tpmLocator, SQLITE_TRANSIENT);
     insertStatement.step();
   }
@@ -267,7 +353,7 @@ PibSqlite3::setTpmLocator(const std::string& tpmLocator)
 std::string
 PibSqlite3::getTpmLocator() const
 {
-  Sqlite3Statement statement(m_database, "SELECT tpm_locator FROM tpmInfo");
+  Sqlite3Statement statement(*m_statements, "SELECT tpm_locator FROM tpmInfo");
   int res = statement.step();
   if (res == SQLITE_ROW)
     return statement.getString(0);
@@ -278,7 +364,7 @@ PibSqlite3::getTpmLocator() const
 bool
 PibSqlite3::hasIdentity(const Name& identity) const
 {
-  Sqlite3Statement statement(m_database, "SELECT id FROM identities WHERE identity=?");
+  Sqlite3Statement statement(*m_statements, "SELECT id FROM identities WHERE identity=?");
   statement.bind(1, identity.wireEncode(), SQLITE_TRANSIENT);
   return statement.step() == SQLITE_ROW;
 }
@@ -286,8 +372,10 @@ PibSqlite3::hasIdentity(const Name& identity) const
 void
 PibSqlite3::addIdentity(const Name& identity)
 {
+  ensureWritable();
+
   if (!hasIdentity(identity)) {
-    Sqlite3Statement statement(m_database, "INSERT INTO identities (identity) values (?)");
+    Sqlite3Statement statement(*m_statements, "INSERT INTO identities (identity) values (?)");
     statement.bind(1, identity.wireEncode(), SQLITE_TRANSIENT);
     statement.step();
   }
@@ -300,7 +388,9 @@ PibSqlite3::addIdentity(const Name& identity)
 void
 PibSqlite3::removeIdentity(const Name& identity)
 {
-  Sqlite3Statement statement(m_database, "DELETE FROM identities WHERE identity=?");
+  ensureWritable();
+
+  Sqlite3Statement statement(*m_statements, "DELETE FROM identities WHERE identity=?");
   statement.bind(1, identity.wireEncode(), SQLITE_TRANSIENT);
   statement.step();
 }
@@ -308,7 +398,9 @@ PibSqlite3::removeIdentity(const Name& identity)
 void
 PibSqlite3::clearIdentities()
 {
-  Sqlite3Statement statement(m_database, "DELETE FROM identities");
+  ensureWritable();
+
+  Sqlite3Statement statement(*m_statements, "DELETE FROM identities");
   statement.step();
 }
 
@@ -316,7 +408,7 @@ std::set<Name>
 PibSqlite3::getIdentities() const
 {
   std::set<Name> identities;
-  Sqlite3Statement statement(m_database, "SELECT identity FROM identities");
+  Sqlite3Statement statement(*m_statements, "SELECT identity FROM identities");
 
   while (statement.step() == SQLITE_ROW)
     identities.insert(Name(statement.getBlock(0)));
@@ -327,10 +419,12 @@ PibSqlite3::getIdentities() const
 void
 PibSqlite3::setDefaultIdentity(const Name& identityName)
 {
+  ensureWritable();
+
   if (!hasIdentity(identityName)) {
     NDN_THROW(Pib::Error("Cannot set non-existing identity `" + identityName.toUri() + "` as default"));
   }
-  Sqlite3Statement statement(m_database, "UPDATE identities SET is_default=1 WHERE identity=?");
+  Sqlite3Statement statement(*m_statements, "UPDATE identities SET is_default=1 WHERE identity=?");
   statement.bind(1, identityName.wireEncode(), SQLITE_TRANSIENT);
   statement.step();
 }
@@ -338,7 +432,7 @@ PibSqlite3::setDefaultIdentity(const Name& identityName)
 Name
 PibSqlite3::getDefaultIdentity() const
 {
-  Sqlite3Statement statement(m_database, "SELECT identity FROM identities WHERE is_default=1");
+  Sqlite3Statement statement(*m_statements, "SELECT identity FROM identities WHERE is_default=1");
 
   if (statement.step() == SQLITE_ROW)
     return Name(statement.getBlock(0));
@@ -349,14 +443,14 @@ PibSqlite3::getDefaultIdentity() const
 bool
 PibSqlite3::hasDefaultIdentity() const
 {
-  Sqlite3Statement statement(m_database, "SELECT identity FROM identities WHERE is_default=1");
+  Sqlite3Statement statement(*m_statements, "SELECT identity FROM identities WHERE is_default=1");
   return (statement.step() == SQLITE_ROW);
 }
 
 bool
 PibSqlite3::hasKey(const Name& keyName) const
 {
-  Sqlite3Statement statement(m_database, "SELECT id FROM keys WHERE key_name=?");
+  Sqlite3Statement statement(*m_statements, "SELECT id FROM keys WHERE key_name=?");
   statement.bind(1, keyName.wireEncode(), SQLITE_TRANSIENT);
 
   return (statement.step() == SQLITE_ROW);
@@ -366,11 +460,13 @@ void
 PibSqlite3::addKey(const Name& identity, const Name& keyName,
                    const uint8_t* key, size_t keyLen)
 {
+  ensureWritable();
+
   // ensure identity exists
   addIdentity(identity);
 
   if (!hasKey(keyName)) {
-    Sqlite3Statement statement(m_database,
+    Sqlite3Statement statement(*m_statements,
                                "INSERT INTO keys (identity_id, key_name, key_bits) "
                                "VALUES ((SELECT id FROM identities WHERE identity=?), ?, ?)");
     statement.bind(1, identity.wireEncode(), SQLITE_TRANSIENT);
@@ -379,7 +475,7 @@ PibSqlite3::addKey(const Name& identity, const Name& keyName,
     statement.step();
   }
   else {
-    Sqlite3Statement statement(m_database,
+    Sqlite3Statement statement(*m_statements,
                                "UPDATE keys SET key_bits=? WHERE key_name=?");
     statement.bind(1, key, keyLen, SQLITE_STATIC);
     statement.bind(2, keyName.wireEncode(), SQLITE_TRANSIENT);
@@ -394,7 +490,9 @@ PibSqlite3::addKey(const Name& identity, const Name& keyName,
 void
 PibSqlite3::removeKey(const Name& keyName)
 {
-  Sqlite3Statement statement(m_database, "DELETE FROM keys WHERE key_name=?");
+  ensureWritable();
+
+  Sqlite3Statement statement(*m_statements, "DELETE FROM keys WHERE key_name=?");
   statement.bind(1, keyName.wireEncode(), SQLITE_TRANSIENT);
   statement.step();
 }
@@ -402,7 +500,7 @@ PibSqlite3::removeKey(const Name& keyName)
 Buffer
 PibSqlite3::getKeyBits(const Name& keyName) const
 {
-  Sqlite3Statement statement(m_database, "SELECT key_bits FROM keys WHERE key_name=?");
+  Sqlite3Statement statement(*m_statements, "SELECT key_bits FROM keys WHERE key_name=?");
   statement.bind(1, keyName.wireEncode(), SQLITE_TRANSIENT);
 
   if (statement.step() == SQLITE_ROW)
@@ -416,7 +514,7 @@ PibSqlite3::getKeysOfIdentity(const Name& identity) const
 {
   std::set<Name> keyNames;
 
-  Sqlite3Statement statement(m_database,
+  Sqlite3Statement statement(*m_statements,
                              "SELECT key_name "
                              "FROM keys JOIN identities ON keys.identity_id=identities.id "
                              "WHERE identities.identity=?");
@@ -432,11 +530,13 @@ PibSqlite3::getKeysOfIdentity(const Name& identity) const
 void
 PibSqlite3::setDefaultKeyOfIdentity(const Name& identity, const Name& keyName)
 {
+  ensureWritable();
+
   if (!hasKey(keyName)) {
     NDN_THROW(Pib::Error("Key `" + keyName.toUri() + "` does not exist"));
   }
 
-  Sqlite3Statement statement(m_database, "UPDATE keys SET is_default=1 WHERE key_name=?");
+  Sqlite3Statement statement(*m_statements, "UPDATE keys SET is_default=1 WHERE key_name=?");
   statement.bind(1, keyName.wireEncode(), SQLITE_TRANSIENT);
   statement.step();
 }
@@ -448,7 +548,7 @@ PibSqlite3::getDefaultKeyOfIdentity(const Name& identity) const
     NDN_THROW(Pib::Error("Identity `" + identity.toUri() + "` does not exist"));
   }
 
-  Sqlite3Statement statement(m_database,
+  Sqlite3Statement statement(*m_statements,
                              "SELECT key_name "
                              "FROM keys JOIN identities ON keys.identity_id=identities.id "
                              "WHERE identities.identity=? AND keys.is_default=1");
@@ -464,7 +564,7 @@ PibSqlite3::getDefaultKeyOfIdentity(const Name& identity) const
 bool
 PibSqlite3::hasDefaultKeyOfIdentity(const Name& identity) const
 {
-  Sqlite3Statement statement(m_database,
+  Sqlite3Statement statement(*m_statements,
                              "SELECT key_name "
                              "FROM keys JOIN identities ON keys.identity_id=identities.id "
                              "WHERE identities.identity=? AND keys.is_default=1");
@@ -476,7 +576,7 @@ PibSqlite3::hasDefaultKeyOfIdentity(const Name& identity) const
 bool
 PibSqlite3::hasCertificate(const Name& certName) const
 {
-  Sqlite3Statement statement(m_database, "SELECT id FROM certificates WHERE certificate_name=?");
+  Sqlite3Statement statement(*m_statements, "SELECT id FROM certificates WHERE certificate_name=?");
   statement.bind(1, certName.wireEncode(), SQLITE_TRANSIENT);
   return (statement.step() == SQLITE_ROW);
 }
@@ -484,12 +584,14 @@ PibSqlite3::hasCertificate(const Name& certName) const
 void
 PibSqlite3::addCertificate(const v2::Certificate& certificate)
 {
+  ensureWritable();
+
   // ensure key exists
   const Block& content = certificate.getContent();
   addKey(certificate.getIdentity(), certificate.getKeyName(), content.value(), content.value_size());
 
   if (!hasCertificate(certificate.getName())) {
-    Sqlite3Statement statement(m_database,
+    Sqlite3Statement statement(*m_statements,
                                "INSERT INTO certificates "
                                "(key_id, certificate_name, certificate_data) "
                                "VALUES ((SELECT id FROM keys WHERE key_name=?), ?, ?)");
@@ -499,7 +601,7 @@ PibSqlite3::addCertificate(const v2::Certificate& certificate)
     statement.step();
   }
   else {
-    Sqlite3Statement statement(m_database,
+    Sqlite3Statement statement(*m_statements,
                                "UPDATE certificates SET certificate_data=? WHERE certificate_name=?");
     statement.bind(1, certificate.wireEncode(), SQLITE_STATIC);
     statement.bind(2, certificate.getName().wireEncode(), SQLITE_TRANSIENT);
@@ -514,7 +616,9 @@ PibSqlite3::addCertificate(const v2::Certificate& certificate)
 void
 PibSqlite3::removeCertificate(const Name& certName)
 {
-  Sqlite3Statement statement(m_database, "DELETE FROM certificates WHERE certificate_name=?");
+  ensureWritable();
+
+  Sqlite3Statement statement(*m_statements, "DELETE FROM certificates WHERE certificate_name=?");
   statement.bind(1, certName.wireEncode(), SQLITE_TRANSIENT);
   statement.step();
 }
@@ -522,7 +626,7 @@ PibSqlite3::removeCertificate(const Name& certName)
 v2::Certificate
 PibSqlite3::getCertificate(const Name& certName) const
 {
-  Sqlite3Statement statement(m_database,
+  Sqlite3Statement statement(*m_statements,
                              "SELECT certificate_data FROM certificates WHERE certificate_name=?");
   statement.bind(1, certName.wireEncode(), SQLITE_TRANSIENT);
 
@@ -537,7 +641,7 @@ PibSqlite3::getCertificatesOfKey(const Name& keyName) const
 {
   std::set<Name> certNames;
 
-  Sqlite3Statement statement(m_database,
+  Sqlite3Statement statement(*m_statements,
                              "SELECT certificate_name "
                              "FROM certificates JOIN keys ON certificates.key_id=keys.id "
                              "WHERE keys.key_name=?");
@@ -552,11 +656,13 @@ PibSqlite3::getCertificatesOfKey(const Name& keyName) const
 void
 PibSqlite3::setDefaultCertificateOfKey(const Name& keyName, const Name& certName)
 {
+  ensureWritable();
+
   if (!hasCertificate(certName)) {
     NDN_THROW(Pib::Error("Certificate `" + certName.toUri() + "` does not exist"));
   }
 
-  Sqlite3Statement statement(m_database,
+  Sqlite3Statement statement(*m_statements,
                              "UPDATE certificates SET is_default=1 WHERE certificate_name=?");
   statement.bind(1, certName.wireEncode(), SQLITE_TRANSIENT);
   statement.step();
@@ -565,7 +671,7 @@ PibSqlite3::setDefaultCertificateOfKey(const Name& keyName, const Name& certName
 v2::Certificate
 PibSqlite3::getDefaultCertificateOfKey(const Name& keyName) const
 {
-  Sqlite3Statement statement(m_database,
+  Sqlite3Statement statement(*m_statements,
                              "SELECT certificate_data "
                              "FROM certificates JOIN keys ON certificates.key_id=keys.id "
                              "WHERE certificates.is_default=1 AND keys.key_name=?");
@@ -580,7 +686,7 @@ PibSqlite3::getDefaultCertificateOfKey(const Name& keyName) const
 bool
 PibSqlite3::hasDefaultCertificateOfKey(const Name& keyName) const
 {
-  Sqlite3Statement statement(m_database,
+  Sqlite3Statement statement(*m_statements,
                              "SELECT certificate_data "
                              "FROM certificates JOIN keys ON certificates.key_id=keys.id "
                              "WHERE certificates.is_default=1 AND keys.key_name=?");
@@ -589,6 +695,110 @@ PibSqlite3::hasDefaultCertificateOfKey(const Name& keyName) const
   return statement.step() == SQLITE_ROW;
 }
 
+std::map<Name, Buffer>
+PibSqlite3::getKeyBitsOfIdentity(const Name& identity) const
+{
+  std::map<Name, Buffer> keys;
+
+  Sqlite3Statement statement(*m_statements,
+                             "SELECT key_name, key_bits "
+                             "FROM keys JOIN identities ON keys.identity_id=identities.id "
+                             "WHERE identities.identity=?");
+  statement.bind(1, identity.wireEncode(), SQLITE_TRANSIENT);
+
+  while (statement.step() == SQLITE_ROW) {
+    keys.emplace(Name(statement.getBlock(0)), Buffer(statement.getBlob(1), statement.getSize(1)));
+  }
+
+  return keys;
+}
+
+std::vector<v2::Certificate>
+PibSqlite3::getCertificatesDataOfKey(const Name& keyName) const
+{
+  std::vector<v2::Certificate> certs;
+
+  Sqlite3Statement statement(*m_statements,
+                             "SELECT certificate_data "
+                             "FROM certificates JOIN keys ON certificates.key_id=keys.id "
+                             "WHERE keys.key_name=?");
+  statement.bind(1, keyName.wireEncode(), SQLITE_TRANSIENT);
+
+  while (statement.step() == SQLITE_ROW) {
+    certs.emplace_back(statement.getBlock(0));
+  }
+
+  return certs;
+}
+
+void
+PibSqlite3::beginTransaction()
+{
+  ensureWritable();
+  if (m_transactionDepth == 0) {
+    execute("BEGIN IMMEDIATE");
+    m_isRollbackOnly = false;
+  }
+  ++m_transactionDepth;
+}
+
+void
+PibSqlite3::commitTransaction()
+{
+  BOOST_ASSERT(m_transactionDepth > 0);
+  --m_transactionDepth;
+  if (m_isRollbackOnly) {
+    NDN_THROW(PibImpl::Error("Cannot commit a PIB transaction after an inner rollback"));
+  }
+  if (m_transactionDepth == 0) {
+    try {
+      execute("COMMIT");
+    }
+    catch (const PibImpl::Error&) {
+      // a failed COMMIT may leave the transaction open; make sure nothing gets applied later
+      sqlite3_exec(m_database, "ROLLBACK", nullptr, nullptr, nullptr);
+      throw;
+    }
+  }
+}
+
+void
+PibSqlite3::rollbackTransaction()
+{
+  BOOST_ASSERT(m_transactionDepth > 0);
+  --m_transactionDepth;
+  if (!m_isRollbackOnly) {
+    m_isRollbackOnly = true;
+    execute("ROLLBACK");
+  }
+}
+
+void
+PibSqlite3::ensureWritable() const
+{
+  if (m_isReadOnly) {
+    NDN_THROW(PibImpl::Error("PIB database was opened in read-only mode"));
+  }
+  if (m_isRollbackOnly && m_transactionDepth > 0) {
+    NDN_THROW(PibImpl::Error("PIB transaction has been rolled back"));
+  }
+}
+
+void
+PibSqlite3::execute(const char* sql)
+{
+  char* errmsg = nullptr;
+  int result = sqlite3_exec(m_database, sql, nullptr, nullptr, &errmsg);
+  if (result != SQLITE_OK) {
+    std::string what = "PIB database error on `"s + sql + "`";
+    if (errmsg != nullptr) {
+      what += ": "s + errmsg;
+      sqlite3_free(errmsg);
+    }
+    NDN_THROW(PibImpl::Error(what));
+  }
+}
+
 } // namespace pib
 } // namespace security
 } // namespace ndn
@@ -27,6 +27,10 @@
 struct sqlite3;
 
 namespace ndn {
+namespace util {
+class Sqlite3StatementCache;
+} // namespace util
+
 namespace security {
 namespace pib {
 
@@ -39,6 +43,35 @@ namespace pib {
 class PibSqlite3 : public PibImpl
 {
 public:
+  /**
+   * @brief Options that control how the SQLite3 database is opened
+   */
+  struct Options
+  {
+    /**
+     * @brief Switch the database to write-ahead logging.
+     *
+     * In WAL mode, readers in other processes are not blocked by a writer, and vice versa.
+     * The setting is persistent, so it needs to be applied by a single writable instance only.
+     */
+    bool useWal = false;
+
+    /**
+     * @brief Open an existing database in read-only mode with SQLite shared cache.
+     *
+     * This suits processes that only sign with existing keys. All modifications throw
+     * PibImpl::Error, and the database is neither created nor initialized.
+     */
+    bool isReadOnly = false;
+
+    /**
+     * @brief How long to wait for a lock held by another connection before failing.
+     *
+     * Zero means failing immediately, which is the SQLite default.
+     */
+    time::milliseconds busyTimeout = time::milliseconds::zero();
+  };
+
   /**
    * @brief Create sqlite3-based PIB backed
    *
@@ -48,12 +81,21 @@ public:
    * It is user's responsibility to update the older version database or remove the database.
    *
    * @param location The directory where the database file is located. By default, it points to the
-   *                 $HOME/.ndn directory.
-   * @throw PibImpl::Error when initialization fails.
+   *                 $HOME/.ndn directory. It may be followed by a query string that sets the
+   *                 Options, e.g., `/path/to/dir?wal=1&busy-timeout=500`. Recognized parameters
+   *                 are `wal` and `read-only` (`0` or `1`) and `busy-timeout` (in milliseconds).
+   * @throw PibImpl::Error when initialization fails or the query string is malformed.
    */
   explicit
   PibSqlite3(const std::string& location = "");
 
+  /**
+   * @brief Create sqlite3-based PIB backend with the specified @p options
+   * @sa PibSqlite3(const std::string&)
+   * @throw PibImpl::Error when initialization fails.
+   */
+  PibSqlite3(const std::string& location, const Options& options);
+
   /**
    * @brief Destruct and cleanup internal state
    */
@@ -136,7 +178,34 @@ public: // Certificate Management
   v2::Certificate
   getDefaultCertificateOfKey(const Name& keyName) const final;
 
+public: // Bulk retrieval
+  std::map<Name, Buffer>
+  getKeyBitsOfIdentity(const Name& identity) const final;
+
+  std::vector<v2::Certificate>
+  getCertificatesDataOfKey(const Name& keyName) const final;
+
+public: // Transaction support
+  void
+  beginTransaction() final;
+
+  void
+  commitTransaction() final;
+
+  void
+  rollbackTransaction() final;
+
 private:
+  /**
+   * @throw PibImpl::Error the database was opened in read-only mode, or the current
+   *                       transaction has been rolled back by an inner rollbackTransaction()
+   */
+  void
+  ensureWritable() const;
+
+  void
+  execute(const char* sql);
+
   bool
   hasDefaultIdentity() const;
 
@@ -148,6 +217,10 @@ private:
 
 private:
   sqlite3* m_database;
+  unique_ptr<util::Sqlite3StatementCache> m_statements;
+  bool m_isReadOnly;
+  int m_transactionDepth = 0;
+  bool m_isRollbackOnly = false; ///< an inner transaction has been rolled back
 };
 
 } // namespace pib
@@ -139,6 +139,13 @@ KeyContainer::remove(const Name& keyName)
   m_pib->removeKey(keyName);
 }
 
+void
+KeyContainer::forget(const Name& keyName)
+{
+  m_keyNames.erase(keyName);
+  m_keys.erase(keyName);
+}
+
 Key
 KeyContainer::get(const Name& keyName) const
 {
@@ -161,6 +168,16 @@ KeyContainer::get(const Name& keyName) const
   return Key(key);
 }
 
+void
+KeyContainer::prefetch() const
+{
+  for (auto& key : m_pib->getKeyBitsOfIdentity(m_identity)) {
+    if (m_keys.count(key.first) == 0) {
+      m_keys[key.first] = make_shared<detail::KeyImpl>(key.first, std::move(key.second), m_pib);
+    }
+  }
+}
+
 bool
 KeyContainer::isConsistent() const
 {
@@ -123,6 +123,15 @@ public:
   Key
   get(const Name& keyName) const;
 
+  /**
+   * @brief Load all keys of the identity from the backend with a single query
+   *
+   * Afterwards, iterating over the container and get() do not access the backend for the keys
+   * that were loaded, although each Key still loads its certificates on demand.
+   */
+  void
+  prefetch() const;
+
   /**
    * @brief Check if the container is consistent with the backend storage
    *
@@ -150,6 +159,16 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     return m_keys;
   }
 
+private:
+  /**
+   * @brief Drop @p keyName from the container without touching the backend
+   *
+   * Used when the key has already disappeared from the backend, e.g., because the
+   * PIB transaction that added it was rolled back.
+   */
+  void
+  forget(const Name& keyName);
+
 private:
   Name m_identity;
   std::set<Name> m_keyNames;
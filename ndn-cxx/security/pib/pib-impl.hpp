@@ -25,7 +25,9 @@
 #include "ndn-cxx/security/pib/pib.hpp"
 #include "ndn-cxx/security/certificate.hpp"
 
+#include <map>
 #include <set>
+#include <vector>
 
 namespace ndn {
 namespace security {
@@ -274,6 +276,79 @@ public: // Certificate Management
    */
   virtual v2::Certificate
   getDefaultCertificateOfKey(const Name& keyName) const = 0;
+
+public: // Bulk retrieval
+  /**
+   * @brief Get the bits of all keys of an identity with name @p identity.
+   *
+   * The default implementation calls getKeyBits() for each name returned by getKeysOfIdentity();
+   * backends should override it with a single query.
+   *
+   * @return A map from key name to key bits. If the identity does not exist, return an empty map.
+   */
+  virtual std::map<Name, Buffer>
+  getKeyBitsOfIdentity(const Name& identity) const
+  {
+    std::map<Name, Buffer> keys;
+    for (const auto& keyName : getKeysOfIdentity(identity)) {
+      keys.emplace(keyName, getKeyBits(keyName));
+    }
+    return keys;
+  }
+
+  /**
+   * @brief Get all certificates of a key with name @p keyName.
+   *
+   * The default implementation calls getCertificate() for each name returned by
+   * getCertificatesOfKey(); backends should override it with a single query.
+   *
+   * @return The certificates. If the key does not exist, return an empty vector.
+   */
+  virtual std::vector<v2::Certificate>
+  getCertificatesDataOfKey(const Name& keyName) const
+  {
+    std::vector<v2::Certificate> certs;
+    for (const auto& certName : getCertificatesOfKey(keyName)) {
+      certs.push_back(getCertificate(certName));
+    }
+    return certs;
+  }
+
+public: // Transaction support
+  /**
+   * @brief Start grouping subsequent modifications into one atomic update.
+   *
+   * Calls may be nested; the update is applied when the outermost transaction is committed.
+   * The default implementation does nothing, i.e., every modification is applied immediately.
+   */
+  virtual void
+  beginTransaction()
+  {
+  }
+
+  /**
+   * @brief Apply the modifications made since the matching beginTransaction().
+   *
+   * The transaction is ended even if this throws.
+   *
+   * @throw Error an enclosed transaction has been rolled back, or the modifications could not
+   *              be applied; in both cases nothing is applied
+   */
+  virtual void
+  commitTransaction()
+  {
+  }
+
+  /**
+   * @brief Discard the modifications made since the outermost beginTransaction(), if supported.
+   *
+   * Like commitTransaction(), this ends only the innermost transaction. If it is nested, the
+   * enclosing transactions can only be ended by further rollbacks or failing commits.
+   */
+  virtual void
+  rollbackTransaction()
+  {
+  }
 };
 
 } // namespace pib
@@ -96,6 +96,29 @@ Pib::removeIdentity(const Name& identity)
   m_identities.remove(identity);
 }
 
+void
+Pib::forgetAdded(const std::vector<Name>& identities, const std::vector<Name>& keys)
+{
+  for (const auto& keyName : keys) {
+    m_identities.forgetKey(keyName);
+    if (m_impl->hasKey(keyName)) {
+      m_impl->removeKey(keyName);
+    }
+  }
+
+  for (const auto& identity : identities) {
+    m_identities.forget(identity);
+    if (m_impl->hasIdentity(identity)) {
+      m_impl->removeIdentity(identity);
+    }
+  }
+
+  // the default identity may have changed along with the backend
+  m_isDefaultIdentityLoaded = false;
+
+  BOOST_ASSERT(m_identities.isConsistent());
+}
+
 Identity
 Pib::getIdentity(const Name& identity) const
 {
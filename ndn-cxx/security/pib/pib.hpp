@@ -157,6 +157,19 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE: // write operations should be private
   const Identity&
   setDefaultIdentity(const Name& identity);
 
+  /**
+   * @brief Undo the addition of @p identities and @p keys.
+   *
+   * This is used after the PIB transaction that added them has been rolled back: it drops their
+   * cached state, and removes whatever the backend still contains if the backend does not
+   * support transactions. Handles of other identities and keys remain valid.
+   *
+   * @param identities identities that did not exist before the transaction
+   * @param keys keys that did not exist before the transaction
+   */
+  void
+  forgetAdded(const std::vector<Name>& identities, const std::vector<Name>& keys);
+
   shared_ptr<PibImpl>
   getImpl()
   {
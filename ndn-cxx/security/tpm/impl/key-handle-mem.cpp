@@ -71,6 +71,19 @@ KeyHandleMem::doDerivePublicKey() const
   return m_key->derivePublicKey();
 }
 
+ConstBufferPtr
+KeyHandleMem::doExportPrivateKey(const char* pw, size_t pwLen) const
+{
+  OBufferStream os;
+  try {
+    m_key->savePkcs8(os, pw, pwLen);
+  }
+  catch (const transform::PrivateKey::Error&) {
+    NDN_THROW_NESTED(Error("Cannot export private key"));
+  }
+  return os.buf();
+}
+
 } // namespace tpm
 } // namespace security
 } // namespace ndn
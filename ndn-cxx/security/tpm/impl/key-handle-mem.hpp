@@ -56,6 +56,9 @@ private:
   ConstBufferPtr
   doDerivePublicKey() const final;
 
+  ConstBufferPtr
+  doExportPrivateKey(const char* pw, size_t pwLen) const final;
+
 private:
   shared_ptr<transform::PrivateKey> m_key;
 };
@@ -65,6 +65,18 @@ KeyHandle::derivePublicKey() const
   return doDerivePublicKey();
 }
 
+ConstBufferPtr
+KeyHandle::exportPrivateKey(const char* pw, size_t pwLen) const
+{
+  return doExportPrivateKey(pw, pwLen);
+}
+
+ConstBufferPtr
+KeyHandle::doExportPrivateKey(const char*, size_t) const
+{
+  return nullptr;
+}
+
 } // namespace tpm
 } // namespace security
 } // namespace ndn
@@ -85,6 +85,14 @@ public:
   ConstBufferPtr
   derivePublicKey() const;
 
+  /**
+   * @brief Export this key in encrypted PKCS #8 format, using password @p pw.
+   * @return the encoded key, or nullptr if the key material is not accessible through the handle
+   * @throw Error the key could not be exported
+   */
+  ConstBufferPtr
+  exportPrivateKey(const char* pw, size_t pwLen) const;
+
   Name
   getKeyName() const
   {
@@ -111,6 +119,14 @@ private:
   virtual ConstBufferPtr
   doDerivePublicKey() const = 0;
 
+  /**
+   * @brief Export the key in encrypted PKCS #8 format.
+   *
+   * The default implementation returns nullptr.
+   */
+  virtual ConstBufferPtr
+  doExportPrivateKey(const char* pw, size_t pwLen) const;
+
 private:
   Name m_keyName;
 };
@@ -47,12 +47,14 @@ Tpm::getTpmLocator() const
 bool
 Tpm::hasKey(const Name& keyName) const
 {
+  std::lock_guard<std::mutex> lock(m_mutex);
   return m_backEnd->hasKey(keyName);
 }
 
 Name
 Tpm::createKey(const Name& identityName, const KeyParams& params)
 {
+  std::lock_guard<std::mutex> lock(m_mutex);
   auto keyHandle = m_backEnd->createKey(identityName, params);
   auto keyName = keyHandle->getKeyName();
   m_keys[keyName] = std::move(keyHandle);
@@ -62,17 +64,15 @@ Tpm::createKey(const Name& identityName, const KeyParams& params)
 void
 Tpm::deleteKey(const Name& keyName)
 {
-  auto it = m_keys.find(keyName);
-  if (it != m_keys.end())
-    m_keys.erase(it);
-
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_keys.erase(keyName);
   m_backEnd->deleteKey(keyName);
 }
 
 ConstBufferPtr
 Tpm::getPublicKey(const Name& keyName) const
 {
-  const KeyHandle* key = findKey(keyName);
+  auto key = findKey(keyName);
 
   if (key == nullptr)
     return nullptr;
@@ -83,7 +83,7 @@ Tpm::getPublicKey(const Name& keyName) const
 ConstBufferPtr
 Tpm::sign(const InputBuffers& bufs, const Name& keyName, DigestAlgorithm digestAlgorithm) const
 {
-  const KeyHandle* key = findKey(keyName);
+  auto key = findKey(keyName);
 
   if (key == nullptr) {
     return nullptr;
@@ -97,7 +97,7 @@ boost::logic::tribool
 Tpm::verify(const InputBuffers& bufs, const uint8_t* sig, size_t sigLen, const Name& keyName,
             DigestAlgorithm digestAlgorithm) const
 {
-  const KeyHandle* key = findKey(keyName);
+  auto key = findKey(keyName);
 
   if (key == nullptr) {
     return boost::logic::indeterminate;
@@ -110,7 +110,7 @@ Tpm::verify(const InputBuffers& bufs, const uint8_t* sig, size_t sigLen, const N
 ConstBufferPtr
 Tpm::decrypt(const uint8_t* buf, size_t size, const Name& keyName) const
 {
-  const KeyHandle* key = findKey(keyName);
+  auto key = findKey(keyName);
 
   if (key == nullptr)
     return nullptr;
@@ -121,30 +121,51 @@ Tpm::decrypt(const uint8_t* buf, size_t size, const Name& keyName) const
 bool
 Tpm::isTerminalMode() const
 {
+  std::lock_guard<std::mutex> lock(m_mutex);
   return m_backEnd->isTerminalMode();
 }
 
 void
 Tpm::setTerminalMode(bool isTerminal) const
 {
+  std::lock_guard<std::mutex> lock(m_mutex);
   m_backEnd->setTerminalMode(isTerminal);
 }
 
 bool
 Tpm::isTpmLocked() const
 {
+  std::lock_guard<std::mutex> lock(m_mutex);
   return m_backEnd->isTpmLocked();
 }
 
 bool
 Tpm::unlockTpm(const char* password, size_t passwordLength) const
 {
+  std::lock_guard<std::mutex> lock(m_mutex);
   return m_backEnd->unlockTpm(password, passwordLength);
 }
 
 ConstBufferPtr
 Tpm::exportPrivateKey(const Name& keyName, const char* pw, size_t pwLen) const
 {
+  // like sign(), hold the lock only to look up the key handle, so that different keys
+  // can be encrypted concurrently
+  auto key = findKey(keyName);
+  if (key != nullptr) {
+    ConstBufferPtr pkcs8;
+    try {
+      pkcs8 = key->exportPrivateKey(pw, pwLen);
+    }
+    catch (const KeyHandle::Error&) {
+      NDN_THROW_NESTED(Error("Cannot export private key `" + keyName.toUri() + "`"));
+    }
+    if (pkcs8 != nullptr) {
+      return pkcs8;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
   return m_backEnd->exportKey(keyName, pw, pwLen);
 }
 
@@ -152,29 +173,32 @@ void
 Tpm::importPrivateKey(const Name& keyName, const uint8_t* pkcs8, size_t pkcs8Len,
                       const char* pw, size_t pwLen)
 {
+  std::lock_guard<std::mutex> lock(m_mutex);
   m_backEnd->importKey(keyName, pkcs8, pkcs8Len, pw, pwLen);
 }
 
 void
 Tpm::importPrivateKey(const Name& keyName, shared_ptr<transform::PrivateKey> key)
 {
+  std::lock_guard<std::mutex> lock(m_mutex);
   m_backEnd->importKey(keyName, std::move(key));
 }
 
-const KeyHandle*
+shared_ptr<const KeyHandle>
 Tpm::findKey(const Name& keyName) const
 {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
   auto it = m_keys.find(keyName);
   if (it != m_keys.end())
-    return it->second.get();
+    return it->second;
 
-  auto handle = m_backEnd->getKeyHandle(keyName);
+  shared_ptr<KeyHandle> handle = m_backEnd->getKeyHandle(keyName);
   if (handle == nullptr)
     return nullptr;
 
-  const KeyHandle* key = handle.get();
-  m_keys[keyName] = std::move(handle);
-  return key;
+  m_keys[keyName] = handle;
+  return handle;
 }
 
 } // namespace tpm
@@ -26,6 +26,7 @@
 #include "ndn-cxx/security/key-params.hpp"
 #include "ndn-cxx/security/tpm/key-handle.hpp"
 
+#include <mutex>
 #include <unordered_map>
 #include <boost/logic/tribool.hpp>
 
@@ -210,7 +211,9 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /**
    * @brief Export a private key.
    *
-   * Export a private key in encrypted PKCS #8 format.
+   * Export a private key in encrypted PKCS #8 format. If the back-end gives access to the key
+   * material, as the file-based and in-memory back-ends do, the key is encrypted without
+   * holding the TPM lock, so that several keys can be exported concurrently.
    *
    * @param keyName The private key name
    * @param pw The password to encrypt the private key
@@ -249,6 +252,7 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   clearKeyCache()
   {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_keys.clear();
   }
 
@@ -256,16 +260,23 @@ private:
   /**
    * @brief Internal KeyHandle lookup.
    *
-   * @return A pointer to the handle of key @p keyName if it exists, otherwise nullptr.
+   * The key cache and the back-end are protected by a mutex, and the returned handle remains
+   * valid even if the key is concurrently deleted or the cache is cleared. This allows sign()
+   * to be invoked from multiple threads, provided that the back-end's key handles support
+   * concurrent signing.
+   *
+   * @return The handle of key @p keyName if it exists, otherwise nullptr.
    */
-  const KeyHandle*
+  shared_ptr<const KeyHandle>
   findKey(const Name& keyName) const;
 
 private:
   std::string m_scheme;
   std::string m_location;
 
-  mutable std::unordered_map<Name, unique_ptr<KeyHandle>> m_keys;
+  /// serializes all access to the key cache and to the back-end
+  mutable std::mutex m_mutex;
+  mutable std::unordered_map<Name, shared_ptr<KeyHandle>> m_keys;
 
   const unique_ptr<BackEnd> m_backEnd;
 
@@ -28,6 +28,8 @@
 #include <boost/range/algorithm/copy.hpp>
 #include <boost/range/iterator_range.hpp>
 
+#include <sys/stat.h>
+
 namespace ndn {
 namespace security {
 inline namespace v2 {
@@ -100,6 +102,21 @@ DynamicTrustAnchorGroup::DynamicTrustAnchorGroup(CertContainerInterface& certCon
   refresh();
 }
 
+/**
+ * @brief Granularity of file system timestamps that is assumed when comparing them
+ *
+ * Many file systems take timestamps from a clock that ticks only every few milliseconds, so
+ * a file rewritten twice within one tick keeps its stamp. Like Git does for its index, a file
+ * changed less than this long before it is examined is read again on the next refresh.
+ */
+static const time::seconds TIMESTAMP_GRANULARITY(1);
+
+static int64_t
+toNanoseconds(const timespec& ts)
+{
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
 void
 DynamicTrustAnchorGroup::refresh()
 {
@@ -110,10 +127,45 @@ DynamicTrustAnchorGroup::refresh()
   NDN_LOG_TRACE("Reloading dynamic trust anchor group");
 
   std::set<Name> oldAnchorNames = m_anchorNames;
+  std::map<fs::path, AnchorFile> oldFiles;
+  oldFiles.swap(m_files);
+
+  // file system timestamps are taken from the same clock as time::system_clock, unless mocked
+  time::nanoseconds now = time::system_clock::now().time_since_epoch();
+
+  auto loadCert = [this, now, &oldAnchorNames, &oldFiles] (const fs::path& file) {
+    struct stat st;
+    if (::stat(file.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) {
+      return;
+    }
+
+#ifdef __APPLE__
+    FileStamp stamp{static_cast<uint64_t>(st.st_dev), static_cast<uint64_t>(st.st_ino),
+                    st.st_size, toNanoseconds(st.st_mtimespec), toNanoseconds(st.st_ctimespec)};
+#else
+    FileStamp stamp{static_cast<uint64_t>(st.st_dev), static_cast<uint64_t>(st.st_ino),
+                    st.st_size, toNanoseconds(st.st_mtim), toNanoseconds(st.st_ctim)};
+#endif // __APPLE__
+
+    AnchorFile state;
+    if (time::nanoseconds(std::max(stamp.mtime, stamp.ctime)) + TIMESTAMP_GRANULARITY < now) {
+      state.stamp = stamp;
+    }
+
+    auto oldFile = oldFiles.find(file);
+    if (oldFile != oldFiles.end() && oldFile->second.stamp && *oldFile->second.stamp == stamp) {
+      // file unchanged since the last refresh, no need to decode it again
+      if (oldFile->second.certName) {
+        oldAnchorNames.erase(*oldFile->second.certName);
+      }
+      m_files.emplace(file, oldFile->second);
+      return;
+    }
 
-  auto loadCert = [this, &oldAnchorNames] (const fs::path& file) {
     auto cert = io::load<Certificate>(file.string());
+    ++m_nLoadedFiles;
     if (cert != nullptr) {
+      state.certName = cert->getName();
       if (m_anchorNames.count(cert->getName()) == 0) {
         m_anchorNames.insert(cert->getName());
         m_certs.add(std::move(*cert));
@@ -122,6 +174,7 @@ DynamicTrustAnchorGroup::refresh()
         oldAnchorNames.erase(cert->getName());
       }
     }
+    m_files.emplace(file, std::move(state));
   };
 
   if (!m_isDir) {
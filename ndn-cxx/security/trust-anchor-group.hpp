@@ -26,6 +26,7 @@
 #include "ndn-cxx/security/certificate.hpp"
 
 #include <boost/filesystem/path.hpp>
+#include <map>
 #include <set>
 
 namespace ndn {
@@ -137,7 +138,10 @@ public:
    * placed in the folder.  If folder is removed, becomes empty, or no longer contains valid
    * certificates, the anchor group becomes empty.
    *
-   * Upon refresh, the existing certificates are not changed.
+   * Upon refresh, the existing certificates are not changed.  Files whose identity (device and
+   * inode), size, and modification and status change times (in nanoseconds) did not change
+   * since the previous refresh are not read again, unless they were changed too recently for
+   * the file system timestamps to be trusted.
    *
    * @param certContainer  A certificate container into which trust anchors from the group will
    *                       be added
@@ -157,10 +161,42 @@ public:
   refresh() override;
 
 private:
+  /**
+   * @brief Attributes of a file that change whenever its content is modified or replaced
+   */
+  struct FileStamp
+  {
+    uint64_t device;
+    uint64_t inode;
+    int64_t size;
+    int64_t mtime; ///< modification time, in nanoseconds since the epoch
+    int64_t ctime; ///< status change time, in nanoseconds since the epoch
+
+    friend bool
+    operator==(const FileStamp& a, const FileStamp& b)
+    {
+      return a.device == b.device && a.inode == b.inode && a.size == b.size &&
+             a.mtime == b.mtime && a.ctime == b.ctime;
+    }
+  };
+
+  /**
+   * @brief State of a trust anchor file as of the last refresh
+   */
+  struct AnchorFile
+  {
+    optional<FileStamp> stamp; ///< nullopt if the file must be read again on the next refresh
+    optional<Name> certName;   ///< name of the certificate loaded from the file, if valid
+  };
+
   bool m_isDir;
   boost::filesystem::path m_path;
   time::nanoseconds m_refreshPeriod;
   time::steady_clock::TimePoint m_expireTime;
+  std::map<boost::filesystem::path, AnchorFile> m_files;
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  size_t m_nLoadedFiles = 0; ///< number of times a file was read and decoded
 };
 
 } // inline namespace v2
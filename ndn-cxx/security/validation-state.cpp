@@ -107,7 +107,19 @@ DataValidationState::~DataValidationState()
 void
 DataValidationState::verifyOriginalPacket(const Certificate& trustedCert)
 {
-  if (verifySignature(m_data, trustedCert)) {
+  finishOriginalPacket(verifySignature(m_data, trustedCert));
+}
+
+std::function<bool()>
+DataValidationState::makeOriginalPacketVerifier(const Certificate& trustedCert) const
+{
+  return [data = m_data, cert = trustedCert] { return verifySignature(data, cert); };
+}
+
+void
+DataValidationState::finishOriginalPacket(bool isVerified)
+{
+  if (isVerified) {
     NDN_LOG_TRACE_DEPTH("OK signature for data `" << m_data.getName() << "`");
     m_successCb(m_data);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
@@ -167,7 +179,19 @@ InterestValidationState::~InterestValidationState()
 void
 InterestValidationState::verifyOriginalPacket(const Certificate& trustedCert)
 {
-  if (verifySignature(m_interest, trustedCert)) {
+  finishOriginalPacket(verifySignature(m_interest, trustedCert));
+}
+
+std::function<bool()>
+InterestValidationState::makeOriginalPacketVerifier(const Certificate& trustedCert) const
+{
+  return [interest = m_interest, cert = trustedCert] { return verifySignature(interest, cert); };
+}
+
+void
+InterestValidationState::finishOriginalPacket(bool isVerified)
+{
+  if (isVerified) {
     NDN_LOG_TRACE_DEPTH("OK signature for interest `" << m_interest.getName() << "`");
     this->afterSuccess(m_interest);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
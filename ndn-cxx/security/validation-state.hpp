@@ -112,6 +112,24 @@ private: // Interface intended to be used only by Validator class
   virtual void
   verifyOriginalPacket(const Certificate& trustedCert) = 0;
 
+  /**
+   * @brief Make a function that verifies the signature of the original packet
+   *
+   * The function works on copies of the original packet and @p trustedCert and does not access
+   * this state, so that it can be invoked on another thread. Its result must be passed to
+   * finishOriginalPacket().
+   *
+   * @param trustCert The certificate that signs the original packet
+   */
+  virtual std::function<bool()>
+  makeOriginalPacketVerifier(const Certificate& trustedCert) const = 0;
+
+  /**
+   * @brief Call success or failure callback according to the outcome of signature verification
+   */
+  virtual void
+  finishOriginalPacket(bool isVerified) = 0;
+
   /**
    * @brief Call success callback of the original packet without signature validation
    */
@@ -189,6 +207,12 @@ private:
   void
   verifyOriginalPacket(const Certificate& trustedCert) final;
 
+  std::function<bool()>
+  makeOriginalPacketVerifier(const Certificate& trustedCert) const final;
+
+  void
+  finishOriginalPacket(bool isVerified) final;
+
   void
   bypassValidation() final;
 
@@ -238,6 +262,12 @@ private:
   void
   verifyOriginalPacket(const Certificate& trustedCert) final;
 
+  std::function<bool()>
+  makeOriginalPacketVerifier(const Certificate& trustedCert) const final;
+
+  void
+  finishOriginalPacket(bool isVerified) final;
+
   void
   bypassValidation() final;
 
@@ -34,8 +34,11 @@ NDN_LOG_INIT(ndn.security.Validator);
 #define NDN_LOG_DEBUG_DEPTH(x) NDN_LOG_DEBUG(std::string(state->getDepth() + 1, '>') << " " << x)
 #define NDN_LOG_TRACE_DEPTH(x) NDN_LOG_TRACE(std::string(state->getDepth() + 1, '>') << " " << x)
 
-Validator::Validator(unique_ptr<ValidationPolicy> policy, unique_ptr<CertificateFetcher> certFetcher)
-  : m_policy(std::move(policy))
+Validator::Validator(unique_ptr<ValidationPolicy> policy, unique_ptr<CertificateFetcher> certFetcher,
+                     time::nanoseconds verifiedCertLifetime,
+                     time::nanoseconds unverifiedCertLifetime)
+  : CertificateStorage(verifiedCertLifetime, unverifiedCertLifetime)
+  , m_policy(std::move(policy))
   , m_certFetcher(std::move(certFetcher))
   , m_maxDepth(25)
 {
@@ -59,6 +62,17 @@ Validator::getFetcher()
   return *m_certFetcher;
 }
 
+void
+Validator::prefetchCertificates(const std::vector<Name>& certPrefixes,
+                                const CertificateFetcher::PrefetchCallback& onComplete)
+{
+  m_certFetcher->prefetch(certPrefixes, [onComplete] (size_t nRetrieved) {
+    if (onComplete) {
+      onComplete(nRetrieved);
+    }
+  });
+}
+
 void
 Validator::setMaxDepth(size_t depth)
 {
@@ -71,6 +85,12 @@ Validator::getMaxDepth() const
   return m_maxDepth;
 }
 
+void
+Validator::setVerificationExecutor(VerificationExecutor executor)
+{
+  m_verificationExecutor = std::move(executor);
+}
+
 void
 Validator::validate(const Data& data,
                     const DataValidationSuccessCallback& successCb,
@@ -154,13 +174,13 @@ Validator::requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
 
   NDN_LOG_DEBUG_DEPTH("Retrieving " << certRequest->interest.getName());
 
-  auto cert = findTrustedCert(certRequest->interest);
+  auto cert = lookupTrustedCert(certRequest->interest);
   if (cert != nullptr) {
     NDN_LOG_TRACE_DEPTH("Found trusted certificate " << cert->getName());
 
     cert = state->verifyCertificateChain(*cert);
     if (cert != nullptr) {
-      state->verifyOriginalPacket(*cert);
+      verifyOriginalPacket(*cert, state);
     }
     for (auto trustedCert = std::make_move_iterator(state->m_certificateChain.begin());
          trustedCert != std::make_move_iterator(state->m_certificateChain.end());
@@ -175,6 +195,29 @@ Validator::requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
     });
 }
 
+void
+Validator::verifyOriginalPacket(const Certificate& trustedCert, const shared_ptr<ValidationState>& state)
+{
+  if (m_verificationExecutor == nullptr) {
+    state->verifyOriginalPacket(trustedCert);
+    return;
+  }
+
+  NDN_LOG_TRACE_DEPTH("Offloading signature verification with " << trustedCert.getName());
+  weak_ptr<int> guard = m_lifetimeGuard;
+  m_verificationExecutor(state->makeOriginalPacketVerifier(trustedCert),
+                         [guard, state] (bool isVerified) {
+                           // success callbacks may refer to the policy
+                           if (guard.expired()) {
+                             state->fail({ValidationError::Code::IMPLEMENTATION_ERROR,
+                                          "Validator was destroyed during signature verification"});
+                           }
+                           else {
+                             state->finishOriginalPacket(isVerified);
+                           }
+                         });
+}
+
 ////////////////////////////////////////////////////////////////////////
 // Trust anchor management
 ////////////////////////////////////////////////////////////////////////
@@ -55,19 +55,31 @@ inline namespace v2 {
  * certificate cache for saving prefetched but not yet verified certificates.
  *
  * @todo Limit the maximum time the validation process is allowed to run before declaring failure
- * @todo Ability to customize maximum lifetime for trusted and untrusted certificate caches.
- *       Current implementation hard-codes them to be 1 hour and 5 minutes.
  */
 class Validator : public CertificateStorage
 {
 public:
+  /**
+   * @brief A function that executes a signature verification job
+   *
+   * It must invoke @p verify, possibly on another thread, and afterwards invoke @p done with
+   * the result on the thread that runs the Validator, e.g., by posting it to the io_service
+   * of the Face.
+   */
+  using VerificationExecutor = std::function<void(std::function<bool()> verify,
+                                                  std::function<void(bool)> done)>;
+
   /**
    * @brief Validator constructor.
    *
-   * @param policy      Validation policy to be associated with the validator
-   * @param certFetcher Certificate fetcher implementation.
+   * @param policy                  Validation policy to be associated with the validator
+   * @param certFetcher             Certificate fetcher implementation.
+   * @param verifiedCertLifetime    Maximum time that verified certificates are cached
+   * @param unverifiedCertLifetime  Maximum time that unverified certificates are cached
    */
-  Validator(unique_ptr<ValidationPolicy> policy, unique_ptr<CertificateFetcher> certFetcher);
+  Validator(unique_ptr<ValidationPolicy> policy, unique_ptr<CertificateFetcher> certFetcher,
+            time::nanoseconds verifiedCertLifetime = 1_h,
+            time::nanoseconds unverifiedCertLifetime = 5_min);
 
   ~Validator();
 
@@ -89,6 +101,20 @@ public:
   size_t
   getMaxDepth() const;
 
+  /**
+   * @brief Offload signature verification of the validated packets to @p executor
+   *
+   * Only the verification of the original packet's signature with the certificate at the end
+   * of the chain is passed to @p executor. The policy, the certificate fetcher, the certificate
+   * caches, and the callbacks keep running on the thread of the Validator, so that stateful
+   * policies such as ValidationPolicyCommandInterest may be used. If the Validator is destroyed
+   * before @p executor completes a job, the validation fails.
+   *
+   * @param executor the executor, or nullptr to verify signatures synchronously
+   */
+  void
+  setVerificationExecutor(VerificationExecutor executor);
+
   /**
    * @brief Asynchronously validate @p data
    *
@@ -109,6 +135,22 @@ public:
            const InterestValidationSuccessCallback& successCb,
            const InterestValidationFailureCallback& failureCb);
 
+  /**
+   * @brief Asynchronously warm up the certificate cache before validation
+   *
+   * Certificates in @p certPrefixes that are not already known to the validator are
+   * retrieved concurrently through the certificate fetcher and placed into the unverified
+   * certificate cache, so that the first validations after startup do not stall on
+   * certificate retrieval.
+   *
+   * @param certPrefixes names or name prefixes of the certificates to retrieve
+   * @param onComplete callback invoked when every retrieval has finished; may be nullptr
+   * @sa CertificateBundleFetcher::prefetchBundles
+   */
+  void
+  prefetchCertificates(const std::vector<Name>& certPrefixes,
+                       const CertificateFetcher::PrefetchCallback& onComplete = nullptr);
+
 public: // anchor management
   /**
    * @brief load static trust anchor.
@@ -143,9 +185,7 @@ public: // anchor management
   resetAnchors();
 
   /**
-   * @brief Cache verified @p cert a period of time (1 hour)
-   *
-   * @todo Add ability to customize time period
+   * @brief Cache verified @p cert a period of time (1 hour by default)
    */
   void
   cacheVerifiedCertificate(Certificate&& cert);
@@ -176,10 +216,21 @@ private: // Common validator operations
   requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
                      const shared_ptr<ValidationState>& state);
 
+  /**
+   * @brief Verify the signature of the original packet, using the executor if one is set.
+   *
+   * @param trustedCert The certificate that signs the original packet.
+   * @param state       The current validation state.
+   */
+  void
+  verifyOriginalPacket(const Certificate& trustedCert, const shared_ptr<ValidationState>& state);
+
 private:
   unique_ptr<ValidationPolicy> m_policy;
   unique_ptr<CertificateFetcher> m_certFetcher;
   size_t m_maxDepth;
+  VerificationExecutor m_verificationExecutor;
+  shared_ptr<int> m_lifetimeGuard = make_shared<int>(); ///< expires when Validator is destroyed
 };
 
 } // inline namespace v2
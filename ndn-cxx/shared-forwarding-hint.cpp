@@ -0,0 +1,70 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/shared-forwarding-hint.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+
+#include <algorithm>
+
+namespace ndn {
+
+static Block
+encodeForwardingHint(const DelegationList& delegations)
+{
+  EncodingEstimator estimator;
+  size_t estimatedSize = delegations.wireEncode(estimator);
+
+  EncodingBuffer encoder(estimatedSize, 0);
+  delegations.wireEncode(encoder);
+  return encoder.block();
+}
+
+SharedForwardingHint::SharedForwardingHint(DelegationList delegations, Block wire)
+  : m_delegations(std::move(delegations))
+  , m_wire(std::move(wire))
+{
+}
+
+shared_ptr<const SharedForwardingHint>
+SharedForwardingHint::create(DelegationList delegations)
+{
+  delegations.sort();
+  Block wire = encodeForwardingHint(delegations);
+  // the constructor is private, so make_shared cannot be used
+  return shared_ptr<const SharedForwardingHint>(new SharedForwardingHint(std::move(delegations),
+                                                                         std::move(wire)));
+}
+
+shared_ptr<const SharedForwardingHint>
+SharedForwardingHint::create(const Block& wire)
+{
+  DelegationList delegations(wire, false);
+  if (!std::is_sorted(delegations.begin(), delegations.end())) {
+    return create(std::move(delegations));
+  }
+
+  // already in sorted order, so sorting does not change the encoding
+  delegations.sort();
+  return shared_ptr<const SharedForwardingHint>(new SharedForwardingHint(std::move(delegations),
+                                                                         wire));
+}
+
+} // namespace ndn
@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SHARED_FORWARDING_HINT_HPP
+#define NDN_CXX_SHARED_FORWARDING_HINT_HPP
+
+#include "ndn-cxx/delegation-list.hpp"
+
+namespace ndn {
+
+/** @brief Immutable, pre-encoded ForwardingHint that can be shared among many Interests.
+ *
+ *  The delegations are sorted and encoded once, upon creation. An Interest that refers to a
+ *  SharedForwardingHint copies a pointer rather than the delegations when it is copied, and
+ *  prepends the pre-encoded element when it is encoded.
+ *
+ *  Consumers that attach the same hint to many Interests should create it once, or obtain it
+ *  from Link::getForwardingHint(), and pass it to Interest::setSharedForwardingHint.
+ */
+class SharedForwardingHint : noncopyable
+{
+public:
+  /** @brief Create from a list of delegations.
+   *  @param delegations the delegations; they are sorted if not already sorted
+   *  @throw DelegationList::Error @p delegations is empty
+   */
+  static shared_ptr<const SharedForwardingHint>
+  create(DelegationList delegations);
+
+  /** @brief Create from a ForwardingHint element.
+   *
+   *  The element is kept as the wire encoding if its delegations are already in sorted order;
+   *  otherwise, the sorted delegations are re-encoded.
+   *
+   *  @throw DelegationList::Error @p wire cannot be parsed as a list of delegations
+   */
+  static shared_ptr<const SharedForwardingHint>
+  create(const Block& wire);
+
+  /** @brief Return the sorted delegations.
+   */
+  const DelegationList&
+  getDelegations() const noexcept
+  {
+    return m_delegations;
+  }
+
+  /** @brief Return the ForwardingHint element.
+   */
+  const Block&
+  wireEncode() const noexcept
+  {
+    return m_wire;
+  }
+
+private:
+  SharedForwardingHint(DelegationList delegations, Block wire);
+
+private:
+  DelegationList m_delegations;
+  Block m_wire;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_SHARED_FORWARDING_HINT_HPP
@@ -70,6 +70,10 @@ SignatureInfo::wireEncode(EncodingImpl<TAG>& encoder, SignatureInfo::Type type)
   //                           [SignatureSeqNum]
   //                           *OtherSubelements
 
+  if (m_wire.hasWire() && m_wire.type() == to_underlying(type)) {
+    return encoder.prependBlock(m_wire);
+  }
+
   size_t totalLength = 0;
 
   // m_otherTlvs contains (if set) SignatureNonce, SignatureTime, SignatureSeqNum, ValidityPeriod,
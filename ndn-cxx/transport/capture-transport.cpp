@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/transport/capture-transport.hpp"
+
+namespace ndn {
+
+CaptureTransport::CaptureTransport(shared_ptr<Transport> inner,
+                                   shared_ptr<util::PacketTraceWriter> writer)
+  : m_inner(std::move(inner))
+  , m_writer(std::move(writer))
+{
+  BOOST_ASSERT(m_inner != nullptr);
+  BOOST_ASSERT(m_writer != nullptr);
+}
+
+void
+CaptureTransport::connect(boost::asio::io_service& ioService, ReceiveCallback receiveCallback)
+{
+  Transport::connect(ioService, std::move(receiveCallback));
+
+  // the inner transport may have completed an asynchronous connection since the last call
+  if (!m_inner->isConnected()) {
+    m_inner->connect(ioService, [this] (const Block& wire) { afterReceive(wire); });
+  }
+  updateState();
+}
+
+void
+CaptureTransport::close()
+{
+  m_inner->close();
+  updateState();
+}
+
+void
+CaptureTransport::pause()
+{
+  m_inner->pause();
+  updateState();
+}
+
+void
+CaptureTransport::resume()
+{
+  m_inner->resume();
+  updateState();
+}
+
+int
+CaptureTransport::getNativeHandle() const
+{
+  return m_inner->getNativeHandle();
+}
+
+optional<time::steady_clock::TimePoint>
+CaptureTransport::getConnectDeadline() const
+{
+  return m_inner->getConnectDeadline();
+}
+
+void
+CaptureTransport::send(const Block& wire)
+{
+  m_writer->write(util::TraceDirection::OUTGOING, wire);
+  m_inner->send(wire);
+  updateState();
+}
+
+void
+CaptureTransport::send(const Block& header, const Block& payload)
+{
+  m_writer->write(util::TraceDirection::OUTGOING, concatenate(WireSequence{header, payload}));
+  m_inner->send(header, payload);
+  updateState();
+}
+
+void
+CaptureTransport::send(const WireSequence& sequence)
+{
+  m_writer->write(util::TraceDirection::OUTGOING, concatenate(sequence));
+  m_inner->send(sequence);
+  updateState();
+}
+
+void
+CaptureTransport::afterReceive(const Block& wire)
+{
+  updateState();
+  m_writer->write(util::TraceDirection::INCOMING, wire);
+  m_receiveCallback(wire);
+}
+
+void
+CaptureTransport::updateState()
+{
+  m_isConnected = m_inner->isConnected();
+  m_isReceiving = m_inner->isReceiving();
+}
+
+ReplayTransport::ReplayTransport(std::vector<util::TraceRecord> records, double speedup)
+  : m_records(std::move(records))
+  , m_speedup(speedup)
+{
+}
+
+void
+ReplayTransport::connect(boost::asio::io_service& ioService, ReceiveCallback receiveCallback)
+{
+  Transport::connect(ioService, std::move(receiveCallback));
+
+  m_replayer = make_unique<util::PacketTraceReplayer>(ioService, m_records, m_speedup);
+  m_isConnected = true;
+  m_isReceiving = true;
+  m_replayer->start([this] (const Block& wire) { m_receiveCallback(wire); });
+}
+
+void
+ReplayTransport::close()
+{
+  if (m_replayer != nullptr) {
+    m_replayer->stop();
+  }
+  m_isConnected = false;
+  m_isReceiving = false;
+}
+
+void
+ReplayTransport::pause()
+{
+  // replay follows the timing of the trace, so that it is not distorted by the application
+}
+
+void
+ReplayTransport::resume()
+{
+}
+
+void
+ReplayTransport::send(const Block&)
+{
+  ++m_nSent;
+}
+
+void
+ReplayTransport::send(const Block&, const Block&)
+{
+  ++m_nSent;
+}
+
+} // namespace ndn
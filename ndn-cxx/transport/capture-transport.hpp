@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_TRANSPORT_CAPTURE_TRANSPORT_HPP
+#define NDN_TRANSPORT_CAPTURE_TRANSPORT_HPP
+
+#include "ndn-cxx/transport/transport.hpp"
+#include "ndn-cxx/util/packet-trace.hpp"
+
+namespace ndn {
+
+/** \brief a transport that records every TLV block passing through another transport
+ *
+ *  Received and sent blocks are appended to a packet trace, which can later be replayed
+ *  with ReplayTransport or util::PacketTraceReplayer.
+ */
+class CaptureTransport : public Transport
+{
+public:
+  /** \param inner transport that carries the packets
+   *  \param writer trace that receives the captured blocks
+   */
+  CaptureTransport(shared_ptr<Transport> inner, shared_ptr<util::PacketTraceWriter> writer);
+
+  void
+  connect(boost::asio::io_service& ioService, ReceiveCallback receiveCallback) override;
+
+  void
+  close() override;
+
+  void
+  pause() override;
+
+  void
+  resume() override;
+
+  int
+  getNativeHandle() const override;
+
+  optional<time::steady_clock::TimePoint>
+  getConnectDeadline() const override;
+
+  void
+  send(const Block& wire) override;
+
+  void
+  send(const Block& header, const Block& payload) override;
+
+  void
+  send(const WireSequence& sequence) override;
+
+  const shared_ptr<Transport>&
+  getInnerTransport() const
+  {
+    return m_inner;
+  }
+
+private:
+  void
+  afterReceive(const Block& wire);
+
+  /** \brief copy connection state from the inner transport
+   */
+  void
+  updateState();
+
+private:
+  shared_ptr<Transport> m_inner;
+  shared_ptr<util::PacketTraceWriter> m_writer;
+};
+
+/** \brief a transport that delivers the incoming packets of a trace instead of a connection
+ *
+ *  Replay starts when the transport is connected, and is not interrupted by pause().
+ *  Packets sent through this transport are discarded, so that a Face can be exercised
+ *  with a recorded traffic mix without a forwarder.
+ */
+class ReplayTransport : public Transport
+{
+public:
+  /** \param records trace records in capture order
+   *  \param speedup factor by which intervals between records are shortened,
+   *                 see util::PacketTraceReplayer
+   */
+  explicit
+  ReplayTransport(std::vector<util::TraceRecord> records, double speedup = 1.0);
+
+  void
+  connect(boost::asio::io_service& ioService, ReceiveCallback receiveCallback) override;
+
+  void
+  close() override;
+
+  void
+  pause() override;
+
+  void
+  resume() override;
+
+  void
+  send(const Block& wire) override;
+
+  void
+  send(const Block& header, const Block& payload) override;
+
+  /** \return replayer, available after the transport is connected
+   */
+  util::PacketTraceReplayer*
+  getReplayer() const
+  {
+    return m_replayer.get();
+  }
+
+  /** \return number of blocks sent through (and discarded by) this transport
+   */
+  size_t
+  getNSent() const
+  {
+    return m_nSent;
+  }
+
+private:
+  std::vector<util::TraceRecord> m_records;
+  double m_speedup;
+  unique_ptr<util::PacketTraceReplayer> m_replayer;
+  size_t m_nSent = 0;
+};
+
+} // namespace ndn
+
+#endif // NDN_TRANSPORT_CAPTURE_TRANSPORT_HPP
@@ -42,8 +42,7 @@ class StreamTransportImpl : public std::enable_shared_from_this<StreamTransportI
 {
 public:
   using Impl = StreamTransportImpl<BaseTransport, Protocol>;
-  using BlockSequence = std::list<Block>;
-  using TransmissionQueue = std::list<BlockSequence>;
+  using TransmissionQueue = std::list<WireSequence>;
 
   StreamTransportImpl(BaseTransport& transport, boost::asio::io_service& ioService)
     : m_transport(transport)
@@ -59,13 +58,7 @@ public:
       return;
     }
     m_isConnecting = true;
-
-    // Wait at most 4 seconds to connect
-    /// @todo Decide whether this number should be configurable
-    m_connectTimer.expires_from_now(std::chrono::seconds(4));
-    m_connectTimer.async_wait([self = this->shared_from_this()] (const auto& error) {
-      self->connectTimeoutHandler(error);
-    });
+    startConnectTimer();
 
     m_socket.open();
     m_socket.async_connect(endpoint, [self = this->shared_from_this()] (const auto& error) {
@@ -113,24 +106,59 @@ public:
     }
   }
 
+  int
+  getNativeHandle()
+  {
+    return m_socket.is_open() ? m_socket.native_handle() : -1;
+  }
+
+  optional<time::steady_clock::TimePoint>
+  getConnectDeadline() const
+  {
+    if (!m_isConnecting) {
+      return nullopt;
+    }
+    return m_connectDeadline;
+  }
+
   void
   send(const Block& wire)
   {
-    BlockSequence sequence;
-    sequence.push_back(wire);
-    send(std::move(sequence));
+    send(WireSequence{wire});
   }
 
   void
   send(const Block& header, const Block& payload)
   {
-    BlockSequence sequence;
-    sequence.push_back(header);
-    sequence.push_back(payload);
-    send(std::move(sequence));
+    send(WireSequence{header, payload});
+  }
+
+  void
+  send(WireSequence&& sequence)
+  {
+    m_transmissionQueue.push_back(std::move(sequence));
+
+    if (m_transport.m_isConnected && m_transmissionQueue.size() == 1) {
+      asyncWrite();
+    }
+
+    // if not connected or there is transmission in progress (m_transmissionQueue.size() > 1),
+    // next write will be scheduled either in connectHandler or in asyncWriteHandler
   }
 
 protected:
+  void
+  startConnectTimer()
+  {
+    // Wait at most 4 seconds to connect
+    /// @todo Decide whether this number should be configurable
+    m_connectTimer.expires_from_now(std::chrono::seconds(4));
+    m_connectTimer.async_wait([self = this->shared_from_this()] (const auto& error) {
+      self->connectTimeoutHandler(error);
+    });
+    m_connectDeadline = time::steady_clock::now() + 4_s;
+  }
+
   void
   connectHandler(const boost::system::error_code& error)
   {
@@ -161,19 +189,6 @@ protected:
     NDN_THROW(Transport::Error(error, "error while connecting to the forwarder"));
   }
 
-  void
-  send(BlockSequence&& sequence)
-  {
-    m_transmissionQueue.emplace_back(sequence);
-
-    if (m_transport.m_isConnected && m_transmissionQueue.size() == 1) {
-      asyncWrite();
-    }
-
-    // if not connected or there is transmission in progress (m_transmissionQueue.size() > 1),
-    // next write will be scheduled either in connectHandler or in asyncWriteHandler
-  }
-
   void
   asyncWrite()
   {
@@ -252,17 +267,19 @@ protected:
   bool
   processAllReceived(uint8_t* buffer, size_t& offset, size_t nBytesAvailable)
   {
-    while (offset < nBytesAvailable) {
-      bool isOk = false;
-      Block element;
-      std::tie(isOk, element) = Block::fromBuffer(buffer + offset, nBytesAvailable - offset);
-      if (!isOk)
-        return false;
-
+    // locate all complete packets and their sub-elements in one pass, then deliver them in order
+    m_elementBounds.clear();
+    m_childBounds.clear();
+    size_t base = offset;
+    tlv::scanElements(buffer + base, nBytesAvailable - base, m_elementBounds, m_childBounds);
+
+    for (const auto& e : m_elementBounds) {
+      auto wire = make_shared<Buffer>(buffer + base + e.begin, buffer + base + e.end);
+      Block element(wire, wire->begin(), e, m_childBounds);
       m_transport.m_receiveCallback(element);
-      offset += element.size();
+      offset = base + e.end;
     }
-    return true;
+    return offset == nBytesAvailable;
   }
 
 protected:
@@ -271,9 +288,12 @@ protected:
   typename Protocol::socket m_socket;
   uint8_t m_inputBuffer[MAX_NDN_PACKET_SIZE];
   size_t m_inputBufferSize = 0;
+  std::vector<tlv::ElementBounds> m_elementBounds;
+  std::vector<tlv::ElementBounds> m_childBounds;
 
   TransmissionQueue m_transmissionQueue;
   boost::asio::steady_timer m_connectTimer;
+  time::steady_clock::TimePoint m_connectDeadline;
   bool m_isConnecting = false;
 };
 
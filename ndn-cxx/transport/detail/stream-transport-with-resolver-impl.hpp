@@ -46,13 +46,7 @@ public:
       return;
     }
     this->m_isConnecting = true;
-
-    // Wait at most 4 seconds to connect
-    /// @todo Decide whether this number should be configurable
-    this->m_connectTimer.expires_from_now(std::chrono::seconds(4));
-    this->m_connectTimer.async_wait([self = this->shared_from_base()] (const auto& ec) {
-      self->connectTimeoutHandler(ec);
-    });
+    this->startConnectTimer();
 
     auto resolver = make_shared<typename Protocol::resolver>(this->m_socket
 #if BOOST_VERSION >= 107000
@@ -105,6 +105,13 @@ TcpTransport::send(const Block& header, const Block& payload)
   m_impl->send(header, payload);
 }
 
+void
+TcpTransport::send(const WireSequence& sequence)
+{
+  BOOST_ASSERT(m_impl != nullptr);
+  m_impl->send(WireSequence(sequence));
+}
+
 void
 TcpTransport::close()
 {
@@ -131,4 +138,16 @@ TcpTransport::resume()
   m_impl->resume();
 }
 
+int
+TcpTransport::getNativeHandle() const
+{
+  return m_impl != nullptr ? m_impl->getNativeHandle() : -1;
+}
+
+optional<time::steady_clock::TimePoint>
+TcpTransport::getConnectDeadline() const
+{
+  return m_impl != nullptr ? m_impl->getConnectDeadline() : nullopt;
+}
+
 } // namespace ndn
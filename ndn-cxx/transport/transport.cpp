@@ -37,4 +37,22 @@ Transport::connect(boost::asio::io_service& ioService, ReceiveCallback receiveCa
   m_receiveCallback = std::move(receiveCallback);
 }
 
+void
+Transport::send(const WireSequence& sequence)
+{
+  send(concatenate(sequence));
+}
+
+int
+Transport::getNativeHandle() const
+{
+  return -1;
+}
+
+optional<time::steady_clock::TimePoint>
+Transport::getConnectDeadline() const
+{
+  return nullopt;
+}
+
 } // namespace ndn
@@ -25,6 +25,8 @@
 #include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/detail/common.hpp"
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/wire-sequence.hpp"
+#include "ndn-cxx/util/time.hpp"
 
 #include <boost/system/error_code.hpp>
 
@@ -75,6 +77,15 @@ public:
   virtual void
   send(const Block& header, const Block& payload) = 0;
 
+  /** \brief send a sequence of memory regions through the transport
+   *
+   *  The regions together form one TLV block. Scatter/gather API is utilized where available,
+   *  so that the regions are sent without being copied into a contiguous buffer.
+   *  The default implementation concatenates the regions and calls send(const Block&).
+   */
+  virtual void
+  send(const WireSequence& sequence);
+
   /** \brief pause the transport
    *  \post the receive callback will not be invoked
    *  \note This operation has no effect if transport has been paused,
@@ -91,6 +102,22 @@ public:
   virtual void
   resume() = 0;
 
+  /** \brief get the file descriptor of the underlying socket
+   *  \return the file descriptor, or -1 if the transport is not backed by a socket or the socket
+   *          is not open
+   *
+   *  The descriptor becomes readable when incoming data is available, which allows an external
+   *  event loop to decide when to call Face::poll(). It must not be read from or closed directly.
+   */
+  virtual int
+  getNativeHandle() const;
+
+  /** \brief get the time at which a pending connection attempt times out
+   *  \retval nullopt no connection attempt is in progress
+   */
+  virtual optional<time::steady_clock::TimePoint>
+  getConnectDeadline() const;
+
   /** \retval true connection has been established
    *  \retval false connection is not yet established or has been closed
    */
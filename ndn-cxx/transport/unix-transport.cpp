@@ -103,6 +103,13 @@ UnixTransport::send(const Block& header, const Block& payload)
   m_impl->send(header, payload);
 }
 
+void
+UnixTransport::send(const WireSequence& sequence)
+{
+  BOOST_ASSERT(m_impl != nullptr);
+  m_impl->send(WireSequence(sequence));
+}
+
 void
 UnixTransport::close()
 {
@@ -129,4 +136,16 @@ UnixTransport::resume()
   m_impl->resume();
 }
 
+int
+UnixTransport::getNativeHandle() const
+{
+  return m_impl != nullptr ? m_impl->getNativeHandle() : -1;
+}
+
+optional<time::steady_clock::TimePoint>
+UnixTransport::getConnectDeadline() const
+{
+  return m_impl != nullptr ? m_impl->getConnectDeadline() : nullopt;
+}
+
 } // namespace ndn
@@ -58,12 +58,21 @@ public:
   void
   resume() override;
 
+  int
+  getNativeHandle() const override;
+
+  optional<time::steady_clock::TimePoint>
+  getConnectDeadline() const override;
+
   void
   send(const Block& wire) override;
 
   void
   send(const Block& header, const Block& payload) override;
 
+  void
+  send(const WireSequence& sequence) override;
+
   /** \brief Create transport with parameters defined in URI
    *  \throw Transport::Error incorrect URI or unsupported protocol is specified
    */
@@ -0,0 +1,771 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_COROUTINE_HPP
+#define NDN_CXX_UTIL_COROUTINE_HPP
+
+/** @file
+ *  @brief C++20 coroutine adapters for Face, SegmentFetcher, and Validator.
+ *
+ *  The library itself is built as C++14; this header is self-contained and only usable from
+ *  translation units compiled with coroutine support (e.g., `-std=c++20`). It wraps the existing
+ *  callback APIs, so it adds no dependency on the library being built in C++20 mode.
+ *  If the library was built as C++14, the consumer must select the same vocabulary types by
+ *  defining `any_CONFIG_SELECT_ANY=1`, `optional_CONFIG_SELECT_OPTIONAL=1`, and
+ *  `variant_CONFIG_SELECT_VARIANT=1`; otherwise ndn::optional etc. map to their std counterparts
+ *  and the ABI no longer matches.
+ *
+ *  @code
+ *  coro::Task<void>
+ *  fetch(Face& face, security::Validator& validator)
+ *  {
+ *    auto result = co_await coro::express(face, Interest("/example/data"));
+ *    if (result.status != coro::ExpressResult::Status::DATA)
+ *      co_return;
+ *    if (auto vr = co_await coro::validate(validator, *result.data); !vr)
+ *      co_return;
+ *    ...
+ *  }
+ *
+ *  coro::spawn(face.getIoService(), fetch(face, validator));
+ *  face.processEvents();
+ *  @endcode
+ */
+
+#include "ndn-cxx/face.hpp"
+#include "ndn-cxx/security/validator.hpp"
+#include "ndn-cxx/util/segment-fetcher.hpp"
+#include "ndn-cxx/util/signal/scoped-connection.hpp"
+
+#include <boost/asio/io_service.hpp>
+
+#ifndef __cpp_impl_coroutine
+#error "ndn-cxx/util/coroutine.hpp requires a compiler with C++20 coroutine support"
+#endif
+
+#include <array>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <utility>
+
+namespace ndn {
+namespace coro {
+
+namespace detail {
+
+/** @brief Thread-local recycling allocator for coroutine frames.
+ *
+ *  Frames are grouped into size classes of 64 octets; up to 64 freed frames per class are kept
+ *  for reuse, so a steady stream of short-lived coroutines does not hit the global allocator.
+ *  Frames larger than the biggest class are passed through to the global allocator.
+ */
+class FramePool
+{
+public:
+  static void*
+  allocate(std::size_t size)
+  {
+    std::size_t sizeClass = getSizeClass(size);
+    if (sizeClass >= N_SIZE_CLASSES) {
+      return ::operator new(size);
+    }
+
+    FreeList& list = getFreeLists()[sizeClass];
+    if (list.head != nullptr) {
+      Node* node = list.head;
+      list.head = node->next;
+      --list.count;
+      return node;
+    }
+    return ::operator new((sizeClass + 1) * GRANULARITY);
+  }
+
+  static void
+  deallocate(void* ptr, std::size_t size) noexcept
+  {
+    std::size_t sizeClass = getSizeClass(size);
+    if (sizeClass < N_SIZE_CLASSES) {
+      FreeList& list = getFreeLists()[sizeClass];
+      if (list.count < MAX_CACHED_PER_CLASS) {
+        auto node = static_cast<Node*>(ptr);
+        node->next = list.head;
+        list.head = node;
+        ++list.count;
+        return;
+      }
+    }
+    ::operator delete(ptr);
+  }
+
+private:
+  struct Node
+  {
+    Node* next;
+  };
+
+  struct FreeList
+  {
+    ~FreeList()
+    {
+      while (head != nullptr) {
+        Node* node = head;
+        head = node->next;
+        ::operator delete(node);
+      }
+    }
+
+    Node* head = nullptr;
+    std::size_t count = 0;
+  };
+
+  static constexpr std::size_t GRANULARITY = 64;
+  static constexpr std::size_t N_SIZE_CLASSES = 32;
+  static constexpr std::size_t MAX_CACHED_PER_CLASS = 64;
+
+  static std::size_t
+  getSizeClass(std::size_t size) noexcept
+  {
+    return size == 0 ? 0 : (size - 1) / GRANULARITY;
+  }
+
+  static std::array<FreeList, N_SIZE_CLASSES>&
+  getFreeLists() noexcept
+  {
+    static thread_local std::array<FreeList, N_SIZE_CLASSES> lists;
+    return lists;
+  }
+};
+
+/** @brief Base of promise types whose coroutine frames are allocated from FramePool.
+ */
+struct PooledFrame
+{
+  static void*
+  operator new(std::size_t size)
+  {
+    return FramePool::allocate(size);
+  }
+
+  static void
+  operator delete(void* ptr, std::size_t size) noexcept
+  {
+    FramePool::deallocate(ptr, size);
+  }
+};
+
+template<typename T>
+class TaskPromise;
+
+} // namespace detail
+
+/** @brief Lazily started coroutine that produces a value of type @p T.
+ *
+ *  The coroutine body starts running when the Task is first awaited, and resumes its awaiter
+ *  via symmetric transfer when it finishes. An exception escaping the body is rethrown from
+ *  the `co_await` expression. A Task that is never awaited can be handed to spawn().
+ */
+template<typename T = void>
+class Task
+{
+public:
+  using promise_type = detail::TaskPromise<T>;
+  using Handle = std::coroutine_handle<promise_type>;
+
+  Task() noexcept = default;
+
+  explicit
+  Task(Handle handle) noexcept
+    : m_handle(handle)
+  {
+  }
+
+  Task(Task&& other) noexcept
+    : m_handle(std::exchange(other.m_handle, nullptr))
+  {
+  }
+
+  Task&
+  operator=(Task&& other) noexcept
+  {
+    if (this != &other) {
+      if (m_handle) {
+        m_handle.destroy();
+      }
+      m_handle = std::exchange(other.m_handle, nullptr);
+    }
+    return *this;
+  }
+
+  ~Task()
+  {
+    if (m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  bool
+  isDone() const noexcept
+  {
+    return !m_handle || m_handle.done();
+  }
+
+  auto
+  operator co_await() const noexcept
+  {
+    struct Awaiter
+    {
+      bool
+      await_ready() const noexcept
+      {
+        return !handle || handle.done();
+      }
+
+      std::coroutine_handle<>
+      await_suspend(std::coroutine_handle<> awaiting) noexcept
+      {
+        handle.promise().setContinuation(awaiting);
+        return handle;
+      }
+
+      decltype(auto)
+      await_resume()
+      {
+        return handle.promise().getResult();
+      }
+
+      Handle handle;
+    };
+    return Awaiter{m_handle};
+  }
+
+private:
+  Handle m_handle;
+};
+
+namespace detail {
+
+class TaskPromiseBase : public PooledFrame
+{
+private:
+  /** @brief Resumes the awaiting coroutine, if any, via symmetric transfer
+   */
+  struct FinalAwaiter
+  {
+    bool
+    await_ready() const noexcept
+    {
+      return false;
+    }
+
+    template<typename Promise>
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<Promise> self) noexcept
+    {
+      auto continuation = self.promise().m_continuation;
+      return continuation ? continuation : std::noop_coroutine();
+    }
+
+    void
+    await_resume() const noexcept
+    {
+    }
+  };
+
+public:
+  std::suspend_always
+  initial_suspend() const noexcept
+  {
+    return {};
+  }
+
+  auto
+  final_suspend() const noexcept
+  {
+    return FinalAwaiter{};
+  }
+
+  void
+  unhandled_exception() noexcept
+  {
+    m_exception = std::current_exception();
+  }
+
+  void
+  setContinuation(std::coroutine_handle<> continuation) noexcept
+  {
+    m_continuation = continuation;
+  }
+
+protected:
+  void
+  rethrowIfFailed() const
+  {
+    if (m_exception) {
+      std::rethrow_exception(m_exception);
+    }
+  }
+
+private:
+  std::coroutine_handle<> m_continuation;
+  std::exception_ptr m_exception;
+};
+
+template<typename T>
+class TaskPromise : public TaskPromiseBase
+{
+public:
+  Task<T>
+  get_return_object() noexcept
+  {
+    return Task<T>(Task<T>::Handle::from_promise(*this));
+  }
+
+  template<typename U>
+  void
+  return_value(U&& value)
+  {
+    m_value.emplace(std::forward<U>(value));
+  }
+
+  T
+  getResult()
+  {
+    rethrowIfFailed();
+    return std::move(*m_value);
+  }
+
+private:
+  optional<T> m_value;
+};
+
+template<>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+  Task<void>
+  get_return_object() noexcept
+  {
+    return Task<void>(Task<void>::Handle::from_promise(*this));
+  }
+
+  void
+  return_void() const noexcept
+  {
+  }
+
+  void
+  getResult() const
+  {
+    rethrowIfFailed();
+  }
+};
+
+/** @brief Eagerly started, self-destroying coroutine used by spawn().
+ */
+struct Detached
+{
+  struct promise_type : PooledFrame
+  {
+    Detached
+    get_return_object() const noexcept
+    {
+      return {};
+    }
+
+    std::suspend_never
+    initial_suspend() const noexcept
+    {
+      return {};
+    }
+
+    std::suspend_never
+    final_suspend() const noexcept
+    {
+      return {};
+    }
+
+    void
+    return_void() const noexcept
+    {
+    }
+
+    void
+    unhandled_exception() const noexcept
+    {
+      // runDetached catches everything itself
+      std::terminate();
+    }
+  };
+};
+
+inline Detached
+runDetached(boost::asio::io_service& io, Task<void> task)
+{
+  std::exception_ptr exception;
+  try {
+    co_await task;
+  }
+  catch (...) {
+    exception = std::current_exception();
+  }
+
+  if (exception) {
+    io.post([exception] { std::rethrow_exception(exception); });
+  }
+}
+
+} // namespace detail
+
+/** @brief Starts @p task without awaiting it.
+ *
+ *  The task runs synchronously until its first suspension point. An exception escaping the
+ *  task is rethrown from @p io (e.g., from Face::processEvents), the same way an exception
+ *  thrown by a callback would be.
+ */
+inline void
+spawn(boost::asio::io_service& io, Task<void> task)
+{
+  detail::runDetached(io, std::move(task));
+}
+
+/** @brief Outcome of an Interest expressed with express().
+ */
+struct ExpressResult
+{
+  enum class Status {
+    DATA,
+    NACK,
+    TIMEOUT,
+  };
+
+  Status status = Status::TIMEOUT;
+  optional<Data> data;    ///< set if status is DATA
+  optional<lp::Nack> nack; ///< set if status is NACK
+};
+
+/** @brief Awaitable returned by express().
+ *
+ *  The pending Interest is cancelled if the awaiting coroutine is destroyed before it is
+ *  satisfied. The callbacks only capture a pointer to the awaiter, so they fit into the small
+ *  object buffer of std::function and expressing an Interest does not allocate on their behalf.
+ */
+class ExpressAwaiter
+{
+public:
+  ExpressAwaiter(Face& face, const Interest& interest)
+    : m_face(face)
+    , m_interest(interest)
+  {
+  }
+
+  bool
+  await_ready() const noexcept
+  {
+    return false;
+  }
+
+  void
+  await_suspend(std::coroutine_handle<> handle)
+  {
+    // Face never invokes these callbacks from within expressInterest
+    m_handle = handle;
+    m_pendingInterest = m_face.expressInterest(m_interest,
+      [this] (const Interest&, const Data& data) {
+        m_result.status = ExpressResult::Status::DATA;
+        m_result.data = data;
+        m_handle.resume();
+      },
+      [this] (const Interest&, const lp::Nack& nack) {
+        m_result.status = ExpressResult::Status::NACK;
+        m_result.nack = nack;
+        m_handle.resume();
+      },
+      [this] (const Interest&) {
+        m_result.status = ExpressResult::Status::TIMEOUT;
+        m_handle.resume();
+      });
+  }
+
+  ExpressResult
+  await_resume() noexcept
+  {
+    m_pendingInterest.release();
+    return std::move(m_result);
+  }
+
+private:
+  Face& m_face;
+  const Interest& m_interest;
+  std::coroutine_handle<> m_handle;
+  ScopedPendingInterestHandle m_pendingInterest;
+  ExpressResult m_result;
+};
+
+/** @brief Expresses @p interest on @p face and suspends until Data, Nack, or timeout.
+ *  @note @p interest must remain valid until the returned awaitable has been awaited.
+ */
+inline ExpressAwaiter
+express(Face& face, const Interest& interest)
+{
+  return ExpressAwaiter(face, interest);
+}
+
+/** @brief Outcome of validate().
+ */
+struct ValidationResult
+{
+  explicit
+  operator bool() const noexcept
+  {
+    return !error;
+  }
+
+  optional<security::ValidationError> error; ///< unset if validation succeeded
+};
+
+/** @brief Awaitable returned by validate().
+ *
+ *  Validation that completes synchronously (e.g., with an accept-all policy) does not suspend
+ *  the awaiting coroutine.
+ *
+ *  @warning Validator offers no cancellation, so the awaiting coroutine must not be destroyed
+ *           while validation is in progress.
+ */
+class ValidateAwaiter
+{
+public:
+  ValidateAwaiter(security::Validator& validator, const Data& data)
+    : m_validator(validator)
+    , m_data(data)
+  {
+  }
+
+  bool
+  await_ready() const noexcept
+  {
+    return false;
+  }
+
+  bool
+  await_suspend(std::coroutine_handle<> handle)
+  {
+    m_handle = handle;
+    m_isStarting = true;
+    m_validator.validate(m_data,
+      [this] (const Data&) {
+        complete();
+      },
+      [this] (const Data&, const security::ValidationError& error) {
+        m_result.error = error;
+        complete();
+      });
+    m_isStarting = false;
+    return !m_isDone;
+  }
+
+  ValidationResult
+  await_resume() noexcept
+  {
+    return std::move(m_result);
+  }
+
+private:
+  void
+  complete()
+  {
+    m_isDone = true;
+    if (!m_isStarting) {
+      m_handle.resume();
+    }
+  }
+
+private:
+  security::Validator& m_validator;
+  const Data& m_data;
+  std::coroutine_handle<> m_handle;
+  ValidationResult m_result;
+  bool m_isStarting = false;
+  bool m_isDone = false;
+};
+
+/** @brief Validates @p data with @p validator and suspends until the outcome is known.
+ *  @note @p data must remain valid until the returned awaitable has been awaited.
+ */
+inline ValidateAwaiter
+validate(security::Validator& validator, const Data& data)
+{
+  return ValidateAwaiter(validator, data);
+}
+
+/** @brief Error reported by SegmentStream when the underlying SegmentFetcher fails.
+ */
+class SegmentFetchError : public std::runtime_error
+{
+public:
+  SegmentFetchError(uint32_t code, const std::string& what)
+    : std::runtime_error(what)
+    , m_code(code)
+  {
+  }
+
+  /** @return one of util::SegmentFetcher::ErrorCode
+   */
+  uint32_t
+  getCode() const noexcept
+  {
+    return m_code;
+  }
+
+private:
+  uint32_t m_code;
+};
+
+/** @brief Sequence of in-order segment payloads, fetched by a SegmentFetcher.
+ *
+ *  @code
+ *  coro::SegmentStream stream(face, Interest("/example/file"), validator);
+ *  while (auto segment = co_await stream.next()) {
+ *    write((*segment)->data(), (*segment)->size());
+ *  }
+ *  @endcode
+ *
+ *  Segments are buffered while nobody awaits them; the awaiting coroutine is resumed from the
+ *  face's io_service rather than from inside the fetcher's signal handlers, so it may freely
+ *  destroy the stream. Destroying the stream stops the fetcher.
+ */
+class SegmentStream : noncopyable
+{
+public:
+  /** @brief Starts fetching.
+   *
+   *  The arguments are forwarded to util::SegmentFetcher::start, except that
+   *  util::SegmentFetcher::Options::inOrder is always enabled.
+   */
+  SegmentStream(Face& face, const Interest& baseInterest, security::Validator& validator,
+                util::SegmentFetcher::Options options = {})
+    : m_face(face)
+    , m_token(std::make_shared<int>(0))
+  {
+    options.inOrder = true;
+    m_fetcher = util::SegmentFetcher::start(face, baseInterest, validator, options);
+    m_onData = m_fetcher->onInOrderData.connect([this] (ConstBufferPtr segment) {
+      m_segments.push_back(std::move(segment));
+      scheduleResume();
+    });
+    m_onComplete = m_fetcher->onInOrderComplete.connect([this] {
+      m_isFinished = true;
+      scheduleResume();
+    });
+    m_onError = m_fetcher->onError.connect([this] (uint32_t code, const std::string& msg) {
+      m_error.emplace(code, msg);
+      m_isFinished = true;
+      scheduleResume();
+    });
+  }
+
+  ~SegmentStream()
+  {
+    m_fetcher->stop();
+  }
+
+  /** @brief Awaitable that yields the next segment payload.
+   *
+   *  It yields nullopt after the last segment, or throws SegmentFetchError if fetching failed.
+   */
+  auto
+  next() noexcept
+  {
+    struct NextAwaiter
+    {
+      bool
+      await_ready() const noexcept
+      {
+        return !self.m_segments.empty() || self.m_isFinished;
+      }
+
+      void
+      await_suspend(std::coroutine_handle<> handle) noexcept
+      {
+        self.m_waiter = handle;
+      }
+
+      optional<ConstBufferPtr>
+      await_resume()
+      {
+        if (!self.m_segments.empty()) {
+          ConstBufferPtr segment = std::move(self.m_segments.front());
+          self.m_segments.pop_front();
+          return segment;
+        }
+        if (self.m_error) {
+          throw *self.m_error;
+        }
+        return nullopt;
+      }
+
+      SegmentStream& self;
+    };
+    return NextAwaiter{*this};
+  }
+
+  const util::SegmentFetcher&
+  getFetcher() const noexcept
+  {
+    return *m_fetcher;
+  }
+
+private:
+  void
+  scheduleResume()
+  {
+    if (!m_waiter || m_isResumeScheduled) {
+      return;
+    }
+
+    m_isResumeScheduled = true;
+    m_face.getIoService().post([this, token = std::weak_ptr<int>(m_token)] {
+      if (token.expired()) {
+        return;
+      }
+      m_isResumeScheduled = false;
+      std::exchange(m_waiter, nullptr).resume();
+    });
+  }
+
+private:
+  Face& m_face;
+  shared_ptr<util::SegmentFetcher> m_fetcher;
+  util::signal::ScopedConnection m_onData;
+  util::signal::ScopedConnection m_onComplete;
+  util::signal::ScopedConnection m_onError;
+  std::deque<ConstBufferPtr> m_segments;
+  optional<SegmentFetchError> m_error;
+  std::coroutine_handle<> m_waiter;
+  std::shared_ptr<int> m_token; ///< expires when the stream is destroyed
+  bool m_isFinished = false;
+  bool m_isResumeScheduled = false;
+};
+
+} // namespace coro
+} // namespace ndn
+
+#endif // NDN_CXX_UTIL_COROUTINE_HPP
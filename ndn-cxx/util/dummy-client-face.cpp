@@ -59,6 +59,8 @@ public:
   {
   }
 
+  using ndn::Transport::send;
+
   void
   send(const Block& wire) override
   {
@@ -286,6 +288,12 @@ DummyClientFace::receive(const lp::Nack& nack)
   static_pointer_cast<Transport>(getTransport())->receive(lpPacket.wireEncode());
 }
 
+void
+DummyClientFace::receive(const Block& wire)
+{
+  static_pointer_cast<Transport>(getTransport())->receive(wire);
+}
+
 void
 DummyClientFace::linkTo(DummyClientFace& other)
 {
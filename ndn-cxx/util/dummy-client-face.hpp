@@ -115,6 +115,12 @@ public:
   void
   receive(const lp::Nack& nack);
 
+  /** \brief cause the Face to receive a TLV block, such as an LpPacket from a packet trace
+   *  \sa util::PacketTraceReplayer
+   */
+  void
+  receive(const Block& wire);
+
   /** \brief link another DummyClientFace through a broadcast media
    */
   void
@@ -21,18 +21,157 @@
 
 #include "ndn-cxx/util/io.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
-#include "ndn-cxx/security/transform/base64-decode.hpp"
 #include "ndn-cxx/security/transform/base64-encode.hpp"
 #include "ndn-cxx/security/transform/buffer-source.hpp"
 #include "ndn-cxx/security/transform/hex-decode.hpp"
 #include "ndn-cxx/security/transform/hex-encode.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/stream-source.hpp"
-#include "ndn-cxx/security/transform/strip-space.hpp"
+
+#include <array>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 namespace ndn {
 namespace io {
 
+const size_t READ_CHUNK_SIZE = 65536;
+
+/** \brief Passes the contents of \p is to \p consume in chunks, until EOF.
+ */
+template<typename Consume>
+static void
+readChunks(std::istream& is, const Consume& consume)
+{
+  if (!is) {
+    NDN_THROW(Error("Input stream in bad state"));
+  }
+
+  std::vector<char> chunk(READ_CHUNK_SIZE);
+  while (is) {
+    is.read(chunk.data(), chunk.size());
+    consume(reinterpret_cast<const uint8_t*>(chunk.data()), static_cast<size_t>(is.gcount()));
+  }
+  if (is.bad()) {
+    NDN_THROW(Error("Error reading input stream"));
+  }
+}
+
+/** \brief Returns the number of bytes between the current position of \p is and its end,
+ *         or nullopt if the stream is not seekable.
+ */
+static optional<size_t>
+getRemainingSize(std::istream& is)
+{
+  auto pos = is.tellg();
+  if (pos < 0) {
+    return nullopt;
+  }
+  is.seekg(0, std::ios_base::end);
+  auto end = is.tellg();
+  is.clear();
+  is.seekg(pos);
+  if (end < pos || !is) {
+    return nullopt;
+  }
+  return static_cast<size_t>(end - pos);
+}
+
+/** \brief Incremental base64 decoder that skips whitespace.
+ *
+ *  This avoids the transform chain and the intermediate copies it makes, which dominate
+ *  the cost of loading many base64-encoded certificates.
+ */
+class Base64Decoder
+{
+public:
+  explicit
+  Base64Decoder(Buffer& out)
+    : m_out(out)
+  {
+  }
+
+  void
+  decode(const uint8_t* buf, size_t size)
+  {
+    static const auto table = makeTable();
+
+    for (const uint8_t* end = buf + size; buf != end; ++buf) {
+      int8_t sextet = table[*buf];
+      if (sextet >= 0) {
+        if (m_nPadding > 0) {
+          NDN_THROW(Error("Base64 data after padding"));
+        }
+        m_quantum = (m_quantum << 6) | static_cast<uint32_t>(sextet);
+        if (++m_nSextets == 4) {
+          m_out.push_back(static_cast<uint8_t>(m_quantum >> 16));
+          m_out.push_back(static_cast<uint8_t>(m_quantum >> 8));
+          m_out.push_back(static_cast<uint8_t>(m_quantum));
+          m_quantum = 0;
+          m_nSextets = 0;
+        }
+      }
+      else if (sextet == PADDING) {
+        if (m_nSextets + m_nPadding < 2 || ++m_nPadding > 2) {
+          NDN_THROW(Error("Invalid base64 padding"));
+        }
+      }
+      else if (sextet != WHITESPACE) {
+        NDN_THROW(Error("Invalid base64 character"));
+      }
+    }
+  }
+
+  void
+  end()
+  {
+    switch (m_nSextets) {
+      case 0:
+        break;
+      case 2:
+        m_out.push_back(static_cast<uint8_t>(m_quantum >> 4));
+        break;
+      case 3:
+        m_out.push_back(static_cast<uint8_t>(m_quantum >> 10));
+        m_out.push_back(static_cast<uint8_t>(m_quantum >> 2));
+        break;
+      default:
+        NDN_THROW(Error("Truncated base64 data"));
+    }
+  }
+
+private:
+  enum : int8_t {
+    INVALID = -1,
+    WHITESPACE = -2,
+    PADDING = -3,
+  };
+
+  static std::array<int8_t, 256>
+  makeTable()
+  {
+    std::array<int8_t, 256> table;
+    table.fill(INVALID);
+    const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (int8_t i = 0; i < 64; ++i) {
+      table[static_cast<uint8_t>(alphabet[i])] = i;
+    }
+    for (char c : {' ', '\t', '\n', '\v', '\f', '\r'}) {
+      table[static_cast<uint8_t>(c)] = WHITESPACE;
+    }
+    table['='] = PADDING;
+    return table;
+  }
+
+private:
+  Buffer& m_out;
+  uint32_t m_quantum = 0;
+  int m_nSextets = 0;
+  int m_nPadding = 0;
+};
+
 shared_ptr<Buffer>
 loadBuffer(std::istream& is, IoEncoding encoding)
 {
@@ -41,12 +180,27 @@ loadBuffer(std::istream& is, IoEncoding encoding)
   OBufferStream os;
   try {
     switch (encoding) {
-      case NO_ENCODING:
-        t::streamSource(is) >> t::streamSink(os);
-        return os.buf();
-      case BASE64:
-        t::streamSource(is) >> t::stripSpace("\n") >> t::base64Decode(false) >> t::streamSink(os);
-        return os.buf();
+      case NO_ENCODING: {
+        auto buf = make_shared<Buffer>();
+        readChunks(is, [&] (const uint8_t* chunk, size_t size) {
+          buf->insert(buf->end(), chunk, chunk + size);
+        });
+        return buf;
+      }
+      case BASE64: {
+        auto buf = make_shared<Buffer>();
+        // reserve once if the input size is known, otherwise rely on geometric growth
+        auto inputSize = getRemainingSize(is);
+        if (inputSize) {
+          buf->reserve(*inputSize / 4 * 3);
+        }
+        Base64Decoder decoder(*buf);
+        readChunks(is, [&] (const uint8_t* chunk, size_t size) {
+          decoder.decode(chunk, size);
+        });
+        decoder.end();
+        return buf;
+      }
       case HEX:
         t::streamSource(is) >> t::hexDecode() >> t::streamSink(os);
         return os.buf();
@@ -59,6 +213,56 @@ loadBuffer(std::istream& is, IoEncoding encoding)
   NDN_THROW(std::invalid_argument("Unknown IoEncoding " + to_string(encoding)));
 }
 
+static std::vector<Block>
+splitBlocks(ConstBufferPtr buffer)
+{
+  std::vector<Block> blocks;
+  size_t offset = 0;
+  while (offset < buffer->size()) {
+    bool isOk = false;
+    Block block;
+    std::tie(isOk, block) = Block::fromBuffer(buffer, offset);
+    if (!isOk) {
+      NDN_THROW(Error("Malformed or truncated TLV block at offset " + to_string(offset)));
+    }
+    offset += block.size();
+    blocks.push_back(std::move(block));
+  }
+  return blocks;
+}
+
+std::vector<Block>
+loadBlocks(std::istream& is, IoEncoding encoding)
+{
+  return splitBlocks(loadBuffer(is, encoding));
+}
+
+std::vector<Block>
+loadBlocks(const std::string& filename, IoEncoding encoding)
+{
+  std::ifstream is(filename, std::ios_base::binary | std::ios_base::ate);
+  if (!is) {
+    NDN_THROW(Error("Cannot open " + filename));
+  }
+
+  if (encoding != NO_ENCODING) {
+    is.seekg(0);
+    return loadBlocks(is, encoding);
+  }
+
+  // read the whole file with a single allocation
+  auto size = is.tellg();
+  if (size < 0) {
+    NDN_THROW(Error("Cannot determine size of " + filename));
+  }
+  auto buf = make_shared<Buffer>(static_cast<size_t>(size));
+  is.seekg(0);
+  if (!is.read(reinterpret_cast<char*>(buf->data()), buf->size())) {
+    NDN_THROW(Error("Error reading " + filename));
+  }
+  return splitBlocks(std::move(buf));
+}
+
 optional<Block>
 loadBlock(std::istream& is, IoEncoding encoding)
 {
@@ -104,5 +308,56 @@ saveBlock(const Block& block, std::ostream& os, IoEncoding encoding)
   saveBuffer(block.wire(), block.size(), os, encoding);
 }
 
+namespace detail {
+
+void
+parallelFor(size_t n, size_t nThreads, const std::function<void(size_t)>& fn)
+{
+  if (nThreads == 0) {
+    nThreads = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+  nThreads = std::min(nThreads, n);
+  if (nThreads <= 1) {
+    for (size_t i = 0; i < n; ++i) {
+      fn(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next(0);
+  std::exception_ptr error;
+  std::mutex errorMutex;
+  auto run = [&] {
+    for (size_t i = next++; i < n; i = next++) {
+      try {
+        fn(i);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (error == nullptr) {
+          error = std::current_exception();
+        }
+        next = n; // skip the remaining indexes
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(nThreads - 1);
+  for (size_t i = 1; i < nThreads; ++i) {
+    threads.emplace_back(run);
+  }
+  run();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace detail
+
 } // namespace io
 } // namespace ndn
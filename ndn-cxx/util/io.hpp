@@ -46,7 +46,7 @@ enum IoEncoding {
   /** \brief Base64 encoding
    *
    *  `save()` inserts a newline after every 64 characters,
-   *  `load()` can accept base64 text with or without newlines.
+   *  `load()` can accept base64 text with or without newlines or other whitespace.
    */
   BASE64,
 
@@ -74,6 +74,15 @@ checkInnerError(...)
   // T::Error is not defined
 }
 
+/** \brief Invokes \p fn for every index in [0, \p n) on up to \p nThreads threads.
+ *  \param nThreads number of threads; zero means the number of hardware threads
+ *
+ *  If \p fn throws, the indexes not yet started are skipped, and the first exception is
+ *  rethrown on the calling thread after all threads have finished.
+ */
+void
+parallelFor(size_t n, size_t nThreads, const std::function<void(size_t)>& fn);
+
 } // namespace detail
 
 /** \brief Reads bytes from a stream until EOF.
@@ -90,6 +99,28 @@ loadBuffer(std::istream& is, IoEncoding encoding = BASE64);
 optional<Block>
 loadBlock(std::istream& is, IoEncoding encoding = BASE64);
 
+/** \brief Reads a sequence of concatenated TLV blocks from a stream.
+ *
+ *  The stream is decoded into a single Buffer, and the returned Blocks refer to slices of
+ *  that Buffer without copying.
+ *
+ *  \throw Error error during loading, or a TLV block is malformed or truncated
+ *  \throw std::invalid_argument the specified encoding is not supported
+ */
+std::vector<Block>
+loadBlocks(std::istream& is, IoEncoding encoding = NO_ENCODING);
+
+/** \brief Reads a file of concatenated TLV blocks.
+ *
+ *  The file is read into a single Buffer, sized in advance when the encoding is NO_ENCODING,
+ *  and the returned Blocks refer to slices of that Buffer without copying.
+ *
+ *  \throw Error error during loading, or a TLV block is malformed or truncated
+ *  \throw std::invalid_argument the specified encoding is not supported
+ */
+std::vector<Block>
+loadBlocks(const std::string& filename, IoEncoding encoding = NO_ENCODING);
+
 /** \brief Reads a TLV element from a stream.
  *  \tparam T type of TLV element; `T` must be WireDecodable and the nested type
  *            `T::Error`, if defined, must be a subclass of ndn::tlv::Error
@@ -128,6 +159,25 @@ load(const std::string& filename, IoEncoding encoding = BASE64)
   return load<T>(is, encoding);
 }
 
+/** \brief Reads TLV elements from many files in parallel.
+ *  \tparam T type of TLV element; `T` must be WireDecodable and the nested type
+ *            `T::Error`, if defined, must be a subclass of ndn::tlv::Error;
+ *            decoding distinct instances of `T` must be thread-safe
+ *  \param nThreads number of threads; zero means the number of hardware threads
+ *  \return the TLV elements in the order of \p filenames; an element is nullptr if
+ *          the corresponding file cannot be loaded or decoded
+ */
+template<typename T>
+std::vector<shared_ptr<T>>
+loadMany(const std::vector<std::string>& filenames, IoEncoding encoding = BASE64, size_t nThreads = 0)
+{
+  std::vector<shared_ptr<T>> results(filenames.size());
+  detail::parallelFor(filenames.size(), nThreads, [&] (size_t i) {
+    results[i] = load<T>(filenames[i], encoding);
+  });
+  return results;
+}
+
 /** \brief Writes a byte buffer to a stream.
  *  \throw Error error during saving
  *  \throw std::invalid_argument the specified encoding is not supported
@@ -26,11 +26,16 @@
 #include "ndn-cxx/name.hpp"
 #include "ndn-cxx/security/key-chain.hpp"
 #include "ndn-cxx/util/concepts.hpp"
+#include "ndn-cxx/util/scheduler.hpp"
 
 namespace ndn {
 namespace util {
 
 /** \brief provides a publisher of Notification Stream
+ *
+ *  Each Data packet of the stream carries one or more notifications in its Content,
+ *  and is named with the next sequence number.
+ *
  *  \sa https://redmine.named-data.net/projects/nfd/wiki/Notification
  */
 template<typename Notification>
@@ -44,20 +49,81 @@ public:
     , m_prefix(prefix)
     , m_keyChain(keyChain)
     , m_sequenceNo(0)
+    , m_scheduler(face.getIoService())
   {
   }
 
+  /** \note Notifications that are still pending in a batch are discarded;
+   *        call flush() beforehand to publish them.
+   */
   virtual
   ~NotificationStream() = default;
 
+  /** \brief aggregate notifications into batches
+   *  \param window maximum time a notification is held before it is published
+   *  \param maxBatchSize maximum number of notifications in one Data packet;
+   *                      1 disables batching
+   *  \throw std::invalid_argument \p maxBatchSize is zero
+   *
+   *  A batch is published when it reaches \p maxBatchSize notifications, when the next
+   *  notification would not fit into the same packet, or when \p window has elapsed since
+   *  its first notification was posted, whichever comes first.
+   *  Each batch is signed once and consumes one sequence number.
+   */
+  void
+  setBatching(time::nanoseconds window, size_t maxBatchSize)
+  {
+    if (maxBatchSize == 0) {
+      NDN_THROW(std::invalid_argument("maxBatchSize must be positive"));
+    }
+
+    flush();
+    m_batchWindow = window;
+    m_maxBatchSize = maxBatchSize;
+  }
+
   void
   postNotification(const Notification& notification)
   {
+    Block wire = notification.wireEncode();
+    if (!m_batch.empty() && m_batchBytes + wire.size() > MAX_BATCH_BYTES) {
+      flush();
+    }
+
+    m_batchBytes += wire.size();
+    m_batch.push_back(std::move(wire));
+
+    if (m_batch.size() >= m_maxBatchSize) {
+      flush();
+    }
+    else if (m_batch.size() == 1) {
+      m_flushEvent = m_scheduler.schedule(m_batchWindow, [this] { flush(); });
+    }
+  }
+
+  /** \brief publish pending notifications immediately
+   */
+  void
+  flush()
+  {
+    if (m_batch.empty()) {
+      return;
+    }
+    m_flushEvent.cancel();
+
+    Block content(tlv::Content);
+    for (const Block& wire : m_batch) {
+      content.push_back(wire);
+    }
+    content.encode();
+    m_batch.clear();
+    m_batchBytes = 0;
+
     Name dataName = m_prefix;
     dataName.appendSequenceNumber(m_sequenceNo);
 
     shared_ptr<Data> data = make_shared<Data>(dataName);
-    data->setContent(notification.wireEncode());
+    data->setContent(content);
     data->setFreshnessPeriod(1_s);
 
     m_keyChain.sign(*data);
@@ -67,10 +133,22 @@ public:
   }
 
 private:
+  /** \brief maximum encoded size of notifications in one batch,
+   *         leaving room for Name, MetaInfo and signature
+   */
+  static constexpr size_t MAX_BATCH_BYTES = MAX_NDN_PACKET_SIZE / 2;
+
   Face& m_face;
   const Name m_prefix;
   KeyChain& m_keyChain;
   uint64_t m_sequenceNo;
+
+  time::nanoseconds m_batchWindow = 0_ns;
+  size_t m_maxBatchSize = 1;
+  std::vector<Block> m_batch;
+  size_t m_batchBytes = 0;
+  Scheduler m_scheduler;
+  scheduler::ScopedEventId m_flushEvent;
 };
 
 } // namespace util
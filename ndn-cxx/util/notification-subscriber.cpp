@@ -43,11 +43,28 @@ NotificationSubscriberBase::NotificationSubscriberBase(Face& face, const Name& p
   , m_attempts(1)
   , m_scheduler(face.getIoService())
   , m_interestLifetime(interestLifetime)
+  , m_maxWindow(1)
+  , m_window(1)
+  , m_nextSequenceNum(0)
 {
 }
 
 NotificationSubscriberBase::~NotificationSubscriberBase() = default;
 
+void
+NotificationSubscriberBase::setPipelineSize(size_t n)
+{
+  if (n == 0) {
+    NDN_THROW(std::invalid_argument("pipeline size must be positive"));
+  }
+
+  m_maxWindow = n;
+  m_window = n;
+  if (m_isRunning && !m_pipeline.empty()) {
+    fillPipeline();
+  }
+}
+
 void
 NotificationSubscriberBase::start()
 {
@@ -66,6 +83,14 @@ NotificationSubscriberBase::stop()
   m_isRunning = false;
 
   m_lastInterest.cancel();
+  resetPipeline();
+}
+
+void
+NotificationSubscriberBase::resetPipeline()
+{
+  m_pipeline.clear();
+  m_reorderBuffer.clear();
 }
 
 void
@@ -74,35 +99,46 @@ NotificationSubscriberBase::sendInitialInterest()
   if (shouldStop())
     return;
 
+  resetPipeline();
+
   auto interest = make_shared<Interest>(m_prefix);
   interest->setCanBePrefix(true);
   interest->setMustBeFresh(true);
   interest->setInterestLifetime(m_interestLifetime);
-  sendInterest(*interest);
+  m_lastInterest = m_face.expressInterest(*interest,
+                                          [this] (const auto&, const auto& d) { this->afterReceiveData(d); },
+                                          [this] (const auto&, const auto& n) { this->afterReceiveNack(n); },
+                                          [this] (const auto&) { this->afterTimeout(); });
 }
 
 void
-NotificationSubscriberBase::sendNextInterest()
+NotificationSubscriberBase::sendNextInterest(uint64_t seqNo)
 {
-  if (shouldStop())
-    return;
-
   Name nextName = m_prefix;
-  nextName.appendSequenceNumber(m_lastSequenceNum + 1);
+  nextName.appendSequenceNumber(seqNo);
 
   auto interest = make_shared<Interest>(nextName);
   interest->setCanBePrefix(false);
   interest->setInterestLifetime(m_interestLifetime);
-  sendInterest(*interest);
+  m_pipeline[seqNo] = m_face.expressInterest(*interest,
+    [this, seqNo] (const auto&, const auto& d) { this->afterReceiveNextData(seqNo, d); },
+    [this, seqNo] (const auto&, const auto& n) {
+      if (m_pipeline.count(seqNo) > 0) {
+        this->afterReceiveNack(n);
+      }
+    },
+    [this, seqNo] (const auto&) { this->afterNextTimeout(seqNo); });
 }
 
 void
-NotificationSubscriberBase::sendInterest(const Interest& interest)
+NotificationSubscriberBase::fillPipeline()
 {
-  m_lastInterest = m_face.expressInterest(interest,
-                                          [this] (const auto&, const auto& d) { this->afterReceiveData(d); },
-                                          [this] (const auto&, const auto& n) { this->afterReceiveNack(n); },
-                                          [this] (const auto&) { this->afterTimeout(); });
+  if (shouldStop())
+    return;
+
+  while (m_nextSequenceNum <= m_lastSequenceNum + m_window) {
+    sendNextInterest(m_nextSequenceNum++);
+  }
 }
 
 bool
@@ -124,8 +160,9 @@ NotificationSubscriberBase::afterReceiveData(const Data& data)
   if (shouldStop())
     return;
 
+  uint64_t seqNo;
   try {
-    m_lastSequenceNum = data.getName().get(-1).toSequenceNumber();
+    seqNo = data.getName().get(-1).toSequenceNumber();
   }
   catch (const tlv::Error&) {
     onDecodeError(data);
@@ -133,13 +170,57 @@ NotificationSubscriberBase::afterReceiveData(const Data& data)
     return;
   }
 
+  if (m_lastSequenceNum != std::numeric_limits<uint64_t>::max() && seqNo > m_lastSequenceNum + 1) {
+    onGap(m_lastSequenceNum + 1, seqNo - 1);
+  }
+  m_lastSequenceNum = seqNo;
+
   if (!decodeAndDeliver(data)) {
     onDecodeError(data);
     sendInitialInterest();
     return;
   }
 
-  sendNextInterest();
+  m_nextSequenceNum = seqNo + 1;
+  fillPipeline();
+}
+
+void
+NotificationSubscriberBase::afterReceiveNextData(uint64_t seqNo, const Data& data)
+{
+  if (shouldStop())
+    return;
+
+  // ignore Data for an Interest that has been canceled but not yet removed from the Face
+  if (m_pipeline.erase(seqNo) == 0 || seqNo <= m_lastSequenceNum) {
+    return;
+  }
+
+  m_reorderBuffer.emplace(seqNo, data);
+  if (deliverInOrder()) {
+    fillPipeline();
+  }
+}
+
+bool
+NotificationSubscriberBase::deliverInOrder()
+{
+  while (!m_reorderBuffer.empty() && m_reorderBuffer.begin()->first == m_lastSequenceNum + 1) {
+    Data data = std::move(m_reorderBuffer.begin()->second);
+    m_reorderBuffer.erase(m_reorderBuffer.begin());
+    ++m_lastSequenceNum;
+
+    if (!decodeAndDeliver(data)) {
+      onDecodeError(data);
+      sendInitialInterest();
+      return false;
+    }
+    if (shouldStop())
+      return false;
+
+    m_window = std::min(m_window + 1, m_maxWindow);
+  }
+  return true;
 }
 
 void
@@ -150,6 +231,13 @@ NotificationSubscriberBase::afterReceiveNack(const lp::Nack& nack)
 
   onNack(nack);
 
+  if (nack.getReason() == lp::NackReason::CONGESTION) {
+    m_window = std::max<size_t>(m_window / 2, 1);
+    onBackpressure(m_window);
+  }
+
+  // resynchronize with the latest Data after backing off
+  resetPipeline();
   time::milliseconds delay = exponentialBackoff(nack);
   m_nackEvent = m_scheduler.schedule(delay, [this] { sendInitialInterest(); });
 }
@@ -165,6 +253,33 @@ NotificationSubscriberBase::afterTimeout()
   sendInitialInterest();
 }
 
+void
+NotificationSubscriberBase::afterNextTimeout(uint64_t seqNo)
+{
+  if (shouldStop() || m_pipeline.erase(seqNo) == 0)
+    return;
+
+  if (seqNo > m_lastSequenceNum + 1) {
+    // still waiting for an earlier sequence number
+    sendNextInterest(seqNo);
+    return;
+  }
+
+  if (m_reorderBuffer.empty()) {
+    afterTimeout();
+    return;
+  }
+
+  // later Data have arrived, so the sequence numbers before them are considered lost
+  uint64_t lastMissing = m_reorderBuffer.begin()->first - 1;
+  m_pipeline.erase(m_pipeline.begin(), m_pipeline.upper_bound(lastMissing));
+  onGap(seqNo, lastMissing);
+  m_lastSequenceNum = lastMissing;
+  if (deliverInOrder()) {
+    fillPipeline();
+  }
+}
+
 time::milliseconds
 NotificationSubscriberBase::exponentialBackoff(lp::Nack nack)
 {
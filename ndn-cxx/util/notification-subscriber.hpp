@@ -34,6 +34,8 @@
 #include "ndn-cxx/util/signal.hpp"
 #include "ndn-cxx/util/time.hpp"
 
+#include <map>
+
 namespace ndn {
 namespace util {
 
@@ -60,6 +62,25 @@ public:
     return m_isRunning;
   }
 
+  /** \return maximum number of outstanding Interests for consecutive sequence numbers
+   */
+  size_t
+  getPipelineSize() const
+  {
+    return m_maxWindow;
+  }
+
+  /** \brief set maximum number of outstanding Interests for consecutive sequence numbers
+   *  \throw std::invalid_argument \p n is zero
+   *
+   *  With a pipeline size greater than one, the subscriber requests the next \p n sequence
+   *  numbers at once, and delivers notifications in sequence order. The number of outstanding
+   *  Interests is halved upon a Nack with reason Congestion (see onBackpressure), and grows
+   *  back by one with every Data packet delivered.
+   */
+  void
+  setPipelineSize(size_t n);
+
   /** \brief start or resume receiving notifications
    *  \note onNotification must have at least one listener,
    *        otherwise this operation has no effect.
@@ -85,10 +106,12 @@ private:
   sendInitialInterest();
 
   void
-  sendNextInterest();
+  sendNextInterest(uint64_t seqNo);
 
+  /** \brief send Interests until the pipeline is full
+   */
   void
-  sendInterest(const Interest& interest);
+  fillPipeline();
 
   virtual bool
   hasSubscriber() const = 0;
@@ -102,7 +125,16 @@ private:
   void
   afterReceiveData(const Data& data);
 
-  /** \brief decode the Data as a notification, and deliver it to subscribers
+  void
+  afterReceiveNextData(uint64_t seqNo, const Data& data);
+
+  /** \brief deliver buffered Data packets that immediately follow the last delivered one
+   *  \return false if the subscriber has been stopped or restarted
+   */
+  bool
+  deliverInOrder();
+
+  /** \brief decode the Data as notifications, and deliver them to subscribers
    *  \return whether decode was successful
    */
   virtual bool
@@ -114,6 +146,14 @@ private:
   void
   afterTimeout();
 
+  void
+  afterNextTimeout(uint64_t seqNo);
+
+  /** \brief cancel outstanding Interests for sequence numbers and discard buffered Data
+   */
+  void
+  resetPipeline();
+
   time::milliseconds
   exponentialBackoff(lp::Nack nack);
 
@@ -130,6 +170,16 @@ public:
    */
   signal::Signal<NotificationSubscriberBase, Data> onDecodeError;
 
+  /** \brief fires when Data packets with sequence numbers in the closed range [first, last]
+   *         will not be delivered, because later Data packets have been received
+   */
+  signal::Signal<NotificationSubscriberBase, uint64_t, uint64_t> onGap;
+
+  /** \brief fires when a Nack with reason Congestion is received,
+   *         with the reduced number of outstanding Interests
+   */
+  signal::Signal<NotificationSubscriberBase, size_t> onBackpressure;
+
 private:
   Face& m_face;
   Name m_prefix;
@@ -141,6 +191,12 @@ private:
   scheduler::ScopedEventId m_nackEvent;
   ScopedPendingInterestHandle m_lastInterest;
   time::milliseconds m_interestLifetime;
+
+  size_t m_maxWindow;
+  size_t m_window;
+  uint64_t m_nextSequenceNum;
+  std::map<uint64_t, ScopedPendingInterestHandle> m_pipeline;
+  std::map<uint64_t, Data> m_reorderBuffer;
 };
 
 /** \brief provides a subscriber of Notification Stream
@@ -180,15 +236,25 @@ private:
   bool
   decodeAndDeliver(const Data& data) override
   {
-    Notification notification;
+    std::vector<Notification> notifications;
     try {
-      notification.wireDecode(data.getContent().blockFromValue());
+      const Block& content = data.getContent();
+      content.parse();
+      if (content.elements().empty()) {
+        return false;
+      }
+      for (const Block& element : content.elements()) {
+        notifications.emplace_back();
+        notifications.back().wireDecode(element);
+      }
     }
     catch (const tlv::Error&) {
       return false;
     }
 
-    onNotification(notification);
+    for (const auto& notification : notifications) {
+      onNotification(notification);
+    }
     return true;
   }
 };
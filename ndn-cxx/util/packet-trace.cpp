@@ -0,0 +1,193 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/packet-trace.hpp"
+
+#include <boost/endian/conversion.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+namespace ndn {
+namespace util {
+
+const char TRACE_MAGIC[] = {'N', 'D', 'N', 'T', 'R', 'C', '0', '1'};
+const size_t RECORD_HEADER_SIZE = sizeof(uint64_t) + sizeof(uint8_t);
+
+std::ostream&
+operator<<(std::ostream& os, TraceDirection direction)
+{
+  switch (direction) {
+    case TraceDirection::INCOMING:
+      return os << "incoming";
+    case TraceDirection::OUTGOING:
+      return os << "outgoing";
+  }
+  return os << static_cast<unsigned>(direction);
+}
+
+PacketTraceWriter::PacketTraceWriter(std::ostream& os)
+  : m_os(os)
+{
+  m_os.write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+}
+
+void
+PacketTraceWriter::write(TraceDirection direction, const Block& wire)
+{
+  write({time::system_clock::now(), direction, wire});
+}
+
+void
+PacketTraceWriter::write(const TraceRecord& record)
+{
+  uint8_t header[RECORD_HEADER_SIZE];
+  auto ns = time::duration_cast<time::nanoseconds>(record.timestamp.time_since_epoch()).count();
+  uint64_t timestamp = boost::endian::native_to_big(static_cast<uint64_t>(ns));
+  std::memcpy(header, &timestamp, sizeof(timestamp));
+  header[sizeof(uint64_t)] = static_cast<uint8_t>(record.direction);
+
+  m_os.write(reinterpret_cast<const char*>(header), sizeof(header));
+  m_os.write(reinterpret_cast<const char*>(record.wire.wire()), record.wire.size());
+  ++m_nRecords;
+}
+
+void
+PacketTraceWriter::flush()
+{
+  m_os.flush();
+}
+
+PacketTraceReader::PacketTraceReader(std::istream& is)
+  : m_is(is)
+{
+  char magic[sizeof(TRACE_MAGIC)];
+  if (!m_is.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), TRACE_MAGIC)) {
+    NDN_THROW(Error("Not a packet trace file"));
+  }
+}
+
+optional<TraceRecord>
+PacketTraceReader::read()
+{
+  uint8_t header[RECORD_HEADER_SIZE];
+  m_is.read(reinterpret_cast<char*>(header), sizeof(header));
+  if (m_is.gcount() == 0) {
+    return nullopt;
+  }
+  if (static_cast<size_t>(m_is.gcount()) != sizeof(header)) {
+    NDN_THROW(Error("Truncated trace record header"));
+  }
+
+  TraceRecord record;
+  uint64_t timestamp;
+  std::memcpy(&timestamp, header, sizeof(timestamp));
+  auto ns = static_cast<time::nanoseconds::rep>(boost::endian::big_to_native(timestamp));
+  record.timestamp = time::system_clock::TimePoint(time::nanoseconds(ns));
+  uint8_t direction = header[sizeof(uint64_t)];
+  if (direction > static_cast<uint8_t>(TraceDirection::OUTGOING)) {
+    NDN_THROW(Error("Unrecognized trace record direction " + to_string(direction)));
+  }
+  record.direction = static_cast<TraceDirection>(direction);
+
+  try {
+    record.wire = Block::fromStream(m_is);
+  }
+  catch (const tlv::Error&) {
+    NDN_THROW_NESTED(Error("Malformed or truncated TLV block in trace record"));
+  }
+  return record;
+}
+
+std::vector<TraceRecord>
+PacketTraceReader::readAll()
+{
+  std::vector<TraceRecord> records;
+  while (auto record = read()) {
+    records.push_back(std::move(*record));
+  }
+  return records;
+}
+
+PacketTraceReplayer::PacketTraceReplayer(boost::asio::io_service& ioService,
+                                         std::vector<TraceRecord> records, double speedup)
+  : m_records(std::move(records))
+  , m_speedup(speedup)
+  , m_scheduler(ioService)
+{
+  if (!(m_speedup > 0.0)) {
+    NDN_THROW(std::invalid_argument("speedup must be positive"));
+  }
+}
+
+void
+PacketTraceReplayer::start(Sink sink)
+{
+  BOOST_ASSERT(sink != nullptr);
+
+  m_sink = std::move(sink);
+  m_next = 0;
+  m_nReplayed = 0;
+  m_startTime = time::steady_clock::now();
+  scheduleNext();
+}
+
+void
+PacketTraceReplayer::stop()
+{
+  m_event.cancel();
+  m_sink = nullptr;
+}
+
+void
+PacketTraceReplayer::scheduleNext()
+{
+  while (m_next < m_records.size() && m_records[m_next].direction != TraceDirection::INCOMING) {
+    ++m_next;
+  }
+  if (m_next >= m_records.size()) {
+    m_sink = nullptr;
+    onFinished();
+    return;
+  }
+
+  // intervals are measured from the first record, so that timer drift does not accumulate
+  time::nanoseconds offset = m_records[m_next].timestamp - m_records.front().timestamp;
+  time::nanoseconds delay(0);
+  if (!std::isinf(m_speedup)) {
+    auto scaled = time::nanoseconds(static_cast<time::nanoseconds::rep>(offset.count() / m_speedup));
+    delay = std::max(m_startTime + scaled - time::steady_clock::now(), time::nanoseconds(0));
+  }
+
+  m_event = m_scheduler.schedule(delay, [this] {
+    Sink sink = m_sink;
+    sink(m_records[m_next++].wire);
+    ++m_nReplayed;
+    if (m_sink != nullptr) {
+      scheduleNext();
+    }
+  });
+}
+
+} // namespace util
+} // namespace ndn
@@ -0,0 +1,200 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_UTIL_PACKET_TRACE_HPP
+#define NDN_UTIL_PACKET_TRACE_HPP
+
+#include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/util/scheduler.hpp"
+#include "ndn-cxx/util/signal.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <iosfwd>
+
+namespace ndn {
+namespace util {
+
+/** \brief direction of a packet in a trace, relative to the application
+ */
+enum class TraceDirection : uint8_t {
+  INCOMING = 0, ///< received by the application
+  OUTGOING = 1, ///< sent by the application
+};
+
+std::ostream&
+operator<<(std::ostream& os, TraceDirection direction);
+
+/** \brief a TLV block captured from a Transport
+ */
+struct TraceRecord
+{
+  time::system_clock::TimePoint timestamp;
+  TraceDirection direction;
+  Block wire;
+};
+
+/** \brief writes a packet trace file
+ *
+ *  A trace file starts with the 8-octet magic string "NDNTRC01". Each record consists of
+ *  the capture time in nanoseconds since the UNIX epoch as an 8-octet big-endian integer,
+ *  one octet of TraceDirection, and the captured TLV block. Since TLV blocks are
+ *  self-delimiting, no additional framing is needed.
+ */
+class PacketTraceWriter : noncopyable
+{
+public:
+  /** \brief write the file header to \p os
+   *  \param os output stream, which must remain valid for the lifetime of the writer;
+   *            it should be opened in binary mode
+   */
+  explicit
+  PacketTraceWriter(std::ostream& os);
+
+  /** \brief append a record timestamped with the current system time
+   */
+  void
+  write(TraceDirection direction, const Block& wire);
+
+  /** \brief append a record
+   */
+  void
+  write(const TraceRecord& record);
+
+  void
+  flush();
+
+  /** \return number of records written
+   */
+  size_t
+  getNRecords() const
+  {
+    return m_nRecords;
+  }
+
+private:
+  std::ostream& m_os;
+  size_t m_nRecords = 0;
+};
+
+/** \brief reads a packet trace file written by PacketTraceWriter
+ */
+class PacketTraceReader : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /** \brief read and check the file header from \p is
+   *  \param is input stream, which must remain valid for the lifetime of the reader
+   *  \throw Error the file header is missing or invalid
+   */
+  explicit
+  PacketTraceReader(std::istream& is);
+
+  /** \brief read the next record
+   *  \return the record, or nullopt at the end of the trace
+   *  \throw Error the record is truncated or malformed
+   */
+  optional<TraceRecord>
+  read();
+
+  /** \brief read all remaining records
+   *  \throw Error a record is truncated or malformed
+   */
+  std::vector<TraceRecord>
+  readAll();
+
+private:
+  std::istream& m_is;
+};
+
+/** \brief replays incoming records of a packet trace
+ *
+ *  Each incoming record is passed to a sink, such as the receive callback of a Transport,
+ *  or DummyClientFace::receive, preserving the intervals between the original capture
+ *  timestamps, divided by a speedup factor. Outgoing records are skipped.
+ */
+class PacketTraceReplayer : noncopyable
+{
+public:
+  using Sink = std::function<void(const Block& wire)>;
+
+  /** \param ioService io_service on which replay timers are scheduled
+   *  \param records trace records in capture order
+   *  \param speedup factor by which intervals are shortened; must be positive;
+   *                 use infinity to replay without delays
+   *  \throw std::invalid_argument \p speedup is not positive
+   */
+  PacketTraceReplayer(boost::asio::io_service& ioService, std::vector<TraceRecord> records,
+                      double speedup = 1.0);
+
+  /** \brief start replaying from the first record
+   *  \param sink receives each incoming TLV block; must not be empty
+   */
+  void
+  start(Sink sink);
+
+  /** \brief stop replaying
+   */
+  void
+  stop();
+
+  bool
+  isRunning() const
+  {
+    return m_sink != nullptr;
+  }
+
+  /** \return number of records passed to the sink
+   */
+  size_t
+  getNReplayed() const
+  {
+    return m_nReplayed;
+  }
+
+public:
+  /** \brief fires after the last incoming record has been replayed
+   */
+  signal::Signal<PacketTraceReplayer> onFinished;
+
+private:
+  void
+  scheduleNext();
+
+private:
+  std::vector<TraceRecord> m_records;
+  double m_speedup;
+  Sink m_sink;
+  size_t m_next = 0;
+  size_t m_nReplayed = 0;
+  time::steady_clock::TimePoint m_startTime;
+  Scheduler m_scheduler;
+  scheduler::ScopedEventId m_event;
+};
+
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_UTIL_PACKET_TRACE_HPP
@@ -22,6 +22,12 @@
 #include "ndn-cxx/util/random.hpp"
 #include "ndn-cxx/security/impl/openssl.hpp"
 
+#include <array>
+#include <atomic>
+#include <cstring>
+
+#include <pthread.h>
+
 namespace ndn {
 namespace random {
 
@@ -50,6 +56,137 @@ generateSecureBytes(uint8_t* bytes, size_t size)
   }
 }
 
+namespace {
+
+/** @brief Incremented in the child process after each fork().
+ *
+ *  A forked child inherits the keystream state of its parent, so each NonceStream discards
+ *  its state when it observes a new generation.
+ */
+std::atomic<uint64_t> g_forkGeneration{0};
+
+void
+registerForkHandler()
+{
+  static const int res = pthread_atfork(nullptr, nullptr, [] { ++g_forkGeneration; });
+  if (res != 0) {
+    NDN_THROW(std::runtime_error("pthread_atfork() failed"));
+  }
+}
+
+/** @brief Per-thread buffer of AES-128-CTR keystream.
+ */
+class NonceStream : noncopyable
+{
+public:
+  NonceStream()
+    : m_ctx(EVP_CIPHER_CTX_new())
+  {
+    if (m_ctx == nullptr) {
+      NDN_THROW(std::runtime_error("EVP_CIPHER_CTX_new() failed"));
+    }
+    registerForkHandler();
+  }
+
+  ~NonceStream()
+  {
+    EVP_CIPHER_CTX_free(m_ctx);
+  }
+
+  void
+  read(uint8_t* bytes, size_t size)
+  {
+    uint64_t forkGeneration = g_forkGeneration.load(std::memory_order_relaxed);
+    if (forkGeneration != m_forkGeneration) {
+      // never reuse the keystream inherited from the parent process
+      m_forkGeneration = forkGeneration;
+      std::memset(m_buffer.data(), 0, m_buffer.size());
+      m_pos = m_buffer.size();
+      m_nRefills = 0;
+    }
+
+    while (size > 0) {
+      if (m_pos == m_buffer.size()) {
+        refill();
+      }
+      size_t n = std::min(size, m_buffer.size() - m_pos);
+      std::memcpy(bytes, m_buffer.data() + m_pos, n);
+      // erase consumed keystream, so that a later memory disclosure cannot reveal past nonces
+      std::memset(m_buffer.data() + m_pos, 0, n);
+      m_pos += n;
+      bytes += n;
+      size -= n;
+    }
+  }
+
+private:
+  void
+  refill()
+  {
+    if (m_nRefills % REKEY_INTERVAL == 0) {
+      rekey();
+    }
+    ++m_nRefills;
+
+    // the buffer is all zeros at this point, so encrypting it in place yields the keystream
+    int outLen = 0;
+    if (EVP_EncryptUpdate(m_ctx, m_buffer.data(), &outLen,
+                          m_buffer.data(), static_cast<int>(m_buffer.size())) != 1 ||
+        static_cast<size_t>(outLen) != m_buffer.size()) {
+      NDN_THROW(std::runtime_error("Failed to generate nonce keystream"));
+    }
+    m_pos = 0;
+  }
+
+  void
+  rekey()
+  {
+    std::array<uint8_t, 32> keyAndIv;
+    generateSecureBytes(keyAndIv.data(), keyAndIv.size());
+    int res = EVP_EncryptInit_ex(m_ctx, EVP_aes_128_ctr(), nullptr,
+                                 keyAndIv.data(), keyAndIv.data() + 16);
+    std::memset(keyAndIv.data(), 0, keyAndIv.size());
+    if (res != 1) {
+      NDN_THROW(std::runtime_error("Failed to key nonce generator"));
+    }
+  }
+
+private:
+  /// number of refills between rekeying, i.e., rekey after every 1 MiB of output
+  static constexpr uint64_t REKEY_INTERVAL = 256;
+
+  EVP_CIPHER_CTX* m_ctx;
+  std::array<uint8_t, 4096> m_buffer{};
+  size_t m_pos = m_buffer.size();
+  uint64_t m_nRefills = 0;
+  uint64_t m_forkGeneration = g_forkGeneration;
+};
+
+} // namespace
+
+void
+generateNonceBytes(uint8_t* bytes, size_t size)
+{
+  thread_local NonceStream stream;
+  stream.read(bytes, size);
+}
+
+uint32_t
+generateNonceWord32()
+{
+  uint32_t random;
+  generateNonceBytes(reinterpret_cast<uint8_t*>(&random), sizeof(random));
+  return random;
+}
+
+uint64_t
+generateNonceWord64()
+{
+  uint64_t random;
+  generateNonceBytes(reinterpret_cast<uint8_t*>(&random), sizeof(random));
+  return random;
+}
+
 RandomNumberEngine&
 getRandomNumberEngine()
 {
@@ -53,6 +53,33 @@ generateSecureWord64();
 void
 generateSecureBytes(uint8_t* bytes, size_t size);
 
+/**
+ * @brief Fill @p bytes of @p size with unpredictable random bytes suitable for nonces
+ *
+ * The bytes are drawn from a per-thread buffered keystream of AES-128 in counter mode, which
+ * is keyed from generateSecureBytes() and refilled in bulk. This is much cheaper per call than
+ * generateSecureBytes() and, unlike generateWord32(), the output cannot be predicted from
+ * previously observed values. The keystream is periodically rekeyed.
+ *
+ * @throw std::runtime_error if keying the generator fails.
+ */
+void
+generateNonceBytes(uint8_t* bytes, size_t size);
+
+/**
+ * @brief Generate a random integer in the range [0, 2^32) suitable for nonces
+ * @sa generateNonceBytes
+ */
+uint32_t
+generateNonceWord32();
+
+/**
+ * @brief Generate a random integer in the range [0, 2^64) suitable for nonces
+ * @sa generateNonceBytes
+ */
+uint64_t
+generateNonceWord64();
+
 using RandomNumberEngine = std::mt19937;
 
 /**
@@ -129,6 +129,15 @@ Scheduler::cancelAllEvents()
   m_timer->cancel();
 }
 
+optional<time::steady_clock::TimePoint>
+Scheduler::getNextExpiry() const
+{
+  if (m_queue.empty()) {
+    return nullopt;
+  }
+  return (*m_queue.begin())->expireTime;
+}
+
 void
 Scheduler::scheduleNext()
 {
@@ -150,6 +150,12 @@ public:
   void
   cancelAllEvents();
 
+  /** \brief Get the expiration time of the earliest scheduled event
+   *  \retval nullopt no event is scheduled
+   */
+  optional<time::steady_clock::TimePoint>
+  getNextExpiry() const;
+
 private:
   void
   cancelImpl(const shared_ptr<EventInfo>& info);
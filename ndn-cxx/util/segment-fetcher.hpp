@@ -147,7 +147,8 @@ public:
    *                     will propagate to all subsequent Interests. The only exception is that the
    *                     initial Interest will be forced to include the "CanBePrefix=true" and
    *                     "MustBeFresh=true" parameters, which will not be included in subsequent
-   *                     Interests.
+   *                     Interests. Its ForwardingHint, if any, is shared rather than copied by
+   *                     all Interests sent by the fetcher; see SharedForwardingHint.
    * @param validator    Reference to the Validator the fetcher will use to validate data.
    *                     The caller must ensure the validator remains valid until either #onComplete
    *                     or #onError has been signaled.
@@ -0,0 +1,304 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/segmenter.hpp"
+#include "ndn-cxx/detail/thread-pool.hpp"
+#include "ndn-cxx/ims/in-memory-storage.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+
+#include <future>
+
+namespace ndn {
+namespace util {
+
+Segmenter::Segmenter(security::KeyChain& keyChain, const security::SigningInfo& signingInfo)
+  : m_keyChain(keyChain)
+  , m_signingInfo(signingInfo)
+  , m_maxSegmentSize(MAX_NDN_PACKET_SIZE / 2)
+  , m_freshnessPeriod(0_ms)
+  , m_contentType(tlv::ContentType_Blob)
+{
+}
+
+Segmenter::~Segmenter() = default;
+
+Segmenter&
+Segmenter::setMaxSegmentSize(size_t maxSegmentSize)
+{
+  if (maxSegmentSize == 0) {
+    NDN_THROW(std::invalid_argument("maxSegmentSize must be positive"));
+  }
+  m_maxSegmentSize = maxSegmentSize;
+  return *this;
+}
+
+Segmenter&
+Segmenter::setFreshnessPeriod(time::milliseconds freshnessPeriod)
+{
+  m_freshnessPeriod = freshnessPeriod;
+  return *this;
+}
+
+Segmenter&
+Segmenter::setContentType(uint32_t contentType)
+{
+  m_contentType = contentType;
+  return *this;
+}
+
+Segmenter&
+Segmenter::setNThreads(size_t nThreads)
+{
+  if (nThreads == 0) {
+    NDN_THROW(std::invalid_argument("nThreads must be positive"));
+  }
+  if (nThreads != m_nThreads) {
+    // the pool never holds more than two batches' worth of jobs: the current one, and jobs
+    // of the previous batch that have fulfilled their promise but not yet returned
+    m_pool.reset();
+    if (nThreads > 1) {
+      m_pool = make_unique<ndn::detail::ThreadPool>(nThreads - 1, 2 * (nThreads - 1));
+    }
+    m_nThreads = nThreads;
+  }
+  return *this;
+}
+
+Segmenter&
+Segmenter::setBatchSize(size_t batchSize)
+{
+  if (batchSize == 0) {
+    NDN_THROW(std::invalid_argument("batchSize must be positive"));
+  }
+  m_batchSize = batchSize;
+  return *this;
+}
+
+DataTemplate
+Segmenter::makeTemplate(const Name& dataName, optional<uint64_t> finalSegment) const
+{
+  Name versionedName(dataName);
+  if (versionedName.empty() || !versionedName[-1].isVersion()) {
+    versionedName.appendVersion();
+  }
+
+  MetaInfo metaInfo;
+  metaInfo.setType(m_contentType);
+  metaInfo.setFreshnessPeriod(m_freshnessPeriod);
+  if (finalSegment) {
+    metaInfo.setFinalBlock(name::Component::fromSegment(*finalSegment));
+  }
+
+  DataTemplate tpl(versionedName);
+  tpl.setMetaInfo(metaInfo);
+  m_keyChain.prepareTemplate(tpl, m_signingInfo);
+  return tpl;
+}
+
+void
+Segmenter::encodeBatch(const DataTemplate& tpl, const DataTemplate* lastTpl,
+                       const std::vector<std::pair<const uint8_t*, size_t>>& chunks,
+                       uint64_t firstSegment, const DataSink& sink) const
+{
+  std::vector<Block> wires(chunks.size());
+  auto encodeRange = [&] (size_t begin, size_t stride) {
+    for (size_t i = begin; i < chunks.size(); i += stride) {
+      const auto& t = lastTpl != nullptr && i + 1 == chunks.size() ? *lastTpl : tpl;
+      wires[i] = t.encode(PartialName().appendSegment(firstSegment + i),
+                          chunks[i].first, chunks[i].second);
+    }
+  };
+
+  size_t nThreads = std::min(m_nThreads, chunks.size());
+  if (nThreads <= 1) {
+    encodeRange(0, 1);
+  }
+  else {
+    std::vector<std::future<void>> done;
+    done.reserve(nThreads);
+    for (size_t t = 1; t < nThreads; ++t) {
+      auto promise = make_shared<std::promise<void>>();
+      done.push_back(promise->get_future());
+      bool isPosted = m_pool->tryPost([&encodeRange, promise, t, nThreads] {
+        try {
+          encodeRange(t, nThreads);
+          promise->set_value();
+        }
+        catch (...) {
+          promise->set_exception(std::current_exception());
+        }
+      });
+      if (!isPosted) {
+        // the pool is busy with another segment() call on this segmenter
+        done.pop_back();
+        done.push_back(std::async(std::launch::deferred, encodeRange, t, nThreads));
+      }
+    }
+    std::exception_ptr error;
+    try {
+      encodeRange(0, nThreads);
+    }
+    catch (...) {
+      error = std::current_exception();
+    }
+    // wait for every job before rethrowing, because the jobs refer to this stack frame
+    for (auto& f : done) {
+      try {
+        f.get();
+      }
+      catch (...) {
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  for (auto& wire : wires) {
+    sink(make_shared<Data>(std::move(wire)));
+  }
+}
+
+uint64_t
+Segmenter::segment(const Name& dataName, const uint8_t* buffer, size_t bufferSize,
+                   const DataSink& sink) const
+{
+  if (buffer == nullptr && bufferSize != 0) {
+    NDN_THROW(std::invalid_argument("Input buffer cannot be nullptr"));
+  }
+
+  // an empty object is published as a single empty segment
+  uint64_t nSegments = std::max<uint64_t>(1, (bufferSize + m_maxSegmentSize - 1) / m_maxSegmentSize);
+  DataTemplate tpl = makeTemplate(dataName, nSegments - 1);
+
+  std::vector<std::pair<const uint8_t*, size_t>> chunks;
+  chunks.reserve(static_cast<size_t>(std::min<uint64_t>(m_batchSize, nSegments)));
+  for (uint64_t segNo = 0; segNo < nSegments; segNo += chunks.size()) {
+    chunks.clear();
+    for (uint64_t i = segNo; i < nSegments && chunks.size() < m_batchSize; ++i) {
+      size_t offset = static_cast<size_t>(i * m_maxSegmentSize);
+      chunks.emplace_back(buffer + offset, std::min(m_maxSegmentSize, bufferSize - offset));
+    }
+    encodeBatch(tpl, nullptr, chunks, segNo, sink);
+  }
+  return nSegments;
+}
+
+uint64_t
+Segmenter::segment(const Name& dataName, const uint8_t* buffer, size_t bufferSize,
+                   InMemoryStorage& ims) const
+{
+  return segment(dataName, buffer, bufferSize, [&ims] (const shared_ptr<Data>& data) {
+    ims.insert(*data);
+  });
+}
+
+std::vector<shared_ptr<Data>>
+Segmenter::segment(const Name& dataName, const uint8_t* buffer, size_t bufferSize) const
+{
+  std::vector<shared_ptr<Data>> segments;
+  segment(dataName, buffer, bufferSize, [&segments] (const shared_ptr<Data>& data) {
+    segments.push_back(data);
+  });
+  return segments;
+}
+
+/**
+ * @brief Determine the number of bytes remaining in @p input, if it is seekable.
+ */
+static optional<uint64_t>
+getRemainingSize(std::istream& input)
+{
+  auto pos = input.tellg();
+  if (pos == std::istream::pos_type(-1)) {
+    input.clear();
+    return nullopt;
+  }
+
+  input.seekg(0, std::ios::end);
+  auto end = input.tellg();
+  input.clear();
+  input.seekg(pos);
+  if (end == std::istream::pos_type(-1) || end < pos || !input) {
+    input.clear();
+    return nullopt;
+  }
+  return static_cast<uint64_t>(end - pos);
+}
+
+uint64_t
+Segmenter::segment(const Name& dataName, std::istream& input, const DataSink& sink) const
+{
+  optional<uint64_t> finalSegment;
+  auto remaining = getRemainingSize(input);
+  if (remaining) {
+    finalSegment = std::max<uint64_t>(1, (*remaining + m_maxSegmentSize - 1) / m_maxSegmentSize) - 1;
+  }
+  DataTemplate tpl = makeTemplate(dataName, finalSegment);
+
+  // when the input size is unknown, only the last segment carries FinalBlockId,
+  // which is determined by looking ahead one byte after each batch
+  optional<DataTemplate> lastTpl;
+  Buffer buffer(m_batchSize * m_maxSegmentSize);
+  std::vector<std::pair<const uint8_t*, size_t>> chunks;
+  chunks.reserve(m_batchSize);
+
+  uint64_t segNo = 0;
+  bool isEof = false;
+  while (!isEof) {
+    chunks.clear();
+    while (chunks.size() < m_batchSize && !isEof) {
+      auto chunk = buffer.data() + chunks.size() * m_maxSegmentSize;
+      input.read(reinterpret_cast<char*>(chunk), static_cast<std::streamsize>(m_maxSegmentSize));
+      size_t nRead = static_cast<size_t>(input.gcount());
+      isEof = nRead < m_maxSegmentSize || input.peek() == std::istream::traits_type::eof();
+      if (nRead > 0 || (segNo == 0 && chunks.empty())) {
+        chunks.emplace_back(chunk, nRead);
+      }
+    }
+
+    const DataTemplate* last = nullptr;
+    if (isEof && !finalSegment) {
+      lastTpl.emplace(tpl);
+      MetaInfo metaInfo(tpl.getMetaInfo());
+      metaInfo.setFinalBlock(name::Component::fromSegment(segNo + chunks.size() - 1));
+      lastTpl->setMetaInfo(metaInfo);
+      last = &*lastTpl;
+    }
+    encodeBatch(tpl, last, chunks, segNo, sink);
+    segNo += chunks.size();
+  }
+  return segNo;
+}
+
+uint64_t
+Segmenter::segment(const Name& dataName, std::istream& input, InMemoryStorage& ims) const
+{
+  return segment(dataName, input, [&ims] (const shared_ptr<Data>& data) {
+    ims.insert(*data);
+  });
+}
+
+} // namespace util
+} // namespace ndn
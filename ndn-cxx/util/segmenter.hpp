@@ -0,0 +1,211 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_UTIL_SEGMENTER_HPP
+#define NDN_UTIL_SEGMENTER_HPP
+
+#include "ndn-cxx/data-template.hpp"
+#include "ndn-cxx/security/signing-info.hpp"
+
+#include <istream>
+
+namespace ndn {
+
+class InMemoryStorage;
+
+namespace detail {
+class ThreadPool;
+} // namespace detail
+
+namespace security {
+inline namespace v2 {
+class KeyChain;
+} // inline namespace v2
+} // namespace security
+
+namespace util {
+
+/**
+ * @brief Utility class to segment an object into signed %Data packets.
+ *
+ * Segmenter is the producer counterpart of SegmentFetcher. The object is published under
+ * `/<prefix>/<version>/<segment>`; if the name passed to segment() does not end with a version
+ * component, a version component derived from the current time is appended to it.
+ *
+ * Segments are encoded from a pre-signed DataTemplate and signed in batches; each batch is
+ * spread across the calling thread and the worker threads started by setNThreads(), which are
+ * reused for every batch until the segmenter is destroyed. At most setBatchSize() segments are held in
+ * memory before being handed to the sink in segment number order, so that arbitrarily large
+ * inputs can be published with bounded memory.
+ *
+ * Every segment carries a FinalBlockId when the input size is known in advance, i.e., when the
+ * input is a memory buffer (for instance, a memory-mapped file) or a seekable stream.
+ * Otherwise, only the last segment carries a FinalBlockId.
+ *
+ * @code
+ * Segmenter segmenter(keyChain, signingByIdentity("/producer"));
+ * segmenter.setFreshnessPeriod(10_s).setNThreads(4);
+ * std::ifstream file("large-file.bin", std::ios::binary);
+ * segmenter.segment("/producer/large-file", file, ims);
+ * @endcode
+ */
+class Segmenter
+{
+public:
+  /**
+   * @brief Callback that receives each produced segment, in segment number order.
+   */
+  using DataSink = std::function<void(const shared_ptr<Data>& segment)>;
+
+  /**
+   * @brief Create a segmenter that signs with @p keyChain according to @p signingInfo.
+   */
+  Segmenter(security::KeyChain& keyChain, const security::SigningInfo& signingInfo);
+
+  ~Segmenter();
+
+  size_t
+  getMaxSegmentSize() const noexcept
+  {
+    return m_maxSegmentSize;
+  }
+
+  /**
+   * @brief Set the maximum size of the Content of each segment.
+   * @throw std::invalid_argument @p maxSegmentSize is zero
+   */
+  Segmenter&
+  setMaxSegmentSize(size_t maxSegmentSize);
+
+  /**
+   * @brief Set the FreshnessPeriod of produced segments.
+   */
+  Segmenter&
+  setFreshnessPeriod(time::milliseconds freshnessPeriod);
+
+  /**
+   * @brief Set the ContentType of produced segments.
+   */
+  Segmenter&
+  setContentType(uint32_t contentType);
+
+  size_t
+  getNThreads() const noexcept
+  {
+    return m_nThreads;
+  }
+
+  /**
+   * @brief Set the number of threads that sign segments concurrently.
+   *
+   * With one thread (the default), all segments are signed on the calling thread.
+   * Otherwise, `nThreads - 1` worker threads are started immediately and kept for the lifetime
+   * of the segmenter; the calling thread of segment() signs its share of each batch as well.
+   * @throw std::invalid_argument @p nThreads is zero
+   */
+  Segmenter&
+  setNThreads(size_t nThreads);
+
+  size_t
+  getBatchSize() const noexcept
+  {
+    return m_batchSize;
+  }
+
+  /**
+   * @brief Set the number of segments that are encoded and signed before being passed to the sink.
+   *
+   * This bounds the memory used by the segmenter to roughly twice `batchSize * maxSegmentSize`.
+   * @throw std::invalid_argument @p batchSize is zero
+   */
+  Segmenter&
+  setBatchSize(size_t batchSize);
+
+  /**
+   * @brief Segment a memory buffer and pass the segments to @p sink.
+   * @param dataName name of the object, optionally ending with a version component
+   * @return number of segments produced
+   */
+  uint64_t
+  segment(const Name& dataName, const uint8_t* buffer, size_t bufferSize, const DataSink& sink) const;
+
+  /**
+   * @brief Segment a memory buffer and insert the segments into @p ims.
+   * @return number of segments produced
+   */
+  uint64_t
+  segment(const Name& dataName, const uint8_t* buffer, size_t bufferSize, InMemoryStorage& ims) const;
+
+  /**
+   * @brief Segment a memory buffer.
+   * @return all segments, in segment number order
+   */
+  std::vector<shared_ptr<Data>>
+  segment(const Name& dataName, const uint8_t* buffer, size_t bufferSize) const;
+
+  /**
+   * @brief Segment the content of a stream, up to end of file, and pass the segments to @p sink.
+   * @param dataName name of the object, optionally ending with a version component
+   * @return number of segments produced
+   */
+  uint64_t
+  segment(const Name& dataName, std::istream& input, const DataSink& sink) const;
+
+  /**
+   * @brief Segment the content of a stream, up to end of file, and insert the segments into @p ims.
+   * @return number of segments produced
+   */
+  uint64_t
+  segment(const Name& dataName, std::istream& input, InMemoryStorage& ims) const;
+
+private:
+  /**
+   * @brief Prepare a template for the versioned object name, with FinalBlockId if known.
+   */
+  DataTemplate
+  makeTemplate(const Name& dataName, optional<uint64_t> finalSegment) const;
+
+  /**
+   * @brief Encode and sign one batch of segments, then pass them to @p sink.
+   * @param chunks content of each segment in the batch
+   * @param firstSegment segment number of the first chunk
+   * @param lastTpl if not nullptr, template used for the last chunk of the batch
+   */
+  void
+  encodeBatch(const DataTemplate& tpl, const DataTemplate* lastTpl,
+              const std::vector<std::pair<const uint8_t*, size_t>>& chunks,
+              uint64_t firstSegment, const DataSink& sink) const;
+
+private:
+  security::KeyChain& m_keyChain;
+  security::SigningInfo m_signingInfo;
+  size_t m_maxSegmentSize;
+  time::milliseconds m_freshnessPeriod;
+  uint32_t m_contentType;
+  size_t m_nThreads = 1;
+  size_t m_batchSize = 256;
+  unique_ptr<ndn::detail::ThreadPool> m_pool;
+};
+
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_UTIL_SEGMENTER_HPP
@@ -161,7 +161,7 @@ Connection
 Signal<Owner, TArgs...>::connect(Handler handler)
 {
   auto it = m_slots.insert(m_slots.end(), {std::move(handler), nullptr});
-  it->disconnect = make_shared<DisconnectFunction>([=] { disconnect(it); });
+  it->disconnect = make_shared<DisconnectFunction>([this, it] { disconnect(it); });
 
   return signal::Connection(it->disconnect);
 }
@@ -171,7 +171,7 @@ Connection
 Signal<Owner, TArgs...>::connectSingleShot(Handler handler)
 {
   auto it = m_slots.insert(m_slots.end(), {nullptr, nullptr});
-  it->disconnect = make_shared<DisconnectFunction>([=] { disconnect(it); });
+  it->disconnect = make_shared<DisconnectFunction>([this, it] { disconnect(it); });
   signal::Connection conn(it->disconnect);
 
   it->handler = [conn, handler = std::move(handler)] (const TArgs&... args) mutable {
@@ -26,9 +26,29 @@
 namespace ndn {
 namespace util {
 
+Sqlite3StatementCache::Sqlite3StatementCache(sqlite3* database)
+  : m_database(database)
+{
+}
+
+Sqlite3StatementCache::~Sqlite3StatementCache()
+{
+  for (auto& item : m_statements) {
+    BOOST_ASSERT(!item.second.isInUse);
+    sqlite3_finalize(item.second.stmt);
+  }
+}
+
 Sqlite3Statement::~Sqlite3Statement()
 {
-  sqlite3_finalize(m_stmt);
+  if (m_cacheEntry != nullptr) {
+    sqlite3_reset(m_stmt);
+    sqlite3_clear_bindings(m_stmt);
+    m_cacheEntry->isInUse = false;
+  }
+  else {
+    sqlite3_finalize(m_stmt);
+  }
 }
 
 Sqlite3Statement::Sqlite3Statement(sqlite3* database, const std::string& statement)
@@ -38,6 +58,30 @@ Sqlite3Statement::Sqlite3Statement(sqlite3* database, const std::string& stateme
     NDN_THROW(std::domain_error("bad SQL statement: " + statement));
 }
 
+Sqlite3Statement::Sqlite3Statement(Sqlite3StatementCache& cache, const std::string& statement)
+{
+  auto& entry = cache.m_statements[statement];
+  if (entry.isInUse) {
+    // nested use of the same statement, fall back to a non-cached statement
+    int res = sqlite3_prepare_v2(cache.m_database, statement.data(), -1, &m_stmt, nullptr);
+    if (res != SQLITE_OK)
+      NDN_THROW(std::domain_error("bad SQL statement: " + statement));
+    return;
+  }
+
+  if (entry.stmt == nullptr) {
+    int res = sqlite3_prepare_v2(cache.m_database, statement.data(), -1, &entry.stmt, nullptr);
+    if (res != SQLITE_OK) {
+      cache.m_statements.erase(statement);
+      NDN_THROW(std::domain_error("bad SQL statement: " + statement));
+    }
+  }
+
+  entry.isInUse = true;
+  m_stmt = entry.stmt;
+  m_cacheEntry = &entry;
+}
+
 int
 Sqlite3Statement::bind(int index, const char* value, size_t size, void(*destructor)(void*))
 {
@@ -24,12 +24,63 @@
 
 #include "ndn-cxx/encoding/block.hpp"
 
+#include <string>
+#include <unordered_map>
+
 struct sqlite3;
 struct sqlite3_stmt;
 
 namespace ndn {
 namespace util {
 
+/**
+ * @brief cache of SQLite3 prepared statements of one database connection
+ *
+ * Statements used through the cache are prepared once, and reset instead of finalized after
+ * each use, which saves the cost of compiling the SQL on every call.
+ *
+ * @warning This class is implementation detail of ndn-cxx library.
+ */
+class Sqlite3StatementCache : noncopyable
+{
+public:
+  explicit
+  Sqlite3StatementCache(sqlite3* database);
+
+  /**
+   * @brief finalize all cached statements
+   * @note must be destroyed before the database connection is closed
+   */
+  ~Sqlite3StatementCache();
+
+  sqlite3*
+  getDatabase() const
+  {
+    return m_database;
+  }
+
+  /**
+   * @return number of cached statements
+   */
+  size_t
+  size() const
+  {
+    return m_statements.size();
+  }
+
+private:
+  struct Entry
+  {
+    sqlite3_stmt* stmt = nullptr;
+    bool isInUse = false;
+  };
+
+  sqlite3* m_database;
+  std::unordered_map<std::string, Entry> m_statements;
+
+  friend class Sqlite3Statement;
+};
+
 /**
  * @brief wrap an SQLite3 prepared statement
  * @warning This class is implementation detail of ndn-cxx library.
@@ -46,7 +97,19 @@ public:
   Sqlite3Statement(sqlite3* database, const std::string& statement);
 
   /**
-   * @brief finalize the statement
+   * @brief initialize Sqlite3 statement from @p cache, preparing it if not yet cached
+   *
+   * If the cached statement is still in use by another Sqlite3Statement instance,
+   * a fresh statement is prepared instead.
+   *
+   * @param cache statement cache of the database
+   * @param statement SQL statement
+   * @throw std::domain_error SQL statement is bad
+   */
+  Sqlite3Statement(Sqlite3StatementCache& cache, const std::string& statement);
+
+  /**
+   * @brief finalize the statement, or reset it if it belongs to a cache
    */
   ~Sqlite3Statement();
 
@@ -149,6 +212,7 @@ public:
 
 private:
   sqlite3_stmt* m_stmt;
+  Sqlite3StatementCache::Entry* m_cacheEntry = nullptr;
 };
 
 } // namespace util
@@ -26,8 +26,13 @@
 #include "ndn-cxx/security/transform/hex-encode.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 
+#include <cstring>
 #include <sstream>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace ndn {
 
 void
@@ -73,65 +78,149 @@ fromHex(const std::string& hexString)
   return os.buf();
 }
 
-std::string
-escape(const std::string& str)
+static bool
+isUnreserved(char c)
 {
-  std::ostringstream os;
-  escape(os, str.data(), str.size());
-  return os.str();
+  return (c >= 'a' && c <= 'z') ||
+         (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9') ||
+         c == '-' || c == '.' ||
+         c == '_' || c == '~';
 }
 
-void
-escape(std::ostream& os, const char* str, size_t len)
+#ifdef __SSE2__
+/**
+ * @brief Classify 16 characters starting at @p str
+ * @return bitmask in which bit i is set if `str[i]` is an unreserved character
+ */
+static int
+getUnreservedMask(const char* str)
+{
+  __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str));
+  // bytes >= 0x80 compare as negative, hence they never fall into any of the ranges
+  auto inRange = [v] (char lo, char hi) {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(static_cast<char>(lo - 1))),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8(static_cast<char>(hi + 1))));
+  };
+  __m128i mask = _mm_or_si128(_mm_or_si128(inRange('a', 'z'), inRange('A', 'Z')), inRange('0', '9'));
+  mask = _mm_or_si128(mask, _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('-')),
+                                         _mm_cmpeq_epi8(v, _mm_set1_epi8('.'))));
+  mask = _mm_or_si128(mask, _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('_')),
+                                         _mm_cmpeq_epi8(v, _mm_set1_epi8('~'))));
+  return _mm_movemask_epi8(mask);
+}
+#endif // __SSE2__
+
+size_t
+escape(char* out, const char* str, size_t len)
 {
-  for (size_t i = 0; i < len; ++i) {
+  char* p = out;
+  size_t i = 0;
+
+#ifdef __SSE2__
+  while (i + 16 <= len) {
+    int mask = getUnreservedMask(str + i);
+    // copy the leading run of unreserved characters
+    size_t run = mask == 0xFFFF ? 16 : static_cast<size_t>(__builtin_ctz(~mask));
+    std::memcpy(p, str + i, run);
+    p += run;
+    i += run;
+    if (run < 16) {
+      auto c = static_cast<uint8_t>(str[i++]);
+      *p++ = '%';
+      *p++ = toHexChar(c >> 4);
+      *p++ = toHexChar(c & 0xf);
+    }
+  }
+#endif // __SSE2__
+
+  for (; i < len; ++i) {
     auto c = str[i];
     // Unreserved characters don't need to be escaped.
-    if ((c >= 'a' && c <= 'z') ||
-        (c >= 'A' && c <= 'Z') ||
-        (c >= '0' && c <= '9') ||
-        c == '-' || c == '.' ||
-        c == '_' || c == '~') {
-      os << c;
+    if (isUnreserved(c)) {
+      *p++ = c;
     }
     else {
-      os << '%';
-      os << toHexChar((c & 0xf0) >> 4);
-      os << toHexChar(c & 0xf);
+      *p++ = '%';
+      *p++ = toHexChar((c & 0xf0) >> 4);
+      *p++ = toHexChar(c & 0xf);
     }
   }
+  return static_cast<size_t>(p - out);
 }
 
 std::string
-unescape(const std::string& str)
+escape(const std::string& str)
 {
-  std::ostringstream os;
-  unescape(os, str.data(), str.size());
-  return os.str();
+  std::string result(3 * str.size(), '\0');
+  result.resize(escape(&result[0], str.data(), str.size()));
+  return result;
 }
 
 void
-unescape(std::ostream& os, const char* str, size_t len)
+escape(std::ostream& os, const char* str, size_t len)
 {
-  for (size_t i = 0; i < len; ++i) {
-    if (str[i] == '%' && i + 2 < len) {
-      int hi = fromHexChar(str[i + 1]);
-      int lo = fromHexChar(str[i + 2]);
+  // escape in chunks through a stack buffer
+  char buf[3 * 256];
+  for (size_t i = 0; i < len; i += 256) {
+    size_t n = std::min<size_t>(256, len - i);
+    os.write(buf, static_cast<std::streamsize>(escape(buf, str + i, n)));
+  }
+}
 
-      if (hi < 0 || lo < 0)
-        // Invalid hex characters, so just keep the escaped string.
-        os << str[i] << str[i + 1] << str[i + 2];
-      else
-        os << static_cast<char>((hi << 4) | lo);
+size_t
+unescape(char* out, const char* str, size_t len)
+{
+  char* p = out;
+  const char* end = str + len;
+  while (str < end) {
+    // memchr is vectorized by the C library, so runs without '%' are copied in bulk
+    auto pct = static_cast<const char*>(std::memchr(str, '%', static_cast<size_t>(end - str)));
+    size_t run = (pct == nullptr ? end : pct) - str;
+    std::memmove(p, str, run);
+    p += run;
+    str += run;
+    if (pct == nullptr) {
+      break;
+    }
 
+    if (end - str > 2) {
+      int hi = fromHexChar(str[1]);
+      int lo = fromHexChar(str[2]);
+      if (hi < 0 || lo < 0) {
+        // Invalid hex characters, so just keep the escaped string.
+        std::memmove(p, str, 3);
+        p += 3;
+      }
+      else {
+        *p++ = static_cast<char>((hi << 4) | lo);
+      }
       // Skip ahead past the escaped value.
-      i += 2;
+      str += 3;
     }
     else {
       // Just copy through.
-      os << str[i];
+      std::memmove(p, str, static_cast<size_t>(end - str));
+      p += end - str;
+      str = end;
     }
   }
+  return static_cast<size_t>(p - out);
+}
+
+std::string
+unescape(const std::string& str)
+{
+  std::string result(str);
+  result.resize(unescape(&result[0], result.data(), result.size()));
+  return result;
+}
+
+void
+unescape(std::ostream& os, const char* str, size_t len)
+{
+  std::string result(str, len);
+  os.write(result.data(), static_cast<std::streamsize>(unescape(&result[0], result.data(), len)));
 }
 
 } // namespace ndn
@@ -198,6 +198,18 @@ escape(const std::string& str);
 void
 escape(std::ostream& os, const char* str, size_t len);
 
+/**
+ * @brief Percent-encode a string into a caller-provided buffer
+ * @param out output buffer, which must have room for at least `3 * len` characters
+ * @param str input string
+ * @param len length of the input string
+ * @return number of characters written to @p out
+ *
+ * On platforms with SSE2, runs of unreserved characters are classified and copied 16 at a time.
+ */
+size_t
+escape(char* out, const char* str, size_t len);
+
 /**
  * @brief Decode a percent-encoded string
  * @see RFC 3986 section 2
@@ -217,6 +229,17 @@ unescape(const std::string& str);
 void
 unescape(std::ostream& os, const char* str, size_t len);
 
+/**
+ * @brief Decode a percent-encoded string into a caller-provided buffer
+ * @param out output buffer, which must have room for at least @p len characters;
+ *            it may be the same as @p str for in-place decoding
+ * @param str input string
+ * @param len length of the input string
+ * @return number of characters written to @p out
+ */
+size_t
+unescape(char* out, const char* str, size_t len);
+
 } // namespace ndn
 
 #endif // NDN_UTIL_STRING_HELPER_HPP
@@ -0,0 +1,104 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Dispatcher Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/mgmt/dispatcher.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/asio/io_service.hpp>
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+const int N_HANDLERS = 500;
+const int N_ITERATIONS = 20000;
+
+// Benchmark of Interest dispatching with a large handler set, compared to one InterestFilter
+// per top-level prefix and handler, which is how Dispatcher used to dispatch Interests.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(Dispatch)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+
+  std::vector<shared_ptr<Interest>> interests;
+  for (int i = 0; i < N_HANDLERS; ++i) {
+    auto interest = make_shared<Interest>(Name("/localhost/benchmark/module").append(to_string(i))
+                                          .append("list"));
+    interest->setCanBePrefix(true);
+    interests.push_back(interest);
+  }
+
+  {
+    boost::asio::io_service io;
+    util::DummyClientFace face(io, keyChain);
+    int nCalls = 0;
+    std::vector<ScopedInterestFilterHandle> filters;
+    for (int i = 0; i < N_HANDLERS; ++i) {
+      filters.emplace_back(face.setInterestFilter(Name("/localhost/benchmark/module")
+                                                  .append(to_string(i)).append("list"),
+                                                  [&] (const auto&...) { ++nCalls; }));
+    }
+    io.poll();
+
+    auto d = timedExecute([&] {
+      for (int i = 0; i < N_ITERATIONS; ++i) {
+        face.receive(*interests[i % N_HANDLERS]);
+      }
+      io.poll();
+    });
+    BOOST_CHECK_EQUAL(nCalls, N_ITERATIONS);
+    std::cout << N_ITERATIONS << " Interests, " << N_HANDLERS << " InterestFilters: "
+              << d << std::endl;
+  }
+
+  {
+    boost::asio::io_service io;
+    util::DummyClientFace face(io, keyChain);
+    mgmt::Dispatcher dispatcher(face, keyChain, signingWithSha256());
+    int nCalls = 0;
+    for (int i = 0; i < N_HANDLERS; ++i) {
+      dispatcher.addStatusDataset(Name("module").append(to_string(i)).append("list"),
+                                  mgmt::makeAcceptAllAuthorization(),
+                                  [&] (const auto&...) { ++nCalls; });
+    }
+    dispatcher.addTopPrefix("/localhost/benchmark", false);
+    io.poll();
+
+    auto d = timedExecute([&] {
+      for (int i = 0; i < N_ITERATIONS; ++i) {
+        face.receive(*interests[i % N_HANDLERS]);
+      }
+      io.poll();
+    });
+    BOOST_CHECK_EQUAL(nCalls, N_ITERATIONS);
+    std::cout << N_ITERATIONS << " Interests, Dispatcher with " << N_HANDLERS << " handlers: "
+              << d << std::endl;
+  }
+}
+
+} // namespace tests
+} // namespace ndn
@@ -22,6 +22,7 @@
 #define BOOST_TEST_MODULE ndn-cxx Encoding Benchmark
 #include "tests/boost-test.hpp"
 
+#include "ndn-cxx/encoding/block.hpp"
 #include "ndn-cxx/encoding/tlv.hpp"
 #include "tests/benchmarks/timed-execute.hpp"
 
@@ -128,6 +129,82 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ReadVarNumber, Test, ReadVarNumberTests)
             << " " << d << std::endl;
 }
 
+// Benchmark of splitting a buffer of concatenated packets, as received by a stream transport,
+// with ndn::tlv::scanElements versus repeated ndn::Block::fromBuffer, and of locating the
+// sub-elements of each packet as well.
+BOOST_AUTO_TEST_CASE(SplitElements)
+{
+  const int N_ITERATIONS = 10000;
+
+  // ~64 KB of 100-octet elements, each containing nine 9-octet sub-elements
+  // followed by one 17-octet sub-element
+  std::vector<uint8_t> buffer;
+  while (buffer.size() + 100 <= 65536) {
+    buffer.push_back(0x06);
+    buffer.push_back(98);
+    for (int i = 0; i < 9; ++i) {
+      buffer.push_back(0x08);
+      buffer.push_back(7);
+      buffer.insert(buffer.end(), 7, static_cast<uint8_t>(i));
+    }
+    buffer.push_back(0x80);
+    buffer.push_back(15);
+    buffer.insert(buffer.end(), 15, 0xff);
+  }
+
+  size_t nScanned = 0;
+  auto d1 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      nScanned += scanElements(buffer.data(), buffer.size(), [] (const ElementBounds&) {});
+    }
+  });
+  BOOST_CHECK_EQUAL(nScanned, buffer.size() * N_ITERATIONS);
+  std::cout << "scanElements " << d1 << std::endl;
+
+  size_t nDecoded = 0;
+  auto d2 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      size_t offset = 0;
+      while (offset < buffer.size()) {
+        bool isOk = false;
+        Block element;
+        std::tie(isOk, element) = Block::fromBuffer(buffer.data() + offset, buffer.size() - offset);
+        if (!isOk)
+          break;
+        offset += element.size();
+      }
+      nDecoded += offset;
+    }
+  });
+  BOOST_CHECK_EQUAL(nDecoded, buffer.size() * N_ITERATIONS);
+  std::cout << "Block::fromBuffer " << d2 << std::endl;
+
+  size_t nSubElements = 0;
+  auto d3 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS * 100; ++i) {
+      Block element(buffer.data(), 100);
+      element.parse();
+      nSubElements += element.elements_size();
+    }
+  });
+  BOOST_CHECK_EQUAL(nSubElements, 10 * N_ITERATIONS * 100);
+  std::cout << "Block::parse " << d3 << std::endl;
+
+  std::vector<ElementBounds> elements;
+  std::vector<ElementBounds> children;
+  size_t nChildren = 0;
+  auto d4 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      elements.clear();
+      children.clear();
+      scanElements(buffer.data(), buffer.size(), elements, children);
+      nChildren += children.size();
+    }
+  });
+  BOOST_CHECK_EQUAL(nChildren, 10 * (buffer.size() / 100) * N_ITERATIONS);
+  std::cout << "scanElements with children " << d4 << std::endl;
+}
+
 } // namespace tests
 } // namespace tlv
 } // namespace ndn
@@ -0,0 +1,186 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Face Poll Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/asio/io_service.hpp>
+
+#include <iostream>
+#include <thread>
+
+namespace ndn {
+namespace tests {
+
+using util::DummyClientFace;
+
+const size_t N_EXCHANGES = 200000;
+const size_t N_THREADS = 4;
+
+class FaceGroup
+{
+public:
+  FaceGroup(boost::asio::io_service& io, KeyChain& keyChain, size_t nFaces, size_t firstId)
+    : m_io(io)
+    , m_firstId(firstId)
+  {
+    for (size_t i = 0; i < nFaces; ++i) {
+      m_faces.push_back(make_unique<DummyClientFace>(io, keyChain,
+                                                     DummyClientFace::Options{false, false}));
+    }
+  }
+
+  /** \brief express one Interest on each face and answer it, polling once per step
+   *  \param pollEachFace if true, call Face::poll() on every face, which requires each face to
+   *                      have its own io_service; otherwise, poll the shared io_service once
+   */
+  void
+  runRound(size_t round, bool pollEachFace)
+  {
+    for (size_t i = 0; i < m_faces.size(); ++i) {
+      Interest interest(makeName(i, round));
+      interest.setCanBePrefix(false);
+      m_faces[i]->expressInterest(interest, [this] (const Interest&, const Data&) { ++nData; },
+                                  nullptr, nullptr);
+    }
+    poll(pollEachFace);
+
+    for (size_t i = 0; i < m_faces.size(); ++i) {
+      Data data(makeName(i, round));
+      data.setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+      data.setSignatureValue(make_shared<Buffer>(32));
+      m_faces[i]->receive(data);
+    }
+    poll(pollEachFace);
+  }
+
+private:
+  Name
+  makeName(size_t i, size_t round) const
+  {
+    return Name("/benchmark/face-poll").appendNumber(m_firstId + i).appendSequenceNumber(round);
+  }
+
+  void
+  poll(bool pollEachFace)
+  {
+    if (pollEachFace) {
+      for (const auto& face : m_faces) {
+        face->poll();
+      }
+    }
+    else {
+      m_io.reset();
+      m_io.poll();
+    }
+  }
+
+public:
+  size_t nData = 0;
+
+private:
+  boost::asio::io_service& m_io;
+  size_t m_firstId;
+  std::vector<unique_ptr<DummyClientFace>> m_faces;
+};
+
+// Benchmark of driving many faces by polling, as an external event loop would.
+// Each face expresses an Interest and receives the Data in every round; the total number of
+// exchanges is constant, so the per-configuration times are directly comparable.
+//  - shared: all faces share one io_service, polled once per step, on one thread
+//  - separate: every face has its own io_service, each polled, on one thread
+//  - pool: the faces are split across a small pool of threads, each with its own io_service
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(Scaling)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+
+  for (size_t nFaces : {1, 10, 100, 1000}) {
+    const size_t nRounds = N_EXCHANGES / nFaces;
+
+    boost::asio::io_service sharedIo;
+    FaceGroup shared(sharedIo, keyChain, nFaces, 0);
+    auto d1 = timedExecute([&] {
+      for (size_t r = 0; r < nRounds; ++r) {
+        shared.runRound(r, false);
+      }
+    });
+    BOOST_CHECK_EQUAL(shared.nData, nRounds * nFaces);
+
+    std::vector<unique_ptr<boost::asio::io_service>> ios;
+    std::vector<unique_ptr<FaceGroup>> separate;
+    for (size_t i = 0; i < nFaces; ++i) {
+      ios.push_back(make_unique<boost::asio::io_service>());
+      separate.push_back(make_unique<FaceGroup>(*ios.back(), keyChain, 1, i));
+    }
+    auto d2 = timedExecute([&] {
+      for (size_t r = 0; r < nRounds; ++r) {
+        for (const auto& group : separate) {
+          group->runRound(r, true);
+        }
+      }
+    });
+    size_t nData = 0;
+    for (const auto& group : separate) {
+      nData += group->nData;
+    }
+    BOOST_CHECK_EQUAL(nData, nRounds * nFaces);
+
+    const size_t nThreads = std::min(N_THREADS, nFaces);
+    std::vector<unique_ptr<boost::asio::io_service>> threadIos;
+    std::vector<unique_ptr<FaceGroup>> pool;
+    for (size_t t = 0; t < nThreads; ++t) {
+      size_t first = nFaces * t / nThreads;
+      size_t last = nFaces * (t + 1) / nThreads;
+      threadIos.push_back(make_unique<boost::asio::io_service>());
+      pool.push_back(make_unique<FaceGroup>(*threadIos.back(), keyChain, last - first, first));
+    }
+    auto d3 = timedExecute([&] {
+      std::vector<std::thread> threads;
+      for (const auto& group : pool) {
+        threads.emplace_back([&group, nRounds] {
+          for (size_t r = 0; r < nRounds; ++r) {
+            group->runRound(r, false);
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+    });
+    nData = 0;
+    for (const auto& group : pool) {
+      nData += group->nData;
+    }
+    BOOST_CHECK_EQUAL(nData, nRounds * nFaces);
+
+    std::cout << "faces=" << nFaces << " exchanges=" << nRounds * nFaces
+              << " shared=" << d1 << " separate=" << d2
+              << " pool(" << nThreads << ")=" << d3 << std::endl;
+  }
+}
+
+} // namespace tests
+} // namespace ndn
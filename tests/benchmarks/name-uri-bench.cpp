@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Name URI Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/name.hpp"
+#include "ndn-cxx/util/sha256.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+#include <sstream>
+
+namespace ndn {
+namespace tests {
+
+class NameUriBenchFixture
+{
+protected:
+  NameUriBenchFixture()
+  {
+    const uint8_t digestInput[] = {0x01, 0x02, 0x03};
+    auto digest = util::Sha256::computeDigest(digestInput, sizeof(digestInput));
+    for (uint64_t i = 0; i < N_NAMES; ++i) {
+      Name name("/ndn/edu/ucla/benchmark");
+      name.append("file name with spaces & symbols")
+          .appendVersion(1577836800000000 + i)
+          .appendTimestamp(time::fromUnixTimestamp(time::milliseconds(1577836800000 + i)))
+          .appendSegment(i)
+          .appendImplicitSha256Digest(digest);
+      m_names.push_back(name);
+      m_uris.push_back(name.toUri(name::UriFormat::ALTERNATE));
+    }
+  }
+
+protected:
+  static constexpr uint64_t N_NAMES = 1000;
+  static constexpr int N_ROUNDS = 100;
+
+  std::vector<Name> m_names;
+  std::vector<std::string> m_uris;
+};
+
+// Benchmark of NDN URI formatting and parsing of names with typed components
+// (version, timestamp, segment, and implicit digest). For accurate results,
+// it is required to compile ndn-cxx in release mode.
+BOOST_FIXTURE_TEST_CASE(RoundTrip, NameUriBenchFixture)
+{
+  const auto format = name::UriFormat::ALTERNATE;
+  const int N_OPS = N_ROUNDS * N_NAMES;
+
+  size_t nChars = 0;
+  auto d1 = timedExecute([&] {
+    for (int round = 0; round < N_ROUNDS; ++round) {
+      for (const auto& name : m_names) {
+        std::ostringstream os;
+        name.toUri(os, format);
+        nChars += os.str().size();
+      }
+    }
+  });
+  std::cout << N_OPS << " toUri(ostream): " << d1 << std::endl;
+
+  auto d2 = timedExecute([&] {
+    for (int round = 0; round < N_ROUNDS; ++round) {
+      for (const auto& name : m_names) {
+        nChars += name.toUri(format).size();
+      }
+    }
+  });
+  std::cout << N_OPS << " toUri(): " << d2 << std::endl;
+
+  char buf[512];
+  auto d3 = timedExecute([&] {
+    for (int round = 0; round < N_ROUNDS; ++round) {
+      for (const auto& name : m_names) {
+        nChars += name.toUri(buf, sizeof(buf), format);
+      }
+    }
+  });
+  std::cout << N_OPS << " toUri(buffer): " << d3 << std::endl;
+  BOOST_CHECK_GT(nChars, 0);
+
+  size_t nComponents = 0;
+  auto d4 = timedExecute([&] {
+    for (int round = 0; round < N_ROUNDS; ++round) {
+      for (const auto& uri : m_uris) {
+        nComponents += Name(uri).size();
+      }
+    }
+  });
+  std::cout << N_OPS << " parse: " << d4 << std::endl;
+  BOOST_CHECK_EQUAL(nComponents, N_OPS * m_names.front().size());
+
+  for (size_t i = 0; i < m_names.size(); ++i) {
+    BOOST_CHECK_EQUAL(Name(m_uris[i]), m_names[i]);
+  }
+}
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx NFD Dataset Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/encoding/tlv-nfd.hpp"
+#include "ndn-cxx/mgmt/nfd/face-status.hpp"
+#include "ndn-cxx/mgmt/nfd/fib-entry.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace nfd {
+namespace tests {
+
+using namespace ndn::tests;
+
+const size_t N_ENTRIES = 500000;
+
+// Decoder equivalent to the hand-written FibEntry::wireDecode that preceded tlv::schema,
+// which calls Block::parse() on each entry and next hop record.
+static FibEntry
+decodeFibEntryWithParse(const Block& block)
+{
+  FibEntry entry;
+  block.parse();
+  auto val = block.elements_begin();
+  entry.setPrefix(Name(*val));
+  for (++val; val != block.elements_end(); ++val) {
+    val->parse();
+    entry.addNextHopRecord(NextHopRecord()
+                           .setFaceId(readNonNegativeInteger(val->elements()[0]))
+                           .setCost(readNonNegativeInteger(val->elements()[1])));
+  }
+  return entry;
+}
+
+// Benchmark of decoding a FIB dataset with 500k entries, each having two next hops.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(FibDatasetDecode)
+{
+  EncodingBuffer encoder;
+  for (size_t i = 0; i < N_ENTRIES; ++i) {
+    FibEntry entry;
+    entry.setPrefix(Name("/benchmark/fib").appendNumber(i));
+    entry.addNextHopRecord(NextHopRecord().setFaceId(256 + i % 100).setCost(10));
+    entry.addNextHopRecord(NextHopRecord().setFaceId(300 + i % 100).setCost(20));
+    entry.wireEncode(encoder);
+  }
+  encoder.prependVarNumber(encoder.size());
+  encoder.prependVarNumber(tlv::Content);
+  Block dataset = encoder.block();
+  dataset.parse();
+  BOOST_REQUIRE_EQUAL(dataset.elements_size(), N_ENTRIES);
+
+  size_t nNextHops = 0;
+  auto d1 = timedExecute([&] {
+    for (const Block& element : dataset.elements()) {
+      nNextHops += decodeFibEntryWithParse(Block(element.wire(), element.size()))
+                   .getNextHopRecords().size();
+    }
+  });
+  std::cout << N_ENTRIES << " FibEntry decode with Block::parse: " << d1 << std::endl;
+
+  auto d2 = timedExecute([&] {
+    for (const Block& element : dataset.elements()) {
+      nNextHops += FibEntry(Block(element.wire(), element.size())).getNextHopRecords().size();
+    }
+  });
+  std::cout << N_ENTRIES << " FibEntry::wireDecode: " << d2 << std::endl;
+
+  BOOST_CHECK_EQUAL(nNextHops, 2 * 2 * N_ENTRIES);
+}
+
+// Benchmark of decoding FaceStatus records, which have many NonNegativeInteger fields.
+BOOST_AUTO_TEST_CASE(FaceStatusDecode)
+{
+  const int N_ITERATIONS = 500000;
+
+  FaceStatus status;
+  status.setFaceId(300)
+        .setRemoteUri("udp4://192.0.2.1:6363")
+        .setLocalUri("udp4://192.0.2.2:6363")
+        .setFaceScope(FACE_SCOPE_NON_LOCAL)
+        .setFacePersistency(FACE_PERSISTENCY_PERMANENT)
+        .setLinkType(LINK_TYPE_MULTI_ACCESS)
+        .setMtu(8800)
+        .setNInInterests(12345678)
+        .setNInData(2345678)
+        .setNInNacks(345)
+        .setNOutInterests(23456789)
+        .setNOutData(1234567)
+        .setNOutNacks(12)
+        .setNInBytes(3456789012)
+        .setNOutBytes(2345678901)
+        .setFlags(0x3);
+  const Block& wire = status.wireEncode();
+
+  uint64_t sum = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      sum += FaceStatus(Block(wire.wire(), wire.size())).getNInInterests();
+    }
+  });
+  std::cout << N_ITERATIONS << " FaceStatus::wireDecode: " << d << std::endl;
+
+  BOOST_CHECK_EQUAL(sum, 12345678ull * N_ITERATIONS);
+}
+
+} // namespace tests
+} // namespace nfd
+} // namespace ndn
@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Nonce Generation Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/util/random.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+const int N_ITERATIONS = 1000000;
+
+// Benchmark of random nonce generation: the pseudo-random engine, OpenSSL RAND_bytes on
+// every call, and the buffered nonce generator. For accurate results, it is required to
+// compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(Generators)
+{
+  uint32_t sum = 0;
+
+  auto d1 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      sum += random::generateWord32();
+    }
+  });
+  std::cout << N_ITERATIONS << " generateWord32: " << d1 << std::endl;
+
+  auto d2 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      sum += random::generateSecureWord32();
+    }
+  });
+  std::cout << N_ITERATIONS << " generateSecureWord32: " << d2 << std::endl;
+
+  auto d3 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      sum += random::generateNonceWord32();
+    }
+  });
+  std::cout << N_ITERATIONS << " generateNonceWord32: " << d3 << std::endl;
+
+  BOOST_CHECK_NE(sum, 0);
+}
+
+BOOST_AUTO_TEST_CASE(InterestRefreshNonce)
+{
+  Interest interest("/benchmark/nonce");
+  interest.setCanBePrefix(false);
+  interest.setNonce(Interest::Nonce(0x01020304));
+
+  size_t nBytes = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      interest.refreshNonce();
+      nBytes += interest.wireEncode().size();
+    }
+  });
+  std::cout << N_ITERATIONS << " Interest::refreshNonce + wireEncode: " << d << std::endl;
+  BOOST_CHECK_GT(nBytes, 0);
+}
+
+} // namespace tests
+} // namespace ndn
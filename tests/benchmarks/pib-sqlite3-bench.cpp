@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx PIB SQLite3 Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/pib/impl/pib-sqlite3.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+namespace ndn {
+namespace tests {
+
+using security::pib::PibSqlite3;
+
+class PibSqlite3BenchFixture
+{
+protected:
+  PibSqlite3BenchFixture()
+    : m_dbDir(boost::filesystem::temp_directory_path() /
+              boost::filesystem::unique_path("ndn-cxx-pib-bench-%%%%-%%%%"))
+  {
+    KeyChain keyChain("pib-sqlite3:" + m_dbDir.string(), "tpm-memory:");
+    for (int i = 0; i < N_IDENTITIES; ++i) {
+      auto id = keyChain.createIdentity(Name("/benchmark/pib").appendNumber(i));
+      m_keyNames.push_back(id.getDefaultKey().getName());
+    }
+  }
+
+  ~PibSqlite3BenchFixture()
+  {
+    boost::filesystem::remove_all(m_dbDir);
+  }
+
+  /** \brief Each of \p nThreads readers opens its own PibSqlite3 instance and looks up
+   *         the default certificate of every key, N_ROUNDS times.
+   */
+  time::nanoseconds
+  runReaders(int nThreads, const PibSqlite3::Options& options)
+  {
+    std::atomic<int> nFound{0};
+    auto duration = timedExecute([&] {
+      std::vector<std::thread> threads;
+      for (int t = 0; t < nThreads; ++t) {
+        threads.emplace_back([&] {
+          PibSqlite3 pib(m_dbDir.string(), options);
+          for (int round = 0; round < N_ROUNDS; ++round) {
+            for (const auto& keyName : m_keyNames) {
+              nFound += pib.getDefaultCertificateOfKey(keyName).getKeyName() == keyName;
+            }
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+    });
+    BOOST_CHECK_EQUAL(nFound, nThreads * N_ROUNDS * N_IDENTITIES);
+    return duration;
+  }
+
+protected:
+  static constexpr int N_IDENTITIES = 50;
+  static constexpr int N_ROUNDS = 100;
+
+  boost::filesystem::path m_dbDir;
+  std::vector<Name> m_keyNames;
+};
+
+// Benchmark of concurrent PIB readers, comparing the default configuration against
+// write-ahead logging with read-only connections. For accurate results, it is required
+// to compile ndn-cxx in release mode.
+BOOST_FIXTURE_TEST_CASE(ConcurrentReaders, PibSqlite3BenchFixture)
+{
+  const int N_LOOKUPS = N_ROUNDS * N_IDENTITIES;
+  const std::vector<int> N_THREADS{1, 2, 4, 8};
+
+  PibSqlite3::Options options;
+  options.busyTimeout = 10_s;
+  for (int nThreads : N_THREADS) {
+    std::cout << nThreads << " readers x " << N_LOOKUPS << " lookups, default: "
+              << runReaders(nThreads, options) << std::endl;
+  }
+
+  options.useWal = true;
+  {
+    PibSqlite3 writer(m_dbDir.string(), options); // switch the database to WAL mode
+  }
+  for (int nThreads : N_THREADS) {
+    std::cout << nThreads << " readers x " << N_LOOKUPS << " lookups, WAL: "
+              << runReaders(nThreads, options) << std::endl;
+  }
+
+  options.isReadOnly = true;
+  for (int nThreads : N_THREADS) {
+    std::cout << nThreads << " readers x " << N_LOOKUPS << " lookups, WAL read-only: "
+              << runReaders(nThreads, options) << std::endl;
+  }
+}
+
+} // namespace tests
+} // namespace ndn
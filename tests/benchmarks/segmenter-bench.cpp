@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Segmenter Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/util/segmenter.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+#include <thread>
+
+namespace ndn {
+namespace tests {
+
+// Benchmark of bulk segmentation and signing throughput, in MB/s of input.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(Throughput)
+{
+  const size_t INPUT_SIZE = 16 * 1024 * 1024;
+  const size_t SEGMENT_SIZE = 8000;
+  std::vector<uint8_t> input(INPUT_SIZE, 0xA5);
+
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  auto identity = keyChain.createIdentity("/benchmark/segmenter");
+
+  std::vector<size_t> nThreadsList{1, 2, 4};
+  size_t nCores = std::thread::hardware_concurrency();
+  if (nCores > 4) {
+    nThreadsList.push_back(nCores);
+  }
+
+  const std::vector<std::pair<std::string, security::SigningInfo>> SIGNERS{
+    {"DigestSha256", signingWithSha256()},
+    {"ECDSA", signingByIdentity(identity)},
+  };
+
+  for (const auto& signer : SIGNERS) {
+    for (size_t nThreads : nThreadsList) {
+      util::Segmenter segmenter(keyChain, signer.second);
+      segmenter.setMaxSegmentSize(SEGMENT_SIZE).setNThreads(nThreads);
+
+      uint64_t nSegments = 0;
+      auto d = timedExecute([&] {
+        nSegments = segmenter.segment("/benchmark/object", input.data(), input.size(),
+                                      [] (const shared_ptr<Data>&) {});
+      });
+      BOOST_CHECK_EQUAL(nSegments, (INPUT_SIZE + SEGMENT_SIZE - 1) / SEGMENT_SIZE);
+
+      double mbps = INPUT_SIZE / 1048576.0 / (d.count() / 1e9);
+      std::cout << signer.first << ", " << nThreads << " threads: "
+                << nSegments << " segments in " << d << ", " << mbps << " MB/s" << std::endl;
+    }
+  }
+}
+
+} // namespace tests
+} // namespace ndn
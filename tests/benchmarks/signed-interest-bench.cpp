@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Signed Interest Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+class SignedInterestFixture
+{
+protected:
+  SignedInterestFixture()
+    : m_keyChain("pib-memory:", "tpm-memory:")
+  {
+    m_signingInfo.setSignedInterestFormat(security::SignedInterestFormat::V03);
+  }
+
+protected:
+  KeyChain m_keyChain;
+  security::SigningInfo m_signingInfo = security::signingWithSha256();
+  const uint8_t m_parameters[64] = {};
+};
+
+// Benchmark of building, encoding, decoding, and verifying signed Interests.
+// The DigestSha256 signature type is used so that the results are dominated by packet
+// processing (including ParametersSha256DigestComponent computation) instead of public-key
+// cryptography. For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_FIXTURE_TEST_CASE(BuildAndVerify, SignedInterestFixture)
+{
+  const int N_ITERATIONS = 100000;
+
+  std::vector<Block> wires;
+  wires.reserve(N_ITERATIONS);
+  auto build = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      Interest interest(Name("/benchmark/signed-interest").appendSequenceNumber(i));
+      interest.setCanBePrefix(false);
+      interest.setApplicationParameters(m_parameters, sizeof(m_parameters));
+      m_keyChain.sign(interest, m_signingInfo);
+      wires.push_back(interest.wireEncode());
+    }
+  });
+
+  int nValid = 0;
+  auto verify = timedExecute([&] {
+    for (const auto& wire : wires) {
+      Interest interest(wire);
+      nValid += interest.isParametersDigestValid() &&
+                security::verifyDigest(interest, DigestAlgorithm::SHA256);
+    }
+  });
+  BOOST_CHECK_EQUAL(nValid, N_ITERATIONS);
+
+  std::cout << "build " << N_ITERATIONS << " signed Interests: " << build << "\n"
+            << "verify " << N_ITERATIONS << " signed Interests: " << verify << std::endl;
+}
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/compact-full-name.hpp"
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/util/sha256.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/make-interest-data.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestCompactFullName)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  auto data = makeData("/A/B");
+  CompactFullName fullName(*data);
+  BOOST_CHECK_EQUAL(&fullName.getName(), &data->getName());
+  BOOST_CHECK_EQUAL(fullName.getDigest(), data->getImplicitDigest()); // shared, not copied
+  BOOST_CHECK_EQUAL(fullName.size(), 3);
+  BOOST_CHECK_EQUAL(fullName.toName(), data->getFullName());
+  BOOST_CHECK(fullName == data->getFullName());
+  BOOST_CHECK(data->getFullName() == fullName);
+  BOOST_CHECK(fullName != Name("/A/B"));
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(fullName), data->getFullName().toUri());
+
+  BOOST_CHECK_THROW(CompactFullName(Data("/A")), Data::Error);
+  BOOST_CHECK_THROW(CompactFullName(data->getName(), nullptr), std::invalid_argument);
+  BOOST_CHECK_THROW(CompactFullName(data->getName(), make_shared<Buffer>(31)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(SameAsName)
+{
+  auto digestA = util::Sha256::computeDigest(reinterpret_cast<const uint8_t*>("A"), 1);
+  auto digestB = util::Sha256::computeDigest(reinterpret_cast<const uint8_t*>("B"), 1);
+  const std::vector<Name> dataNames{"/", "/A", "/A/B", "/B", Name("/A").appendImplicitSha256Digest(digestB)};
+
+  std::vector<Name> names(dataNames);
+  names.push_back(Name("/A").appendNumber(1));
+  std::vector<CompactFullName> fullNames;
+  for (const auto& name : dataNames) {
+    for (const auto& digest : {digestA, digestB}) {
+      fullNames.emplace_back(name, digest);
+      names.push_back(fullNames.back().toName());
+      names.push_back(Name(fullNames.back().toName()).append("C"));
+    }
+  }
+
+  auto sign = [] (int i) { return (i > 0) - (i < 0); };
+  for (const auto& fullName : fullNames) {
+    Name expected = fullName.toName();
+    BOOST_TEST_CONTEXT(expected) {
+      BOOST_CHECK_EQUAL(fullName.hash(), std::hash<Name>()(expected));
+      for (const auto& other : names) {
+        BOOST_TEST_CONTEXT(other) {
+          BOOST_CHECK_EQUAL(sign(fullName.compare(other)), sign(expected.compare(other)));
+          BOOST_CHECK_EQUAL(fullName == other, expected == other);
+          BOOST_CHECK_EQUAL(fullName < other, expected < other);
+          BOOST_CHECK_EQUAL(other < fullName, other < expected);
+          BOOST_CHECK_EQUAL(fullName.hasPrefix(other), other.isPrefixOf(expected));
+        }
+      }
+      for (const auto& other : fullNames) {
+        BOOST_TEST_CONTEXT(other.toName()) {
+          BOOST_CHECK_EQUAL(sign(fullName.compare(other)), sign(expected.compare(other.toName())));
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCompactFullName
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/data-template.hpp"
+#include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
+#include "ndn-cxx/util/sha256.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/identity-management-fixture.hpp"
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestDataTemplate)
+
+const uint8_t CONTENT[] = {0x53, 0x55, 0x43, 0x43, 0x45, 0x53, 0x53, 0x21};
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  DataTemplate tpl("/A");
+  BOOST_CHECK_EQUAL(tpl.getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(tpl.getSignatureInfo().getSignatureType(), tlv::DigestSha256);
+
+  Block wire = tpl.encode("/B/C", CONTENT, sizeof(CONTENT));
+  Data data(wire);
+  BOOST_CHECK_EQUAL(data.getName(), "/A/B/C");
+  BOOST_CHECK_EQUAL(data.getContentType(), tlv::ContentType_Blob);
+  BOOST_CHECK_EQUAL(data.getFreshnessPeriod(), 0_ms);
+  BOOST_CHECK_EQUAL_COLLECTIONS(data.getContent().value_begin(), data.getContent().value_end(),
+                                CONTENT, CONTENT + sizeof(CONTENT));
+  BOOST_CHECK_EQUAL(data.getSignatureType(), tlv::DigestSha256);
+  BOOST_CHECK(security::verifyDigest(data, DigestAlgorithm::SHA256));
+
+  // the wire occupies the whole buffer except for the unused SignatureValue reservation
+  BOOST_CHECK(wire.getBuffer()->begin() == wire.begin());
+}
+
+BOOST_AUTO_TEST_CASE(SameAsData)
+{
+  DataTemplate tpl("/prefix");
+  MetaInfo metaInfo;
+  metaInfo.setType(tlv::ContentType_Key);
+  metaInfo.setFreshnessPeriod(10_s);
+  tpl.setMetaInfo(metaInfo);
+
+  Data expected("/prefix/suffix/1");
+  expected.setMetaInfo(metaInfo);
+  expected.setContent(CONTENT, sizeof(CONTENT));
+  expected.setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+  EncodingBuffer encoder;
+  expected.wireEncode(encoder, true);
+  expected.wireEncode(encoder, Block(tlv::SignatureValue,
+                                     util::Sha256::computeDigest(encoder.buf(), encoder.size())));
+
+  Block wire = tpl.encode("/suffix/1", CONTENT, sizeof(CONTENT));
+  BOOST_CHECK_EQUAL(wire, expected.wireEncode());
+
+  // Content given as a Block
+  Block contentBlock = makeBinaryBlock(tlv::Content, CONTENT, sizeof(CONTENT));
+  BOOST_CHECK_EQUAL(tpl.encode("/suffix/1", contentBlock), expected.wireEncode());
+
+  // nested Content
+  Block nested = makeBinaryBlock(tlv::GenericNameComponent, CONTENT, sizeof(CONTENT));
+  auto data = tpl.makeData("/suffix/2", nested);
+  BOOST_CHECK_EQUAL(data->getName(), "/prefix/suffix/2");
+  BOOST_CHECK_EQUAL(data->getContent().blockFromValue(), nested);
+}
+
+BOOST_AUTO_TEST_CASE(Modifiers)
+{
+  DataTemplate tpl;
+  tpl.setPrefix("/P")
+     .setContentType(tlv::ContentType_Nack)
+     .setFreshnessPeriod(1_s);
+
+  auto data = tpl.makeData(Name().appendSegment(5), nullptr, 0);
+  BOOST_CHECK_EQUAL(data->getName(), Name("/P").appendSegment(5));
+  BOOST_CHECK_EQUAL(data->getContentType(), tlv::ContentType_Nack);
+  BOOST_CHECK_EQUAL(data->getFreshnessPeriod(), 1_s);
+  BOOST_CHECK_EQUAL(data->getContent().value_size(), 0);
+
+  int nCalls = 0;
+  tpl.setSigner(SignatureInfo(tlv::SignatureHmacWithSha256), [&] (const InputBuffers& bufs) {
+    ++nCalls;
+    BOOST_CHECK_EQUAL(bufs.size(), 1);
+    return make_shared<Buffer>(1000); // larger than the reservation
+  });
+  data = tpl.makeData("/large", CONTENT, sizeof(CONTENT));
+  BOOST_CHECK_EQUAL(nCalls, 1);
+  BOOST_CHECK_EQUAL(data->getSignatureType(), tlv::SignatureHmacWithSha256);
+  BOOST_CHECK_EQUAL(data->getSignatureValue().value_size(), 1000);
+
+  BOOST_CHECK_THROW(tpl.setSigner(SignatureInfo(tlv::DigestSha256), nullptr), std::invalid_argument);
+  BOOST_CHECK_THROW(tpl.encode("/A", nullptr, 1), std::invalid_argument);
+}
+
+BOOST_FIXTURE_TEST_CASE(PrepareTemplate, IdentityManagementFixture)
+{
+  auto identity = addIdentity("/producer");
+  DataTemplate tpl("/producer/stream");
+  m_keyChain.prepareTemplate(tpl, signingByIdentity(identity));
+  BOOST_CHECK_EQUAL(tpl.getSignatureInfo().getKeyLocator().getName(),
+                    identity.getDefaultKey().getName());
+
+  for (uint64_t seq = 0; seq < 3; ++seq) {
+    auto data = tpl.makeData(Name().appendSequenceNumber(seq), CONTENT, sizeof(CONTENT));
+    BOOST_CHECK_EQUAL(data->getName(), Name("/producer/stream").appendSequenceNumber(seq));
+    BOOST_CHECK(security::verifySignature(*data, identity.getDefaultKey()));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDataTemplate
+
+} // namespace tests
+} // namespace ndn
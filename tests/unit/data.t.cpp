@@ -26,6 +26,7 @@
 #include "ndn-cxx/security/transform/signer-filter.hpp"
 #include "ndn-cxx/security/transform/step-source.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
 #include "ndn-cxx/security/verification-helpers.hpp"
 #include "ndn-cxx/util/sha256.hpp"
 #include "ndn-cxx/util/string-helper.hpp"
@@ -35,6 +36,8 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <numeric>
+
 namespace ndn {
 namespace tests {
 
@@ -208,6 +211,29 @@ BOOST_FIXTURE_TEST_CASE(Full, DataSigningKeyFixture)
                                 dataBlock.begin(), dataBlock.end());
 }
 
+BOOST_AUTO_TEST_CASE(Reencode)
+{
+  Data d("/A");
+  d.setFreshnessPeriod(1_s);
+  d.setContent("1502C0C1"_block);
+  d.setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+  d.setSignatureValue(fromHex("B0B1B2B3"));
+  BOOST_CHECK_EQUAL(d.wireEncode(),
+                    "061A 0703080141 1404 190203E8 1502C0C1 16031B0100 1704B0B1B2B3"_block);
+
+  // Content and SignatureValue refer to the new wire encoding
+  const Block& wire = d.wireEncode();
+  BOOST_CHECK(d.getContent().getBuffer() == wire.getBuffer());
+  BOOST_CHECK(d.getSignatureValue().getBuffer() == wire.getBuffer());
+
+  // re-encoding after a modification reuses the cached encodings of unmodified fields
+  d.setName("/B");
+  BOOST_CHECK_EQUAL(d.wireEncode(),
+                    "061A 0703080142 1404 190203E8 1502C0C1 16031B0100 1704B0B1B2B3"_block);
+  BOOST_CHECK_EQUAL(d.getFreshnessPeriod(), 1_s);
+  BOOST_CHECK_EQUAL(Data(d.wireEncode()), d);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Encode
 
 class DecodeFixture
@@ -406,9 +432,14 @@ BOOST_FIXTURE_TEST_CASE(FullName, IdentityManagementFixture)
 
   // FullName should be cached, so value() pointer points to same memory location
   BOOST_CHECK_EQUAL(fullName.get(-1).value(), d.getFullName().get(-1).value());
+  BOOST_CHECK_EQUAL_COLLECTIONS(d.getImplicitDigest()->begin(), d.getImplicitDigest()->end(),
+                                fullName.get(-1).value_begin(), fullName.get(-1).value_end());
+  Data copy(d);
+  BOOST_CHECK_EQUAL(copy.getImplicitDigest(), d.getImplicitDigest()); // digest is shared by copies
 
   d.setFreshnessPeriod(100_s); // invalidates FullName
   BOOST_CHECK_THROW(d.getFullName(), Data::Error);
+  BOOST_CHECK_THROW(d.getImplicitDigest(), Data::Error);
 
   Data d1(Block(DATA1, sizeof(DATA1)));
   BOOST_CHECK_EQUAL(d1.getFullName(),
@@ -531,6 +562,55 @@ BOOST_AUTO_TEST_CASE(SetContent)
   BOOST_CHECK_THROW(d.setContent(nullptr), std::invalid_argument);
 }
 
+BOOST_FIXTURE_TEST_CASE(ExternalContent, IdentityManagementFixture)
+{
+  auto content = std::make_shared<Buffer>(1000);
+  std::iota(content->begin(), content->end(), 0);
+
+  Data d("/external/content");
+  d.setFreshnessPeriod(1_s);
+  d.setExternalContent(content);
+  BOOST_CHECK(d.hasExternalContent());
+  BOOST_CHECK_THROW(d.wireEncodeScattered(), tlv::Error);
+
+  security::Identity id = addIdentity("/external/identity");
+  m_keyChain.sign(d, signingByIdentity(id));
+  BOOST_CHECK(security::verifySignature(d, id.getDefaultKey()));
+
+  // the content is emitted in place
+  WireSequence sequence = d.wireEncodeScattered();
+  BOOST_REQUIRE_EQUAL(sequence.size(), 3);
+  BOOST_CHECK(sequence[1].data() == content->data());
+  BOOST_CHECK_EQUAL(sequence[1].size(), content->size());
+  BOOST_CHECK_EQUAL(getTotalSize(sequence), d.wireEncode().size());
+  BOOST_CHECK_EQUAL(concatenate(sequence), d.wireEncode());
+
+  // a contiguous encoding copies the content
+  BOOST_CHECK(d.hasExternalContent());
+  BOOST_CHECK_EQUAL_COLLECTIONS(d.getContent().value_begin(), d.getContent().value_end(),
+                                content->begin(), content->end());
+  Data decoded(d.wireEncode());
+  BOOST_CHECK(!decoded.hasExternalContent());
+  BOOST_CHECK_EQUAL(decoded, d);
+  BOOST_CHECK(security::verifySignature(decoded, id.getDefaultKey()));
+
+  // a memory region that is not a Buffer
+  static const uint8_t region[] = {0xca, 0xfe};
+  d.setExternalContent(nullptr, region, sizeof(region));
+  m_keyChain.sign(d, signingByIdentity(id));
+  sequence = d.wireEncodeScattered();
+  BOOST_REQUIRE_EQUAL(sequence.size(), 3);
+  BOOST_CHECK(sequence[1].data() == region);
+  BOOST_CHECK_EQUAL(Data(concatenate(sequence)).getContent(), "1502CAFE"_block);
+
+  d.setContent(region, sizeof(region));
+  BOOST_CHECK(!d.hasExternalContent());
+  BOOST_CHECK_EQUAL(d.wireEncodeScattered().size(), 1);
+
+  BOOST_CHECK_THROW(d.setExternalContent(nullptr), std::invalid_argument);
+  BOOST_CHECK_THROW(d.setExternalContent(nullptr, nullptr, 1), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(SetSignatureValue)
 {
   Data d;
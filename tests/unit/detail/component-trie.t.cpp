@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/component-trie.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn {
+namespace detail {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Detail)
+BOOST_AUTO_TEST_SUITE(TestComponentTrie)
+
+BOOST_AUTO_TEST_CASE(InsertFind)
+{
+  ComponentTrie<int> trie;
+  BOOST_CHECK(trie.empty());
+  BOOST_CHECK(trie.findLongestPrefix("/A/B/C") == nullptr);
+
+  trie.insert("/A/B", 1);
+  trie.insert("/A/C/D", 2);
+  BOOST_CHECK_EQUAL(trie.size(), 2);
+
+  BOOST_CHECK(trie.findLongestPrefix("/A") == nullptr);
+  BOOST_CHECK(trie.findLongestPrefix("/A/C") == nullptr);
+  BOOST_REQUIRE(trie.findLongestPrefix("/A/B") != nullptr);
+  BOOST_CHECK_EQUAL(*trie.findLongestPrefix("/A/B"), 1);
+  BOOST_CHECK_EQUAL(*trie.findLongestPrefix("/A/B/E/F"), 1);
+  BOOST_CHECK_EQUAL(*trie.findLongestPrefix("/A/C/D/E"), 2);
+
+  // lookup starting at an offset
+  BOOST_CHECK(trie.findLongestPrefix("/A/B", 1) == nullptr);
+  BOOST_REQUIRE(trie.findLongestPrefix("/X/Y/A/B/E", 2) != nullptr);
+  BOOST_CHECK_EQUAL(*trie.findLongestPrefix("/X/Y/A/B/E", 2), 1);
+  BOOST_CHECK(trie.findLongestPrefix("/X/Y/A/B/E", 6) == nullptr);
+
+  // replace
+  trie.insert("/A/B", 3);
+  BOOST_CHECK_EQUAL(trie.size(), 2);
+  BOOST_CHECK_EQUAL(*trie.findLongestPrefix("/A/B"), 3);
+
+  // longest match wins
+  trie.insert("/A/B/E", 4);
+  BOOST_CHECK_EQUAL(*trie.findLongestPrefix("/A/B/E/F"), 4);
+  BOOST_CHECK_EQUAL(*trie.findLongestPrefix("/A/B/G"), 3);
+
+  // root entry
+  trie.insert("/", 5);
+  BOOST_CHECK_EQUAL(trie.size(), 4);
+  BOOST_CHECK_EQUAL(*trie.findLongestPrefix("/Z"), 5);
+}
+
+BOOST_AUTO_TEST_CASE(Overlap)
+{
+  ComponentTrie<int> trie;
+  BOOST_CHECK_EQUAL(trie.hasOverlap("/"), false);
+  BOOST_CHECK_EQUAL(trie.hasOverlap("/A"), false);
+
+  trie.insert("/A/B", 1);
+  BOOST_CHECK_EQUAL(trie.hasOverlap("/"), true);
+  BOOST_CHECK_EQUAL(trie.hasOverlap("/A"), true);
+  BOOST_CHECK_EQUAL(trie.hasOverlap("/A/B"), true);
+  BOOST_CHECK_EQUAL(trie.hasOverlap("/A/B/C"), true);
+  BOOST_CHECK_EQUAL(trie.hasOverlap("/A/C"), false);
+  BOOST_CHECK_EQUAL(trie.hasOverlap("/B"), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestComponentTrie
+BOOST_AUTO_TEST_SUITE_END() // Detail
+
+} // namespace tests
+} // namespace detail
+} // namespace ndn
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/thread-pool.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <atomic>
+#include <future>
+
+namespace ndn {
+namespace detail {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Detail)
+BOOST_AUTO_TEST_SUITE(TestThreadPool)
+
+BOOST_AUTO_TEST_CASE(Errors)
+{
+  BOOST_CHECK_THROW(ThreadPool(0, 1), std::invalid_argument);
+  BOOST_CHECK_THROW(ThreadPool(1, 0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Backpressure)
+{
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::atomic<int> nExecuted{0};
+
+  {
+    ThreadPool pool(1, 2);
+    BOOST_CHECK_EQUAL(pool.getNThreads(), 1);
+    BOOST_CHECK_EQUAL(pool.getMaxPending(), 2);
+
+    auto job = [&] {
+      released.wait();
+      ++nExecuted;
+    };
+    BOOST_CHECK(pool.tryPost(job));
+    BOOST_CHECK(pool.tryPost(job));
+    BOOST_CHECK_EQUAL(pool.getNPending(), 2);
+    BOOST_CHECK(!pool.tryPost(job)); // pool is full
+
+    release.set_value();
+    // destructor executes the remaining jobs and joins the worker thread
+  }
+  BOOST_CHECK_EQUAL(nExecuted, 2);
+}
+
+BOOST_AUTO_TEST_CASE(Reserve)
+{
+  std::atomic<int> nExecuted{0};
+
+  {
+    ThreadPool pool(1, 2);
+    BOOST_CHECK(pool.tryReserve());
+    BOOST_CHECK(pool.tryReserve());
+    BOOST_CHECK_EQUAL(pool.getNPending(), 2);
+    BOOST_CHECK(!pool.tryReserve()); // reservations count towards the bound
+    BOOST_CHECK(!pool.tryPost([&] { ++nExecuted; }));
+
+    pool.cancelReservation();
+    BOOST_CHECK_EQUAL(pool.getNPending(), 1);
+    pool.post([&] { ++nExecuted; });
+  }
+  BOOST_CHECK_EQUAL(nExecuted, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestThreadPool
+BOOST_AUTO_TEST_SUITE_END() // Detail
+
+} // namespace tests
+} // namespace detail
+} // namespace ndn
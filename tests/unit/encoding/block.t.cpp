@@ -358,6 +358,45 @@ BOOST_AUTO_TEST_CASE(FromRawBuffer)
   BOOST_CHECK_EQUAL(*b.wire(),  0xfe);
 }
 
+BOOST_AUTO_TEST_CASE(FromScannedBounds)
+{
+  const uint8_t BUFFER[] = {
+    0x01, 0x01, 0xfa,
+    0x06, 0x05, 0x08, 0x01, 0x61, 0x09, 0x00,
+    0x18, 0x01, 0x05,
+  };
+  std::vector<tlv::ElementBounds> elements;
+  std::vector<tlv::ElementBounds> children;
+  BOOST_REQUIRE_EQUAL(tlv::scanElements(BUFFER, sizeof(BUFFER), elements, children), sizeof(BUFFER));
+  BOOST_REQUIRE_EQUAL(elements.size(), 3);
+
+  // the element is copied into its own buffer, so offsets are translated
+  auto wire = make_shared<Buffer>(BUFFER + elements[1].begin, BUFFER + elements[1].end);
+  Block b(wire, wire->begin(), elements[1], children);
+  BOOST_CHECK_EQUAL(b.type(), 0x06);
+  BOOST_CHECK_EQUAL(b.size(), 7);
+  BOOST_CHECK_EQUAL(b.value_size(), 5);
+  BOOST_CHECK(b.getBuffer() == wire);
+  BOOST_REQUIRE_EQUAL(b.elements_size(), 2); // available without parse()
+  BOOST_CHECK_EQUAL(b.elements()[0].type(), 0x08);
+  BOOST_CHECK_EQUAL(b.elements()[0].value_size(), 1);
+  BOOST_CHECK_EQUAL(*b.elements()[0].value(), 0x61);
+  BOOST_CHECK_EQUAL(b.elements()[1].type(), 0x09);
+  BOOST_CHECK_EQUAL(b.elements()[1].value_size(), 0);
+  BOOST_CHECK(b.elements()[1].getBuffer() == wire);
+  BOOST_CHECK_EQUAL(b, Block(BUFFER + 3, 7));
+
+  // an element without sub-elements in the table is parsed lazily as before
+  auto buf = make_shared<Buffer>(BUFFER, sizeof(BUFFER));
+  Block b2(buf, buf->begin() + elements[2].begin, elements[2], children);
+  BOOST_CHECK_EQUAL(b2.type(), 0x18);
+  BOOST_CHECK_EQUAL(b2.elements_size(), 0);
+  BOOST_CHECK_THROW(b2.parse(), tlv::Error);
+
+  BOOST_CHECK_THROW(Block(wire, wire->begin() + 1, elements[1], children), std::invalid_argument);
+  BOOST_CHECK_THROW(Block(wire, wire->begin(), elements[1], {}), std::invalid_argument);
+}
+
 template<typename T>
 struct MalformedInput
 {
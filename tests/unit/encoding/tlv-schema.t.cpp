@@ -0,0 +1,200 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/tlv-schema.hpp"
+#include "ndn-cxx/name.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn {
+namespace tlv {
+namespace schema {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Encoding)
+BOOST_AUTO_TEST_SUITE(TestTlvSchema)
+
+enum class Color : uint8_t {
+  RED = 1,
+  GREEN = 2,
+};
+
+struct Item
+{
+  class Error : public tlv::Error
+  {
+  public:
+    using tlv::Error::Error;
+  };
+
+  ndn::Name name;
+  uint64_t count = 0;
+  optional<time::milliseconds> lifetime;
+  Color color = Color::RED;
+  std::vector<std::string> tags;
+  ndn::Name inner;
+};
+
+using ItemSchema = Record<200,
+  Required<tlv::Name, NDN_CXX_TLV_SCHEMA_MEMBER(Item::name)>,
+  Required<201, NDN_CXX_TLV_SCHEMA_MEMBER(Item::count)>,
+  Optional<202, NDN_CXX_TLV_SCHEMA_MEMBER(Item::lifetime)>,
+  Required<203, NDN_CXX_TLV_SCHEMA_MEMBER(Item::color)>,
+  Repeated<204, NDN_CXX_TLV_SCHEMA_MEMBER(Item::tags)>,
+  Required<205, NDN_CXX_TLV_SCHEMA_MEMBER(Item::inner), NestedCodec<ndn::Name>>>;
+
+static Block
+encodeItem(const Item& item)
+{
+  EncodingEstimator estimator;
+  size_t estimatedSize = ItemSchema::encode(estimator, item);
+
+  EncodingBuffer buffer(estimatedSize, 0);
+  size_t actualSize = ItemSchema::encode(buffer, item);
+  BOOST_CHECK_EQUAL(actualSize, estimatedSize);
+  return buffer.block();
+}
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  Item item;
+  item.name = "/A";
+  item.count = 300;
+  item.lifetime = 5_s;
+  item.color = Color::GREEN;
+  item.tags = {"x", "yz"};
+  item.inner = "/B";
+
+  static const uint8_t WIRE[] = {
+    0xc8, 0x1e,
+          0x07, 0x03, 0x08, 0x01, 0x41, // Name
+          0xc9, 0x02, 0x01, 0x2c, // count
+          0xca, 0x02, 0x13, 0x88, // lifetime
+          0xcb, 0x01, 0x02, // color
+          0xcc, 0x01, 0x78, // tags
+          0xcc, 0x02, 0x79, 0x7a,
+          0xcd, 0x05, 0x07, 0x03, 0x08, 0x01, 0x42, // inner
+  };
+  Block wire = encodeItem(item);
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(), WIRE, WIRE + sizeof(WIRE));
+
+  Item decoded;
+  decoded.tags = {"stale"};
+  ItemSchema::decode(decoded, Block(WIRE, sizeof(WIRE)));
+  BOOST_CHECK_EQUAL(decoded.name, "/A");
+  BOOST_CHECK_EQUAL(decoded.count, 300);
+  BOOST_REQUIRE(decoded.lifetime);
+  BOOST_CHECK_EQUAL(*decoded.lifetime, 5_s);
+  BOOST_CHECK(decoded.color == Color::GREEN);
+  BOOST_CHECK_EQUAL_COLLECTIONS(decoded.tags.begin(), decoded.tags.end(),
+                                item.tags.begin(), item.tags.end());
+  BOOST_CHECK_EQUAL(decoded.inner, "/B");
+}
+
+BOOST_AUTO_TEST_CASE(OmittedFields)
+{
+  Item item;
+  item.name = "/A";
+  item.inner = "/B";
+
+  static const uint8_t WIRE[] = {
+    0xc8, 0x12,
+          0x07, 0x03, 0x08, 0x01, 0x41,
+          0xc9, 0x01, 0x00,
+          0xcb, 0x01, 0x01,
+          0xcd, 0x05, 0x07, 0x03, 0x08, 0x01, 0x42,
+  };
+  Block wire = encodeItem(item);
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(), WIRE, WIRE + sizeof(WIRE));
+
+  Item decoded;
+  decoded.lifetime = 1_s;
+  decoded.tags = {"stale"};
+  ItemSchema::decode(decoded, wire);
+  BOOST_CHECK(!decoded.lifetime);
+  BOOST_CHECK(decoded.tags.empty());
+}
+
+BOOST_AUTO_TEST_CASE(DecodeTrailingElements)
+{
+  static const uint8_t WIRE[] = {
+    0xc8, 0x15,
+          0x07, 0x03, 0x08, 0x01, 0x41,
+          0xc9, 0x01, 0x07,
+          0xcb, 0x01, 0x01,
+          0xcd, 0x05, 0x07, 0x03, 0x08, 0x01, 0x42,
+          0xf0, 0x01, 0x00, // unrecognized
+  };
+  Item decoded;
+  ItemSchema::decode(decoded, Block(WIRE, sizeof(WIRE)));
+  BOOST_CHECK_EQUAL(decoded.count, 7);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeError)
+{
+  Item decoded;
+
+  // wrong TLV-TYPE
+  BOOST_CHECK_THROW(ItemSchema::decode(decoded, "C900"_block), Item::Error);
+
+  // missing required field
+  BOOST_CHECK_THROW(ItemSchema::decode(decoded, "C805 0703080141"_block), Item::Error);
+
+  // out of order
+  BOOST_CHECK_THROW(ItemSchema::decode(decoded, "C808 C90101 0703080141"_block), Item::Error);
+
+  // enum value too large
+  BOOST_CHECK_THROW(ItemSchema::decode(decoded,
+    "C813 0703080141 C90107 CB020100 CD050703080142"_block), tlv::Error);
+
+  // empty nested element
+  BOOST_CHECK_THROW(ItemSchema::decode(decoded,
+    "C80D 0703080141 C90107 CB0101 CD00"_block), tlv::Error);
+
+  // sub-element exceeds parent
+  BOOST_CHECK_THROW(ItemSchema::decode(decoded, "C807 07060801410000"_block), tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeInterruptedRepeated)
+{
+  using TagsSchema = Record<200,
+    Required<tlv::Name, NDN_CXX_TLV_SCHEMA_MEMBER(Item::name)>,
+    Repeated<204, NDN_CXX_TLV_SCHEMA_MEMBER(Item::tags)>>;
+  Item decoded;
+
+  // unrecognized elements after the last repeated element are ignored
+  TagsSchema::decode(decoded, "C80E 0703080141 CC0178 CC0179 F00100"_block);
+  BOOST_CHECK_EQUAL(decoded.tags.size(), 2);
+
+  // but must not be followed by more repeated elements
+  BOOST_CHECK_THROW(TagsSchema::decode(decoded, "C80E 0703080141 CC0178 F00100 CC0179"_block),
+                    Item::Error);
+  BOOST_CHECK_THROW(TagsSchema::decode(decoded, "C80B 0703080141 F00100 CC0179"_block),
+                    Item::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTlvSchema
+BOOST_AUTO_TEST_SUITE_END() // Encoding
+
+} // namespace tests
+} // namespace schema
+} // namespace tlv
+} // namespace ndn
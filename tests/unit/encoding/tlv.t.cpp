@@ -569,6 +569,142 @@ BOOST_AUTO_TEST_CASE(ReadFromStream)
 
 BOOST_AUTO_TEST_SUITE_END() // NonNegativeInteger
 
+BOOST_AUTO_TEST_SUITE(ScanElements)
+
+BOOST_AUTO_TEST_CASE(Complete)
+{
+  const uint8_t BUFFER[] = {
+    0x08, 0x02, 0x61, 0x62,                   // 1-octet TLV-TYPE and TLV-LENGTH
+    0xfd, 0x01, 0x00, 0x01, 0x63,             // 3-octet TLV-TYPE
+    0x09, 0xfd, 0x00, 0x01, 0x64,             // 3-octet TLV-LENGTH
+    0x0a, 0x00,                               // zero TLV-LENGTH
+  };
+
+  std::vector<ElementBounds> elements;
+  BOOST_CHECK_EQUAL(scanElements(BUFFER, sizeof(BUFFER), elements), sizeof(BUFFER));
+  BOOST_REQUIRE_EQUAL(elements.size(), 4);
+
+  BOOST_CHECK_EQUAL(elements[0].type, 0x08);
+  BOOST_CHECK_EQUAL(elements[0].begin, 0);
+  BOOST_CHECK_EQUAL(elements[0].valueBegin, 2);
+  BOOST_CHECK_EQUAL(elements[0].end, 4);
+
+  BOOST_CHECK_EQUAL(elements[1].type, 0x100);
+  BOOST_CHECK_EQUAL(elements[1].begin, 4);
+  BOOST_CHECK_EQUAL(elements[1].valueBegin, 8);
+  BOOST_CHECK_EQUAL(elements[1].end, 9);
+
+  BOOST_CHECK_EQUAL(elements[2].type, 0x09);
+  BOOST_CHECK_EQUAL(elements[2].begin, 9);
+  BOOST_CHECK_EQUAL(elements[2].valueBegin, 13);
+  BOOST_CHECK_EQUAL(elements[2].end, 14);
+
+  BOOST_CHECK_EQUAL(elements[3].type, 0x0a);
+  BOOST_CHECK_EQUAL(elements[3].begin, 14);
+  BOOST_CHECK_EQUAL(elements[3].valueBegin, 16);
+  BOOST_CHECK_EQUAL(elements[3].end, 16);
+
+  elements.clear();
+  BOOST_CHECK_EQUAL(scanElements(BUFFER, 0, elements), 0);
+  BOOST_CHECK(elements.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Incomplete)
+{
+  const uint8_t BUFFER[] = {
+    0x08, 0x02, 0x61, 0x62,
+    0x08, 0x03, 0x61, 0x62,                   // TLV-VALUE truncated
+  };
+
+  size_t nCalls = 0;
+  auto countCalls = [&nCalls] (const ElementBounds&) { ++nCalls; };
+
+  BOOST_CHECK_EQUAL(scanElements(BUFFER, sizeof(BUFFER), countCalls), 4);
+  BOOST_CHECK_EQUAL(nCalls, 1);
+
+  nCalls = 0;
+  BOOST_CHECK_EQUAL(scanElements(BUFFER, 5, countCalls), 4); // TLV-LENGTH missing
+  BOOST_CHECK_EQUAL(nCalls, 1);
+
+  const uint8_t TRUNCATED_LENGTH[] = {0x08, 0xfd, 0x01};
+  nCalls = 0;
+  BOOST_CHECK_EQUAL(scanElements(TRUNCATED_LENGTH, sizeof(TRUNCATED_LENGTH), countCalls), 0);
+  BOOST_CHECK_EQUAL(nCalls, 0);
+
+  const uint8_t HUGE_LENGTH[] = {0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+  nCalls = 0;
+  BOOST_CHECK_EQUAL(scanElements(HUGE_LENGTH, sizeof(HUGE_LENGTH), countCalls), 0);
+  BOOST_CHECK_EQUAL(nCalls, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  size_t nCalls = 0;
+  auto countCalls = [&nCalls] (const ElementBounds&) { ++nCalls; };
+
+  const uint8_t ZERO_TYPE[] = {0x08, 0x00, 0x00, 0x00, 0x08, 0x00};
+  BOOST_CHECK_EQUAL(scanElements(ZERO_TYPE, sizeof(ZERO_TYPE), countCalls), 2);
+  BOOST_CHECK_EQUAL(nCalls, 1);
+
+  const uint8_t ZERO_TYPE_LONG[] = {0xfd, 0x00, 0x00, 0x00};
+  nCalls = 0;
+  BOOST_CHECK_EQUAL(scanElements(ZERO_TYPE_LONG, sizeof(ZERO_TYPE_LONG), countCalls), 0);
+  BOOST_CHECK_EQUAL(nCalls, 0);
+
+  const uint8_t TYPE_TOO_LARGE[] = {0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00};
+  BOOST_CHECK_EQUAL(scanElements(TYPE_TOO_LARGE, sizeof(TYPE_TOO_LARGE), countCalls), 0);
+  BOOST_CHECK_EQUAL(nCalls, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Children)
+{
+  const uint8_t BUFFER[] = {
+    0x06, 0x07,                               // element with two sub-elements
+          0x08, 0x01, 0x61,
+          0xfd, 0x01, 0x00, 0x00,
+    0x18, 0x01, 0x05,                         // TLV-VALUE is not a sequence of elements
+    0x0a, 0x00,                               // empty TLV-VALUE
+    0x15, 0x02, 0x08, 0x00,                   // one empty sub-element
+    0x06, 0x03, 0x08,                         // incomplete
+  };
+
+  std::vector<ElementBounds> elements;
+  std::vector<ElementBounds> children;
+  BOOST_CHECK_EQUAL(scanElements(BUFFER, sizeof(BUFFER), elements, children), 18);
+  BOOST_REQUIRE_EQUAL(elements.size(), 4);
+  BOOST_REQUIRE_EQUAL(children.size(), 3);
+
+  BOOST_CHECK_EQUAL(elements[0].firstChild, 0);
+  BOOST_CHECK_EQUAL(elements[0].nChildren, 2);
+  BOOST_CHECK_EQUAL(children[0].type, 0x08);
+  BOOST_CHECK_EQUAL(children[0].begin, 2);
+  BOOST_CHECK_EQUAL(children[0].valueBegin, 4);
+  BOOST_CHECK_EQUAL(children[0].end, 5);
+  BOOST_CHECK_EQUAL(children[1].type, 0x100);
+  BOOST_CHECK_EQUAL(children[1].begin, 5);
+  BOOST_CHECK_EQUAL(children[1].valueBegin, 9);
+  BOOST_CHECK_EQUAL(children[1].end, 9);
+
+  BOOST_CHECK_EQUAL(elements[1].type, 0x18);
+  BOOST_CHECK_EQUAL(elements[1].nChildren, 0);
+  BOOST_CHECK_EQUAL(elements[2].type, 0x0a);
+  BOOST_CHECK_EQUAL(elements[2].nChildren, 0);
+
+  BOOST_CHECK_EQUAL(elements[3].firstChild, 2);
+  BOOST_CHECK_EQUAL(elements[3].nChildren, 1);
+  BOOST_CHECK_EQUAL(children[2].type, 0x08);
+  BOOST_CHECK_EQUAL(children[2].begin, 16);
+  BOOST_CHECK_EQUAL(children[2].end, 18);
+
+  // the plain overload does not report sub-elements
+  elements.clear();
+  BOOST_CHECK_EQUAL(scanElements(BUFFER, sizeof(BUFFER), elements), 18);
+  BOOST_REQUIRE_EQUAL(elements.size(), 4);
+  BOOST_CHECK_EQUAL(elements[0].nChildren, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ScanElements
+
 BOOST_AUTO_TEST_SUITE(PrintHelpers)
 
 BOOST_AUTO_TEST_CASE(PrintSignatureTypeValue)
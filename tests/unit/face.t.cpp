@@ -32,6 +32,8 @@
 
 #include <boost/logic/tribool.hpp>
 
+#include <numeric>
+
 namespace ndn {
 namespace tests {
 
@@ -369,6 +371,30 @@ BOOST_AUTO_TEST_CASE(PutData)
   BOOST_CHECK(face.sentData[1].getTag<lp::CongestionMarkTag>() != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(PutDataExternalContent)
+{
+  auto content = make_shared<Buffer>(4000);
+  std::iota(content->begin(), content->end(), 0);
+
+  Data data("/kCHiR0Vnf3/external");
+  data.setExternalContent(content);
+  signData(data);
+  face.put(data);
+
+  data.setTag(make_shared<lp::CongestionMarkTag>(1));
+  face.put(data);
+
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 2);
+  BOOST_CHECK_EQUAL(face.sentData[0], data);
+  BOOST_CHECK(face.sentData[0].getTag<lp::CongestionMarkTag>() == nullptr);
+  BOOST_CHECK_EQUAL(face.sentData[1], data);
+  BOOST_CHECK(face.sentData[1].getTag<lp::CongestionMarkTag>() != nullptr);
+  BOOST_CHECK_EQUAL_COLLECTIONS(face.sentData[1].getContent().value_begin(),
+                                face.sentData[1].getContent().value_end(),
+                                content->begin(), content->end());
+}
+
 BOOST_AUTO_TEST_CASE(PutDataLoopback)
 {
   bool hasInterest1 = false, hasData = false;
@@ -839,6 +865,94 @@ BOOST_AUTO_TEST_CASE(ProcessEvents)
   BOOST_CHECK_EQUAL(nRegSuccesses, 1);
 }
 
+BOOST_AUTO_TEST_CASE(Poll)
+{
+  BOOST_CHECK_EQUAL(face.getNativeHandle(), -1); // DummyClientFace transport is not a socket
+  BOOST_CHECK(!face.getNextDeadline());
+
+  size_t nData = 0;
+  face.expressInterest(*makeInterest("/Hello/World", true, 100_ms),
+                       [&] (const auto&, const auto&) { ++nData; },
+                       bind([] { BOOST_FAIL("Unexpected Nack"); }),
+                       bind([] { BOOST_FAIL("Unexpected timeout"); }));
+  BOOST_CHECK_GT(face.poll(), 0);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1);
+  BOOST_REQUIRE(face.getNextDeadline());
+  BOOST_CHECK(*face.getNextDeadline() == time::steady_clock::now() + 100_ms);
+
+  face.receive(*makeData("/Hello/World/a"));
+  face.poll();
+  BOOST_CHECK_EQUAL(nData, 1);
+  BOOST_CHECK(!face.getNextDeadline());
+  BOOST_CHECK_EQUAL(face.poll(), 0);
+
+  // poll() works after the io_service has been stopped
+  face.getIoService().stop();
+  face.expressInterest(*makeInterest("/Hello/World", true, 100_ms), nullptr, nullptr, nullptr);
+  BOOST_CHECK_GT(face.poll(), 0);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+}
+
+class ConnectingTransport : public ndn::Transport
+{
+public:
+  void
+  close() final
+  {
+  }
+
+  void
+  send(const Block&) final
+  {
+  }
+
+  void
+  send(const Block&, const Block&) final
+  {
+  }
+
+  void
+  pause() final
+  {
+  }
+
+  void
+  resume() final
+  {
+  }
+
+  optional<time::steady_clock::TimePoint>
+  getConnectDeadline() const final
+  {
+    return connectDeadline;
+  }
+
+public:
+  optional<time::steady_clock::TimePoint> connectDeadline;
+};
+
+BOOST_AUTO_TEST_CASE(NextDeadlineIncludesConnect)
+{
+  auto transport = make_shared<ConnectingTransport>();
+  Face face2(transport, io, m_keyChain);
+  BOOST_CHECK(!face2.getNextDeadline());
+
+  transport->connectDeadline = time::steady_clock::now() + 4_s;
+  BOOST_REQUIRE(face2.getNextDeadline());
+  BOOST_CHECK(*face2.getNextDeadline() == *transport->connectDeadline);
+
+  face2.expressInterest(*makeInterest("/Hello/World", true, 100_ms), nullptr, nullptr, nullptr);
+  advanceClocks(1_ms);
+  BOOST_REQUIRE(face2.getNextDeadline());
+  BOOST_CHECK(*face2.getNextDeadline() == time::steady_clock::now() + 100_ms);
+
+  transport->connectDeadline = time::steady_clock::now() + 10_ms;
+  BOOST_CHECK(*face2.getNextDeadline() == *transport->connectDeadline);
+
+  transport->connectDeadline = nullopt;
+  BOOST_CHECK(*face2.getNextDeadline() == time::steady_clock::now() + 100_ms);
+}
+
 BOOST_AUTO_TEST_CASE(DestroyWithoutProcessEvents) // Bug 3248
 {
   auto face2 = make_unique<Face>(io);
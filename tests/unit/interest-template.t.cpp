@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/interest-template.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestInterestTemplate)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  InterestTemplate tpl("/A");
+  BOOST_CHECK_EQUAL(tpl.getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(tpl.getCanBePrefix(), false);
+  BOOST_CHECK_EQUAL(tpl.getMustBeFresh(), false);
+  BOOST_CHECK(tpl.getForwardingHint().empty());
+  BOOST_CHECK_EQUAL(tpl.getInterestLifetime(), DEFAULT_INTEREST_LIFETIME);
+  BOOST_CHECK(!tpl.getHopLimit());
+
+  BOOST_CHECK_EQUAL(tpl.encode({}, Interest::Nonce(0x01020304)),
+                    "050B 0703(080141) 0A04(01020304)"_block);
+
+  auto interest = tpl.makeInterest("/B");
+  BOOST_CHECK_EQUAL(interest->getName(), "/A/B");
+  BOOST_CHECK(interest->hasNonce());
+  BOOST_CHECK(interest->hasWire());
+  BOOST_CHECK_NE(tpl.makeInterest("/B")->getNonce(), interest->getNonce()); // very unlikely to collide
+
+  InterestTemplate empty;
+  BOOST_CHECK_THROW(empty.encode(), std::invalid_argument);
+  BOOST_CHECK_EQUAL(empty.makeInterest("/C")->getName(), "/C");
+}
+
+BOOST_AUTO_TEST_CASE(SameAsInterest)
+{
+  InterestTemplate tpl("/local/ndn", 8_s);
+  tpl.setCanBePrefix(true)
+     .setMustBeFresh(true)
+     .setForwardingHint({{15893, "/FH"}})
+     .setHopLimit(214);
+
+  Interest expected(Name("/local/ndn/prefix").appendSegment(3));
+  expected.setCanBePrefix(true);
+  expected.setMustBeFresh(true);
+  expected.setForwardingHint({{15893, "/FH"}});
+  expected.setNonce(0x4c1ecb4a);
+  expected.setInterestLifetime(8_s);
+  expected.setHopLimit(214);
+
+  Block wire = tpl.encode(Name("/prefix").appendSegment(3), Interest::Nonce(0x4c1ecb4a));
+  BOOST_CHECK_EQUAL(wire, expected.wireEncode());
+  BOOST_CHECK_EQUAL(wire.size(), wire.getBuffer()->size()); // single right-sized buffer
+
+  tpl.setCanBePrefix(false)
+     .setMustBeFresh(false)
+     .setForwardingHint({})
+     .setInterestLifetime(DEFAULT_INTEREST_LIFETIME)
+     .setHopLimit(nullopt);
+  expected.setCanBePrefix(false);
+  expected.setMustBeFresh(false);
+  expected.setForwardingHint({});
+  expected.setInterestLifetime(DEFAULT_INTEREST_LIFETIME);
+  expected.setHopLimit(nullopt);
+  BOOST_CHECK_EQUAL(tpl.encode(Name("/prefix").appendSegment(3), Interest::Nonce(0x4c1ecb4a)),
+                    expected.wireEncode());
+}
+
+BOOST_AUTO_TEST_CASE(Errors)
+{
+  BOOST_CHECK_THROW(InterestTemplate("/A", -1_ms), std::invalid_argument);
+
+  InterestTemplate tpl("/A");
+  BOOST_CHECK_THROW(tpl.setInterestLifetime(-1_ms), std::invalid_argument);
+
+  Name withDigest("/B");
+  withDigest.appendParametersSha256DigestPlaceholder();
+  BOOST_CHECK_THROW(tpl.setPrefix(withDigest), std::invalid_argument);
+  BOOST_CHECK_THROW(tpl.encode(withDigest), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInterestTemplate
+
+} // namespace tests
+} // namespace ndn
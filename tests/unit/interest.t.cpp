@@ -768,6 +768,39 @@ BOOST_AUTO_TEST_CASE(ModifyForwardingHint)
   BOOST_CHECK_EQUAL(i.getForwardingHint(), DelegationList({{1, "/A"}, {2, "/B"}}));
 }
 
+BOOST_AUTO_TEST_CASE(SetSharedForwardingHint)
+{
+  auto fh = SharedForwardingHint::create(DelegationList({{2, "/B"}, {1, "/A"}}));
+
+  Interest i1("/I");
+  i1.setCanBePrefix(false);
+  BOOST_CHECK(i1.getSharedForwardingHint() == nullptr);
+  i1.wireEncode();
+  i1.setSharedForwardingHint(fh);
+  BOOST_CHECK(!i1.hasWire());
+  BOOST_CHECK_EQUAL(i1.getForwardingHint(), DelegationList({{1, "/A"}, {2, "/B"}}));
+
+  Interest i2(i1);
+  BOOST_CHECK_EQUAL(i2.getSharedForwardingHint(), fh); // copied by reference
+
+  Interest i3(i1.wireEncode());
+  BOOST_CHECK_EQUAL(i3.getForwardingHint(), fh->getDelegations());
+  BOOST_CHECK_EQUAL(i3.getSharedForwardingHint()->wireEncode(), fh->wireEncode());
+
+  // modifying one Interest does not affect the others sharing the ForwardingHint
+  i2.modifyForwardingHint([] (DelegationList& dl) { dl.erase("/A"); });
+  BOOST_CHECK_EQUAL(i2.getForwardingHint(), DelegationList({{2, "/B"}}));
+  BOOST_CHECK_EQUAL(i1.getForwardingHint(), DelegationList({{1, "/A"}, {2, "/B"}}));
+
+  i2.modifyForwardingHint([] (DelegationList& dl) { dl.erase("/B"); });
+  BOOST_CHECK(i2.getSharedForwardingHint() == nullptr);
+  BOOST_CHECK_EQUAL(i2.getForwardingHint().empty(), true);
+
+  i1.setForwardingHint(DelegationList());
+  BOOST_CHECK(i1.getSharedForwardingHint() == nullptr);
+  BOOST_CHECK_EQUAL(i1.wireEncode(), Interest(i2).wireEncode());
+}
+
 BOOST_AUTO_TEST_CASE(GetNonce)
 {
   unique_ptr<Interest> i1, i2;
@@ -1064,6 +1097,18 @@ BOOST_AUTO_TEST_CASE(ParametersSha256DigestComponent)
   BOOST_CHECK_EQUAL(i.getApplicationParameters(), "2404 C0C1C2C3"_block);
   BOOST_CHECK(i.getSignatureInfo() == si);
   BOOST_CHECK_EQUAL(i.getSignatureValue(), sv);
+
+  // the digest remains consistent across encoding and decoding
+  i.setCanBePrefix(false);
+  Interest decoded(i.wireEncode());
+  BOOST_CHECK_EQUAL(decoded.getName(), i.getName());
+  BOOST_CHECK_EQUAL(decoded.isParametersDigestValid(), true);
+
+  // decoding another packet discards the previously computed digest
+  DisableAutoCheckParametersDigest disabler;
+  decoded.wireDecode("052B 0725(080149 02200000000000000000000000000000000000000000000000000000000000000000) "
+                     "2402CAFE"_block);
+  BOOST_CHECK_EQUAL(decoded.isParametersDigestValid(), false);
 }
 
 BOOST_AUTO_TEST_CASE(ExtractSignedRanges)
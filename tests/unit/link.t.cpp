@@ -172,6 +172,33 @@ BOOST_AUTO_TEST_CASE(RemoveDelegation)
 
 BOOST_AUTO_TEST_SUITE_END() // Modify
 
+BOOST_AUTO_TEST_CASE(GetForwardingHint)
+{
+  Link link("/test");
+  BOOST_CHECK(link.getForwardingHint() == nullptr);
+
+  link.setDelegationList(DelegationList({{20, "/test2"}, {10, "/test1"}}));
+  auto fh = link.getForwardingHint();
+  BOOST_REQUIRE(fh != nullptr);
+  BOOST_CHECK_EQUAL(fh->getDelegations(), link.getDelegationList());
+  BOOST_CHECK_EQUAL(link.getForwardingHint(), fh); // cached
+
+  link.addDelegation(30, "/test3");
+  BOOST_CHECK_NE(link.getForwardingHint(), fh);
+  BOOST_CHECK_EQUAL(link.getForwardingHint()->getDelegations(), link.getDelegationList());
+  fh = link.getForwardingHint();
+
+  signData(link);
+  link.wireDecode(link.wireEncode());
+  BOOST_CHECK_NE(link.getForwardingHint(), fh);
+  BOOST_CHECK_EQUAL(link.getForwardingHint()->getDelegations(), fh->getDelegations());
+
+  link.removeDelegation("/test1");
+  link.removeDelegation("/test2");
+  link.removeDelegation("/test3");
+  BOOST_CHECK(link.getForwardingHint() == nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestLink
 
 } // namespace tests
@@ -21,12 +21,20 @@
 
 #include "ndn-cxx/mgmt/dispatcher.hpp"
 #include "ndn-cxx/mgmt/nfd/control-parameters.hpp"
+#include "ndn-cxx/security/certificate-fetcher-offline.hpp"
+#include "ndn-cxx/security/command-interest-signer.hpp"
+#include "ndn-cxx/security/validation-policy-command-interest.hpp"
+#include "ndn-cxx/security/validation-policy-simple-hierarchy.hpp"
 #include "ndn-cxx/util/dummy-client-face.hpp"
 
 #include "tests/boost-test.hpp"
 #include "tests/make-interest-data.hpp"
 #include "tests/unit/identity-management-time-fixture.hpp"
 
+#include <future>
+#include <mutex>
+#include <thread>
+
 namespace ndn {
 namespace mgmt {
 namespace tests {
@@ -302,6 +310,280 @@ BOOST_AUTO_TEST_CASE(ControlCommandAsyncAuthorization) // Bug 4059
   BOOST_CHECK_EQUAL(nCallbackCalled, 1);
 }
 
+/** \brief a latch that blocks worker threads until it is opened by the test
+ *
+ *  It is opened on destruction, so that a failing test case does not leave the
+ *  Dispatcher waiting for a blocked worker forever.
+ */
+class Gate : noncopyable
+{
+public:
+  ~Gate()
+  {
+    open();
+  }
+
+  void
+  open()
+  {
+    std::call_once(m_once, [this] { m_promise.set_value(); });
+  }
+
+  void
+  wait()
+  {
+    m_future.wait();
+  }
+
+private:
+  std::promise<void> m_promise;
+  std::shared_future<void> m_future = m_promise.get_future().share();
+  std::once_flag m_once;
+};
+
+/** \brief poll the io_service until \p pred holds, giving worker threads time to post
+ *         their outcomes
+ */
+template<typename Pred>
+static void
+advanceClocksUntil(UnitTestTimeFixture& fixture, const Pred& pred)
+{
+  for (int i = 0; i < 1000 && !pred(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    fixture.advanceClocks(1_ms);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ControlCommandWorkerAuthorization)
+{
+  auto verify = dispatcher.getVerificationExecutor();
+  Gate slowStarted, slowRelease;
+  size_t nVerified = 0;
+  auto authorization =
+    [&] (const Name& prefix, const Interest& interest, const ControlParameters* params,
+         AcceptContinuation accept, RejectContinuation reject) {
+      bool isSlow = interest.getName()[-1] == name::Component("slow");
+      verify([&, isSlow] {
+               if (isSlow) {
+                 slowStarted.open();
+                 slowRelease.wait();
+               }
+               return true;
+             },
+             [&, accept] (bool) {
+               ++nVerified;
+               accept("");
+             });
+    };
+
+  std::vector<std::string> handled;
+  dispatcher
+    .addControlCommand<VoidParameters>("test", authorization,
+                                       bind([] { return true; }),
+                                       [&handled] (const Name& prefix, const Interest& interest,
+                                                   const ControlParameters&,
+                                                   const CommandContinuation&) {
+                                         handled.push_back(interest.getName()[-1].toUri());
+                                       });
+  dispatcher.setAuthorizationThreads(2);
+  dispatcher.addTopPrefix("/root");
+  advanceClocks(1_ms);
+
+  // commands from the same requester are processed in arrival order
+  face.receive(*makeInterest("/root/test/%80%00/slow"));
+  face.receive(*makeInterest("/root/test/%80%00/fast"));
+  slowStarted.wait();
+  advanceClocksUntil(*this, [&] { return nVerified == 1; });
+  BOOST_CHECK_EQUAL(nVerified, 1);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(handled.size(), 0);
+
+  slowRelease.open();
+  advanceClocksUntil(*this, [&] { return nVerified == 2; });
+  advanceClocks(1_ms);
+  BOOST_CHECK(handled == (std::vector<std::string>{"slow", "fast"}));
+}
+
+BOOST_AUTO_TEST_CASE(ControlCommandWorkerIndependentRequesters)
+{
+  security::Identity slowIdentity = addIdentity("/slow-requester");
+  security::Identity fastIdentity = addIdentity("/fast-requester");
+
+  auto verify = dispatcher.getVerificationExecutor();
+  Gate slowStarted, slowRelease;
+  size_t nVerified = 0;
+  auto authorization =
+    [&] (const Name& prefix, const Interest& interest, const ControlParameters* params,
+         AcceptContinuation accept, RejectContinuation reject) {
+      // signed Interest name: /root/test/<parameters>/<tag>/<SignatureInfo>/<SignatureValue>
+      bool isSlow = interest.getName()[3] == name::Component("slow");
+      verify([&, isSlow] {
+               if (isSlow) {
+                 slowStarted.open();
+                 slowRelease.wait();
+               }
+               return true;
+             },
+             [&, accept] (bool) {
+               ++nVerified;
+               accept("");
+             });
+    };
+
+  std::vector<std::string> handled;
+  dispatcher
+    .addControlCommand<VoidParameters>("test", authorization,
+                                       bind([] { return true; }),
+                                       [&handled] (const Name& prefix, const Interest& interest,
+                                                   const ControlParameters&,
+                                                   const CommandContinuation&) {
+                                         handled.push_back(interest.getName()[3].toUri());
+                                       });
+  dispatcher.setAuthorizationThreads(2);
+  dispatcher.addTopPrefix("/root");
+  advanceClocks(1_ms);
+
+  auto slowInterest = makeInterest("/root/test/%80%00/slow");
+  m_keyChain.sign(*slowInterest, security::signingByIdentity(slowIdentity));
+  auto fastInterest = makeInterest("/root/test/%80%00/fast");
+  m_keyChain.sign(*fastInterest, security::signingByIdentity(fastIdentity));
+
+  // a blocked verification of one requester does not delay the commands of another
+  face.receive(*slowInterest);
+  face.receive(*fastInterest);
+  slowStarted.wait();
+  advanceClocksUntil(*this, [&] { return nVerified == 1; });
+  advanceClocks(1_ms);
+  BOOST_CHECK(handled == (std::vector<std::string>{"fast"}));
+
+  slowRelease.open();
+  advanceClocksUntil(*this, [&] { return nVerified == 2; });
+  advanceClocks(1_ms);
+  BOOST_CHECK(handled == (std::vector<std::string>{"fast", "slow"}));
+}
+
+BOOST_AUTO_TEST_CASE(ControlCommandWorkerValidator)
+{
+  security::Identity identity = addIdentity("/root");
+  security::Validator validator(
+    make_unique<security::ValidationPolicyCommandInterest>(
+      make_unique<security::ValidationPolicySimpleHierarchy>()),
+    make_unique<security::CertificateFetcherOffline>());
+  validator.loadAnchor("", security::Certificate(identity.getDefaultKey().getDefaultCertificate()));
+
+  // the signature is verified on a worker thread, the policy runs on the Face thread
+  std::thread::id verifierThread;
+  auto verify = dispatcher.getVerificationExecutor();
+  validator.setVerificationExecutor([&] (std::function<bool()> job, std::function<void(bool)> done) {
+    verify([&verifierThread, job] {
+             verifierThread = std::this_thread::get_id();
+             return job();
+           },
+           done);
+  });
+
+  size_t nOutcomes = 0;
+  auto authorization =
+    [&] (const Name& prefix, const Interest& interest, const ControlParameters* params,
+         AcceptContinuation accept, RejectContinuation reject) {
+      validator.validate(interest,
+                         [&, accept] (const Interest&) {
+                           ++nOutcomes;
+                           accept("");
+                         },
+                         [&, reject] (const Interest&, const security::ValidationError&) {
+                           ++nOutcomes;
+                           reject(RejectReply::STATUS403);
+                         });
+    };
+
+  size_t nCallbackCalled = 0;
+  dispatcher
+    .addControlCommand<VoidParameters>("test", authorization,
+                                       bind([] { return true; }),
+                                       bind([&nCallbackCalled] { ++nCallbackCalled; }));
+  dispatcher.setAuthorizationThreads(2);
+  dispatcher.addTopPrefix("/root");
+  advanceClocks(1_ms);
+
+  security::CommandInterestSigner signer(m_keyChain);
+  Interest i1 = signer.makeCommandInterest("/root/test/%80%00", security::signingByIdentity(identity));
+  face.receive(i1);
+  advanceClocksUntil(*this, [&] { return nOutcomes == 1; });
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nCallbackCalled, 1);
+  BOOST_CHECK(verifierThread != std::thread::id());
+  BOOST_CHECK(verifierThread != std::this_thread::get_id());
+
+  // the command Interest policy has recorded the timestamp of the first command
+  face.receive(i1);
+  advanceClocksUntil(*this, [&] { return nOutcomes == 2; });
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nCallbackCalled, 1);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK_EQUAL(ControlResponse(face.sentData[0].getContent().blockFromValue()).getCode(), 403);
+
+  advanceClocks(5_ms);
+  Interest i2 = signer.makeCommandInterest("/root/test/%80%00", security::signingByIdentity(identity));
+  face.receive(i2);
+  advanceClocksUntil(*this, [&] { return nOutcomes == 3; });
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nCallbackCalled, 2);
+
+  // a bad signature is detected by the worker
+  advanceClocks(5_ms);
+  Interest i3 = signer.makeCommandInterest("/root/test/%80%00", security::signingByIdentity(identity));
+  Block sigValue = i3.getName()[-1].blockFromValue();
+  Buffer badSigValue(sigValue.begin(), sigValue.end());
+  badSigValue.back() ^= 0xFF;
+  i3.setName(i3.getName().getPrefix(-1).append(badSigValue.data(), badSigValue.size()));
+  face.receive(i3);
+  advanceClocksUntil(*this, [&] { return nOutcomes == 4; });
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nCallbackCalled, 2);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ControlCommandWorkerOverload)
+{
+  BOOST_CHECK_THROW(dispatcher.setAuthorizationThreads(1, 0), std::invalid_argument);
+
+  AcceptContinuation accept;
+  auto authorization =
+    [&] (const Name& prefix, const Interest& interest, const ControlParameters* params,
+         AcceptContinuation acceptCont, RejectContinuation reject) {
+      accept = acceptCont;
+    };
+
+  size_t nCallbackCalled = 0;
+  dispatcher
+    .addControlCommand<VoidParameters>("test", authorization,
+                                       bind([] { return true; }),
+                                       bind([&nCallbackCalled] { ++nCallbackCalled; }));
+  dispatcher.setAuthorizationThreads(1, 1);
+  dispatcher.addTopPrefix("/root");
+  advanceClocks(1_ms);
+
+  face.receive(*makeInterest("/root/test/%80%00/first"));
+  face.receive(*makeInterest("/root/test/%80%00/second"));
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentNacks[0].getInterest().getName(), "/root/test/%80%00/second");
+  BOOST_CHECK_EQUAL(face.sentNacks[0].getReason(), lp::NackReason::CONGESTION);
+
+  // the authorization has stored the continuation of the first command
+  BOOST_REQUIRE(accept != nullptr);
+  accept("");
+  accept(""); // a second completion is ignored
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nCallbackCalled, 1);
+
+  // capacity is available again
+  face.receive(*makeInterest("/root/test/%80%00/third"));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(face.sentNacks.size(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(StatusDataset)
 {
   const uint8_t smallBuf[] = {0x81, 0x01, 0x01};
@@ -138,6 +138,18 @@ BOOST_AUTO_TEST_CASE(FibEntryEncode)
   BOOST_CHECK_EQUAL(entry1, entry2);
 }
 
+BOOST_AUTO_TEST_CASE(FibEntryDecode)
+{
+  // an unrecognized element after the last NextHopRecord is ignored
+  FibEntry entry("8010 0703080141 810669010A6A01C8 F00100"_block);
+  BOOST_CHECK_EQUAL(entry.getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(entry.getNextHopRecords().size(), 1);
+
+  // NextHopRecords must not be interrupted by another element
+  BOOST_CHECK_THROW(FibEntry("8018 0703080141 810669010A6A01C8 F00100 810669011E6A01C8"_block),
+                    FibEntry::Error);
+}
+
 BOOST_AUTO_TEST_CASE(FibEntryEquality)
 {
   FibEntry entry1, entry2;
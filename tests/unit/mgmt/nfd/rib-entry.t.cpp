@@ -144,6 +144,19 @@ BOOST_AUTO_TEST_CASE(RibEntryEncode)
   BOOST_CHECK_EQUAL(entry1, entry2);
 }
 
+BOOST_AUTO_TEST_CASE(RibEntryDecode)
+{
+  // an unrecognized element after the last Route is ignored
+  RibEntry entry("8016 0703080141 810C6901016F01006A01006C0101 F00100"_block);
+  BOOST_CHECK_EQUAL(entry.getName(), "/A");
+  BOOST_CHECK_EQUAL(entry.getRoutes().size(), 1);
+
+  // Routes must not be interrupted by another element
+  BOOST_CHECK_THROW(RibEntry("8024 0703080141 810C6901016F01006A01006C0101 F00100 "
+                             "810C6901026F01006A01006C0101"_block),
+                    RibEntry::Error);
+}
+
 BOOST_AUTO_TEST_CASE(RibEntryClearRoutes)
 {
   RibEntry entry;
@@ -23,6 +23,7 @@
 
 #include "tests/boost-test.hpp"
 
+#include <sstream>
 #include <unordered_map>
 
 namespace ndn {
@@ -94,6 +95,45 @@ BOOST_AUTO_TEST_CASE(ParseUri)
   BOOST_CHECK_THROW(Name("/hello//world"), name::Component::Error);
   BOOST_CHECK_THROW(Name("/hello/./world"), name::Component::Error);
   BOOST_CHECK_THROW(Name("/hello/../world"), name::Component::Error);
+
+  // typed components in alternate URI format
+  Name typed("/seg=3/v=1000/t=1577836800000000/sha256digest="
+             "28bad4b5275bd392dbb670c75cf0b66f13f7942b21e80f55c0e86b374753a548");
+  BOOST_CHECK(typed[0].isSegment());
+  BOOST_CHECK(typed[1].isVersion());
+  BOOST_CHECK(typed[2].isTimestamp());
+  BOOST_CHECK(typed[3].isImplicitSha256Digest());
+  BOOST_CHECK_EQUAL(Name(typed.toUri(name::UriFormat::ALTERNATE)), typed);
+  BOOST_CHECK_EQUAL(Name(typed.toUri(name::UriFormat::CANONICAL)), typed);
+  BOOST_CHECK_THROW(Name("/seg=03"), name::Component::Error);
+  BOOST_CHECK_THROW(Name("/v=18446744073709551616"), name::Component::Error);
+  BOOST_CHECK_THROW(Name("/sha256digest=2"), name::Component::Error);
+}
+
+BOOST_AUTO_TEST_CASE(ToUriBuffer)
+{
+  Name name("/hello/seg=42");
+  std::string expected = name.toUri(name::UriFormat::ALTERNATE);
+  BOOST_REQUIRE_EQUAL(expected, "/hello/seg=42");
+
+  char buf[32];
+  BOOST_CHECK_EQUAL(name.toUri(buf, sizeof(buf), name::UriFormat::ALTERNATE), expected.size());
+  BOOST_CHECK_EQUAL(std::string(buf, expected.size()), expected);
+
+  // truncated output still reports the complete size
+  std::fill(std::begin(buf), std::end(buf), 'x');
+  BOOST_CHECK_EQUAL(name.toUri(buf, 8, name::UriFormat::ALTERNATE), expected.size());
+  BOOST_CHECK_EQUAL(std::string(buf, 9), "/hello/sx");
+  BOOST_CHECK_EQUAL(name.toUri(nullptr, 0, name::UriFormat::ALTERNATE), expected.size());
+  BOOST_CHECK_EQUAL(Name().toUri(buf, sizeof(buf)), 1);
+
+  // longer than the internal stack buffer of the stream overload
+  Name longName;
+  longName.append(std::string(600, ' '));
+  std::ostringstream os;
+  os << longName;
+  BOOST_CHECK_EQUAL(os.str().size(), 1 + 3 * 600);
+  BOOST_CHECK_EQUAL(os.str(), longName.toUri());
 }
 
 BOOST_AUTO_TEST_CASE(DeepCopy)
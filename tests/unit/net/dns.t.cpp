@@ -177,6 +177,84 @@ BOOST_AUTO_TEST_CASE(Synchronous)
   BOOST_CHECK(address.is_v4() || address.is_v6());
 }
 
+BOOST_AUTO_TEST_CASE(CacheHit)
+{
+  // "localhost" is resolved from /etc/hosts, without any network access
+  ResolutionCache cache;
+  for (int i = 0; i < 2; ++i) {
+    cache.asyncResolve("localhost",
+                       [this] (const IpAddress& address) {
+                         ++m_nSuccesses;
+                         BOOST_CHECK(address.is_loopback());
+                       },
+                       bind(&DnsFixture::onFailure, this, false),
+                       m_ioService);
+    m_ioService.run();
+    m_ioService.reset();
+  }
+
+  BOOST_CHECK_EQUAL(m_nSuccesses, 2);
+  BOOST_CHECK_EQUAL(cache.getNLookups(), 1);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 1);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  cache.asyncResolve("localhost", [this] (auto&&) { ++m_nSuccesses; },
+                     bind(&DnsFixture::onFailure, this, false), m_ioService);
+  m_ioService.run();
+  BOOST_CHECK_EQUAL(m_nSuccesses, 3);
+  BOOST_CHECK_EQUAL(cache.getNLookups(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(CacheInFlight)
+{
+  ResolutionCache cache;
+  for (int i = 0; i < 5; ++i) {
+    cache.asyncResolve("localhost", [this] (auto&&) { ++m_nSuccesses; },
+                       bind(&DnsFixture::onFailure, this, false), m_ioService);
+  }
+  m_ioService.run();
+
+  BOOST_CHECK_EQUAL(m_nSuccesses, 5);
+  BOOST_CHECK_EQUAL(cache.getNLookups(), 1);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CacheExpiry)
+{
+  ResolutionCache cache(0_ns, 0_ns, 1);
+  for (const char* host : {"localhost", "127.0.0.1", "localhost"}) {
+    cache.asyncResolve(host, [this] (auto&&) { ++m_nSuccesses; },
+                       bind(&DnsFixture::onFailure, this, false), m_ioService);
+    m_ioService.run();
+    m_ioService.reset();
+  }
+
+  BOOST_CHECK_EQUAL(m_nSuccesses, 3);
+  BOOST_CHECK_EQUAL(cache.getNLookups(), 3);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 0);
+  BOOST_CHECK_EQUAL(cache.size(), 1); // capacity
+}
+
+BOOST_AUTO_TEST_CASE(CacheAddressSelector)
+{
+  ResolutionCache cache;
+  cache.asyncResolve("127.0.0.1", [this] (auto&&) { ++m_nSuccesses; },
+                     bind(&DnsFixture::onFailure, this, false), m_ioService, Ipv4Only());
+  m_ioService.run();
+  m_ioService.reset();
+
+  // the cached result contains no IPv6 address
+  cache.asyncResolve("127.0.0.1", [this] (auto&&) { ++m_nSuccesses; },
+                     bind(&DnsFixture::onFailure, this, true), m_ioService, Ipv6Only());
+  m_ioService.run();
+
+  BOOST_CHECK_EQUAL(m_nSuccesses, 1);
+  BOOST_CHECK_EQUAL(m_nFailures, 1);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestDns
 BOOST_AUTO_TEST_SUITE_END() // Net
 
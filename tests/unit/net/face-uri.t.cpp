@@ -608,6 +608,42 @@ BOOST_AUTO_TEST_CASE(CanonizeEmptyCallback)
   BOOST_CHECK(true);
 }
 
+BOOST_AUTO_TEST_CASE(CanonizeBatch)
+{
+  boost::asio::io_service io;
+  std::vector<FaceUri> uris{FaceUri("udp4://192.0.2.1:6363"),
+                            FaceUri("udp4://localhost"),
+                            FaceUri("tcp://[2001:db8::1]:7000"),
+                            FaceUri("udp6://192.0.2.3"),
+                            FaceUri("null://")};
+
+  int nCallbacks = 0;
+  FaceUri::canonizeBatch(uris, [&] (std::vector<FaceUri::CanonizeResult> results) {
+      ++nCallbacks;
+      BOOST_REQUIRE_EQUAL(results.size(), 5);
+      BOOST_CHECK(results[0].isCanonized);
+      BOOST_CHECK_EQUAL(results[0].canonicalUri, FaceUri("udp4://192.0.2.1:6363"));
+      BOOST_CHECK(results[1].isCanonized);
+      BOOST_CHECK_EQUAL(results[1].canonicalUri, FaceUri("udp4://127.0.0.1:6363"));
+      BOOST_CHECK(results[2].isCanonized);
+      BOOST_CHECK_EQUAL(results[2].canonicalUri, FaceUri("tcp6://[2001:db8::1]:7000"));
+      BOOST_CHECK(!results[3].isCanonized);
+      BOOST_CHECK_EQUAL(results[3].reason, "IPv4/v6 mismatch");
+      BOOST_CHECK(!results[4].isCanonized);
+      BOOST_CHECK_EQUAL(results[4].reason, "scheme not supported");
+    }, io, 1_s, 2);
+  BOOST_CHECK_EQUAL(nCallbacks, 0);
+  io.run();
+  BOOST_CHECK_EQUAL(nCallbacks, 1);
+
+  // empty batch completes immediately
+  FaceUri::canonizeBatch({}, [&] (std::vector<FaceUri::CanonizeResult> results) {
+      ++nCallbacks;
+      BOOST_CHECK(results.empty());
+    }, io, 1_s);
+  BOOST_CHECK_EQUAL(nCallbacks, 2);
+}
+
 BOOST_FIXTURE_TEST_CASE(CanonizeUnsupported, CanonizeFixture)
 {
   BOOST_CHECK_EQUAL(FaceUri::canCanonize("internal"), false);
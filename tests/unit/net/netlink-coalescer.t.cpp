@@ -0,0 +1,358 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/config.hpp"
+
+#ifdef NDN_CXX_HAVE_NETLINK
+
+#include "ndn-cxx/net/impl/netlink-coalescer.hpp"
+#include "ndn-cxx/net/impl/linux-if-constants.hpp"
+#include "ndn-cxx/net/impl/netlink-message.hpp"
+#include "ndn-cxx/net/impl/network-monitor-impl-netlink.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/unit/unit-test-time-fixture.hpp"
+
+#include <linux/if_addr.h>
+#include <linux/if_link.h>
+#include <net/if_arp.h>
+#include <net/if.h>
+
+namespace ndn {
+namespace net {
+namespace tests {
+
+using MessageBytes = NetlinkCoalescer::MessageBytes;
+
+template<typename Payload>
+static MessageBytes
+makeMessage(uint16_t type, const Payload& payload, uint16_t attrType = 0,
+            const void* attrValue = nullptr, size_t attrLen = 0)
+{
+  size_t len = NLMSG_LENGTH(sizeof(Payload));
+  if (attrValue != nullptr)
+    len = NLMSG_ALIGN(len) + RTA_LENGTH(attrLen);
+
+  MessageBytes buf(NLMSG_ALIGN(len));
+  auto nlh = reinterpret_cast<nlmsghdr*>(buf.data());
+  nlh->nlmsg_len = static_cast<uint32_t>(len);
+  nlh->nlmsg_type = type;
+  std::memcpy(NLMSG_DATA(nlh), &payload, sizeof(payload));
+
+  if (attrValue != nullptr) {
+    auto rta = reinterpret_cast<rtattr*>(buf.data() + NLMSG_ALIGN(NLMSG_LENGTH(sizeof(Payload))));
+    rta->rta_type = attrType;
+    rta->rta_len = static_cast<unsigned short>(RTA_LENGTH(attrLen));
+    std::memcpy(RTA_DATA(rta), attrValue, attrLen);
+  }
+  return buf;
+}
+
+static MessageBytes
+makeLink(uint16_t type, int ifindex, unsigned int flags)
+{
+  ifinfomsg ifi{};
+  ifi.ifi_family = AF_UNSPEC;
+  ifi.ifi_type = ARPHRD_ETHER;
+  ifi.ifi_index = ifindex;
+  ifi.ifi_flags = flags;
+  return makeMessage(type, ifi);
+}
+
+static MessageBytes
+makeLinkWithMtu(int ifindex, unsigned int flags, uint32_t mtu)
+{
+  ifinfomsg ifi{};
+  ifi.ifi_family = AF_UNSPEC;
+  ifi.ifi_type = ARPHRD_ETHER;
+  ifi.ifi_index = ifindex;
+  ifi.ifi_flags = flags;
+  return makeMessage(RTM_NEWLINK, ifi, IFLA_MTU, &mtu, sizeof(mtu));
+}
+
+static MessageBytes
+makeAddr4(uint16_t type, int ifindex, const char* ip)
+{
+  ifaddrmsg ifa{};
+  ifa.ifa_family = AF_INET;
+  ifa.ifa_prefixlen = 24;
+  ifa.ifa_index = static_cast<uint32_t>(ifindex);
+  auto bytes = boost::asio::ip::address_v4::from_string(ip).to_bytes();
+  return makeMessage(type, ifa, IFA_LOCAL, bytes.data(), bytes.size());
+}
+
+static MessageBytes
+makeRoute(uint16_t type)
+{
+  rtmsg rtm{};
+  rtm.rtm_family = AF_INET;
+  return makeMessage(type, rtm);
+}
+
+static void
+add(NetlinkCoalescer& coalescer, const MessageBytes& bytes)
+{
+  NetlinkMessage nlmsg(bytes.data(), bytes.size());
+  BOOST_REQUIRE(nlmsg.isValid());
+  coalescer.add(nlmsg);
+}
+
+BOOST_AUTO_TEST_SUITE(Net)
+BOOST_AUTO_TEST_SUITE(TestNetlinkCoalescer)
+
+BOOST_AUTO_TEST_CASE(FlappingLink)
+{
+  NetlinkCoalescer coalescer;
+  BOOST_CHECK(coalescer.empty());
+
+  // synthetic sequence: eth0 (index 2) bouncing carrier several times
+  auto up = makeLink(RTM_NEWLINK, 2, IFF_UP | IFF_RUNNING);
+  auto down = makeLink(RTM_NEWLINK, 2, IFF_UP);
+  for (int i = 0; i < 5; ++i) {
+    add(coalescer, down);
+    add(coalescer, up);
+  }
+  add(coalescer, makeRoute(RTM_NEWROUTE));
+  add(coalescer, makeRoute(RTM_DELROUTE));
+
+  BOOST_CHECK(!coalescer.empty());
+  BOOST_CHECK_EQUAL(coalescer.getNAdded(), 12);
+  BOOST_CHECK_EQUAL(coalescer.size(), 1);
+  BOOST_CHECK(coalescer.getInterfaceIndexes() == std::set<int>{2});
+
+  auto messages = coalescer.take();
+  BOOST_REQUIRE_EQUAL(messages.size(), 1);
+  BOOST_CHECK_EQUAL_COLLECTIONS(messages[0].begin(), messages[0].end(), up.begin(), up.end());
+
+  BOOST_CHECK(coalescer.empty());
+  BOOST_CHECK_EQUAL(coalescer.size(), 0);
+  BOOST_CHECK(coalescer.getInterfaceIndexes().empty());
+}
+
+BOOST_AUTO_TEST_CASE(Addresses)
+{
+  NetlinkCoalescer coalescer;
+
+  auto addA = makeAddr4(RTM_NEWADDR, 3, "192.0.2.1");
+  auto delA = makeAddr4(RTM_DELADDR, 3, "192.0.2.1");
+  auto addB = makeAddr4(RTM_NEWADDR, 3, "192.0.2.2");
+  auto addC = makeAddr4(RTM_NEWADDR, 4, "192.0.2.1");
+  auto link = makeLink(RTM_NEWLINK, 4, IFF_UP);
+
+  add(coalescer, addA);
+  add(coalescer, addB);
+  add(coalescer, addC);
+  add(coalescer, delA);
+  add(coalescer, link);
+
+  BOOST_CHECK_EQUAL(coalescer.getNAdded(), 5);
+  BOOST_CHECK_EQUAL(coalescer.size(), 4);
+  BOOST_CHECK((coalescer.getInterfaceIndexes() == std::set<int>{3, 4}));
+
+  // links first, then addresses in order of their last arrival
+  auto messages = coalescer.take();
+  BOOST_REQUIRE_EQUAL(messages.size(), 4);
+  BOOST_CHECK(messages[0] == link);
+  BOOST_CHECK(messages[1] == addB);
+  BOOST_CHECK(messages[2] == addC);
+  BOOST_CHECK(messages[3] == delA);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  NetlinkCoalescer coalescer;
+
+  // link message too short to contain an ifinfomsg
+  MessageBytes bytes(NLMSG_LENGTH(0));
+  auto nlh = reinterpret_cast<nlmsghdr*>(bytes.data());
+  nlh->nlmsg_len = static_cast<uint32_t>(bytes.size());
+  nlh->nlmsg_type = RTM_NEWLINK;
+  add(coalescer, bytes);
+  add(coalescer, bytes);
+
+  BOOST_CHECK_EQUAL(coalescer.size(), 2);
+  BOOST_CHECK(coalescer.getInterfaceIndexes().empty());
+  BOOST_CHECK_EQUAL(coalescer.take().size(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestNetlinkCoalescer
+
+/** \brief feeds synthetic notifications to a NetworkMonitorImplNetlink
+ *
+ *  The monitor enumerates the real interfaces of the host first. The synthetic interfaces
+ *  use indexes that the kernel does not assign in practice, and only changes to them are
+ *  recorded, so that unrelated events on the host do not affect the test.
+ */
+class NetlinkMonitorFixture : public ndn::tests::UnitTestTimeFixture
+{
+public:
+  NetlinkMonitorFixture()
+    : monitor(io)
+  {
+    bool isEnumerated = false;
+    monitor.onEnumerationCompleted.connect([&] { isEnumerated = true; });
+    while (!isEnumerated && io.run_one() > 0) {
+    }
+    BOOST_REQUIRE(isEnumerated);
+
+    monitor.onNetworkChanged.connect([this] (const NetworkChangeSet& changes) {
+      NetworkChangeSet filtered;
+      auto isSynthetic = [] (const auto& netif) { return netif->getIndex() >= FIRST_INDEX; };
+      std::copy_if(changes.addedInterfaces.begin(), changes.addedInterfaces.end(),
+                   std::back_inserter(filtered.addedInterfaces), isSynthetic);
+      std::copy_if(changes.removedInterfaces.begin(), changes.removedInterfaces.end(),
+                   std::back_inserter(filtered.removedInterfaces), isSynthetic);
+      std::copy_if(changes.modifiedInterfaces.begin(), changes.modifiedInterfaces.end(),
+                   std::back_inserter(filtered.modifiedInterfaces),
+                   [&] (const auto& diff) { return isSynthetic(diff.interface); });
+      if (!filtered.empty()) {
+        changeSets.push_back(std::move(filtered));
+      }
+    });
+  }
+
+  void
+  notify(const MessageBytes& bytes)
+  {
+    NetlinkMessage nlmsg(bytes.data(), bytes.size());
+    BOOST_REQUIRE(nlmsg.isValid());
+    monitor.handleNotification(nlmsg);
+  }
+
+  static bool
+  hasSingleIp(const std::vector<NetworkAddress>& addresses, const char* ip)
+  {
+    return addresses.size() == 1 &&
+           addresses.front().getIp() == boost::asio::ip::address::from_string(ip);
+  }
+
+public:
+  static constexpr int FIRST_INDEX = 1000000;
+  static const unsigned int UP = IFF_UP | IFF_RUNNING;
+
+  NetworkMonitorImplNetlink monitor;
+  std::vector<NetworkChangeSet> changeSets;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestNetworkMonitorImplNetlink, NetlinkMonitorFixture)
+
+BOOST_AUTO_TEST_CASE(FlushCoalescedChanges)
+{
+  monitor.setCoalescingWindow(100_ms);
+  const int idx = FIRST_INDEX;
+
+  // a new interface is reported once the window has elapsed
+  notify(makeLinkWithMtu(idx, UP, 1500));
+  notify(makeAddr4(RTM_NEWADDR, idx, "192.0.2.1"));
+  advanceClocks(50_ms);
+  BOOST_CHECK_EQUAL(changeSets.size(), 0);
+  advanceClocks(50_ms);
+  BOOST_REQUIRE_EQUAL(changeSets.size(), 1);
+  BOOST_REQUIRE_EQUAL(changeSets[0].addedInterfaces.size(), 1);
+  BOOST_CHECK_EQUAL(changeSets[0].addedInterfaces[0]->getIndex(), idx);
+  BOOST_CHECK_EQUAL(changeSets[0].addedInterfaces[0]->getMtu(), 1500);
+  BOOST_CHECK_EQUAL(changeSets[0].addedInterfaces[0]->getNetworkAddresses().size(), 1);
+  BOOST_CHECK(changeSets[0].removedInterfaces.empty());
+  BOOST_CHECK(changeSets[0].modifiedInterfaces.empty());
+
+  // MTU and address changes of an existing interface
+  notify(makeLinkWithMtu(idx, UP, 9000));
+  notify(makeAddr4(RTM_DELADDR, idx, "192.0.2.1"));
+  notify(makeAddr4(RTM_NEWADDR, idx, "192.0.2.2"));
+  advanceClocks(100_ms);
+  BOOST_REQUIRE_EQUAL(changeSets.size(), 2);
+  BOOST_CHECK(changeSets[1].addedInterfaces.empty());
+  BOOST_CHECK(changeSets[1].removedInterfaces.empty());
+  BOOST_REQUIRE_EQUAL(changeSets[1].modifiedInterfaces.size(), 1);
+  const auto& diff = changeSets[1].modifiedInterfaces[0];
+  BOOST_CHECK_EQUAL(diff.interface->getIndex(), idx);
+  BOOST_CHECK(!diff.isStateChanged);
+  BOOST_CHECK(diff.isMtuChanged);
+  BOOST_CHECK(hasSingleIp(diff.addedAddresses, "192.0.2.2"));
+  BOOST_CHECK(hasSingleIp(diff.removedAddresses, "192.0.2.1"));
+
+  // state change
+  notify(makeLinkWithMtu(idx, UP | linux_if::FLAG_LOWER_UP, 9000));
+  advanceClocks(100_ms);
+  BOOST_REQUIRE_EQUAL(changeSets.size(), 3);
+  BOOST_REQUIRE_EQUAL(changeSets[2].modifiedInterfaces.size(), 1);
+  BOOST_CHECK(changeSets[2].modifiedInterfaces[0].isStateChanged);
+  BOOST_CHECK(!changeSets[2].modifiedInterfaces[0].isMtuChanged);
+  BOOST_CHECK_EQUAL(changeSets[2].modifiedInterfaces[0].interface->getState(),
+                    InterfaceState::RUNNING);
+
+  // flapping carrier and an address added then removed have no net effect
+  for (int i = 0; i < 5; ++i) {
+    notify(makeLinkWithMtu(idx, UP, 9000));
+    notify(makeLinkWithMtu(idx, UP | linux_if::FLAG_LOWER_UP, 9000));
+  }
+  notify(makeAddr4(RTM_NEWADDR, idx, "192.0.2.3"));
+  notify(makeAddr4(RTM_DELADDR, idx, "192.0.2.3"));
+  advanceClocks(100_ms);
+  BOOST_CHECK_EQUAL(changeSets.size(), 3);
+
+  // removal
+  notify(makeLink(RTM_DELLINK, idx, 0));
+  advanceClocks(100_ms);
+  BOOST_REQUIRE_EQUAL(changeSets.size(), 4);
+  BOOST_REQUIRE_EQUAL(changeSets[3].removedInterfaces.size(), 1);
+  BOOST_CHECK_EQUAL(changeSets[3].removedInterfaces[0]->getIndex(), idx);
+  BOOST_CHECK(changeSets[3].addedInterfaces.empty());
+  BOOST_CHECK(changeSets[3].modifiedInterfaces.empty());
+}
+
+BOOST_AUTO_TEST_CASE(TransientInterface)
+{
+  monitor.setCoalescingWindow(100_ms);
+
+  // an interface that is added and removed within the window is not reported
+  notify(makeLinkWithMtu(FIRST_INDEX + 1, UP, 1500));
+  notify(makeAddr4(RTM_NEWADDR, FIRST_INDEX + 1, "192.0.2.1"));
+  notify(makeLink(RTM_DELLINK, FIRST_INDEX + 1, 0));
+  advanceClocks(100_ms);
+  BOOST_CHECK_EQUAL(changeSets.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(FlushOnWindowDisabled)
+{
+  monitor.setCoalescingWindow(1_s);
+  notify(makeLinkWithMtu(FIRST_INDEX + 2, UP, 1500));
+  BOOST_CHECK_EQUAL(changeSets.size(), 0);
+
+  // disabling coalescing applies the pending notifications immediately
+  monitor.setCoalescingWindow(0_ns);
+  BOOST_REQUIRE_EQUAL(changeSets.size(), 1);
+  BOOST_REQUIRE_EQUAL(changeSets[0].addedInterfaces.size(), 1);
+  BOOST_CHECK_EQUAL(changeSets[0].addedInterfaces[0]->getIndex(), FIRST_INDEX + 2);
+
+  // without coalescing, notifications are applied individually without a change set
+  notify(makeLink(RTM_DELLINK, FIRST_INDEX + 2, 0));
+  BOOST_CHECK_EQUAL(changeSets.size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestNetworkMonitorImplNetlink
+BOOST_AUTO_TEST_SUITE_END() // Net
+
+} // namespace tests
+} // namespace net
+} // namespace ndn
+
+#endif // NDN_CXX_HAVE_NETLINK
@@ -175,6 +175,20 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateSuccessWithBundle, T, SuccessWithBundle
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(PrefetchBundles, CertificateBundleFetcherFixture<BundleWithFinalBlockId>)
+{
+  auto& fetcher = static_cast<CertificateBundleFetcher&>(this->validator.getFetcher());
+  optional<size_t> nRetrieved;
+  fetcher.prefetchBundles({this->data.getName()}, [&] (size_t n) { nRetrieved = n; });
+  this->mockNetworkOperations();
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 2); // both bundle segments
+  BOOST_CHECK_EQUAL(nRetrieved.value_or(0), 3);
+
+  this->face.sentInterests.clear();
+  VALIDATE_SUCCESS(this->data, "Should get accepted, as the bundle was prefetched");
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 0);
+}
+
 using SuccessWithoutBundle = boost::mpl::vector<Nack, Timeout>;
 
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateSuccessWithoutBundle, T, SuccessWithoutBundle,
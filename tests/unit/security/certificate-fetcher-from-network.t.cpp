@@ -130,6 +130,38 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateFailure, T, Failures, CertificateFetche
   BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 4);
 }
 
+BOOST_FIXTURE_TEST_CASE(Prefetch, CertificateFetcherFromNetworkFixture<Cert>)
+{
+  std::vector<Name> certNames{this->data.getKeyLocator()->getName(),
+                              this->subIdentity.getDefaultKey().getName()};
+  optional<size_t> nRetrieved;
+  this->validator.prefetchCertificates(certNames, [&] (size_t n) { nRetrieved = n; });
+  this->mockNetworkOperations();
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(nRetrieved.value_or(0), 2);
+
+  this->face.sentInterests.clear();
+  VALIDATE_SUCCESS(this->data, "Should get accepted, as certs were prefetched");
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 0);
+
+  // already known certificates are not retrieved again
+  nRetrieved = nullopt;
+  this->validator.prefetchCertificates(certNames, [&] (size_t n) { nRetrieved = n; });
+  BOOST_CHECK_EQUAL(nRetrieved.value_or(1), 0);
+  this->mockNetworkOperations();
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(PrefetchFailure, T, Failures, CertificateFetcherFromNetworkFixture<T>)
+{
+  optional<size_t> nRetrieved;
+  this->validator.prefetchCertificates({this->data.getKeyLocator()->getName()},
+                                       [&] (size_t n) { nRetrieved = n; });
+  this->mockNetworkOperations();
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 1); // no retries
+  BOOST_CHECK_EQUAL(nRetrieved.value_or(1), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCertificateFetcherFromNetwork
 BOOST_AUTO_TEST_SUITE_END() // Security
 
@@ -28,6 +28,10 @@
 #include "tests/identity-management-fixture.hpp"
 #include "tests/unit/test-home-env-saver.hpp"
 
+#include <boost/asio/io_service.hpp>
+
+#include <thread>
+
 namespace ndn {
 namespace security {
 inline namespace v2 {
@@ -454,6 +458,74 @@ BOOST_FIXTURE_TEST_CASE(GeneralSigningInterface, IdentityManagementFixture)
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(AsyncSign, IdentityManagementFixture)
+{
+  boost::asio::io_service io;
+  Identity id = addIdentity("/ndn/test/async");
+  m_keyChain.setSigningThreads(2, 16);
+
+  std::vector<shared_ptr<Data>> signedData;
+  for (int i = 0; i < 16; ++i) {
+    auto data = make_shared<Data>(Name("/ndn/test/async/data").appendNumber(i));
+    BOOST_CHECK(m_keyChain.asyncSign(data, signingByIdentity(id), io,
+                                     [&] (const shared_ptr<Data>& d) { signedData.push_back(d); },
+                                     [] (const std::string& reason) { BOOST_ERROR(reason); }));
+  }
+  BOOST_CHECK(signedData.empty()); // callbacks are posted to io
+
+  io.run();
+  BOOST_REQUIRE_EQUAL(signedData.size(), 16);
+  for (const auto& data : signedData) {
+    BOOST_CHECK(verifySignature(*data, id.getDefaultKey()));
+    BOOST_CHECK_EQUAL(data->getKeyLocator()->getName(), id.getDefaultKey().getName());
+  }
+
+  BOOST_CHECK_THROW(m_keyChain.asyncSign(make_shared<Data>("/data"),
+                                         signingByIdentity("/non-existing/identity"), io,
+                                         nullptr, nullptr),
+                    KeyChain::InvalidSigningInfoError);
+
+  // private key is missing from the TPM
+  const_cast<Tpm&>(m_keyChain.getTpm()).deleteKey(id.getDefaultKey().getName());
+  bool hasFailed = false;
+  BOOST_CHECK(m_keyChain.asyncSign(make_shared<Data>("/data"), signingByIdentity(id), io,
+                                   [] (const shared_ptr<Data>&) { BOOST_ERROR("unexpected success"); },
+                                   [&] (const std::string&) { hasFailed = true; }));
+  io.reset();
+  io.run();
+  BOOST_CHECK(hasFailed);
+}
+
+BOOST_FIXTURE_TEST_CASE(AsyncSignQueueFull, IdentityManagementFixture)
+{
+  boost::asio::io_service io;
+  Identity id = addIdentity("/ndn/test/async");
+  m_keyChain.setSigningThreads(1, 1);
+
+  // a failed key selection must release its slot in the pool
+  for (int i = 0; i < 3; ++i) {
+    BOOST_CHECK_THROW(m_keyChain.asyncSign(make_shared<Data>("/data"),
+                                           signingByIdentity("/non-existing/identity"), io,
+                                           nullptr, nullptr),
+                      KeyChain::InvalidSigningInfoError);
+  }
+
+  int nSigned = 0;
+  BOOST_CHECK(m_keyChain.asyncSign(make_shared<Data>("/data/1"), signingByIdentity(id), io,
+                                   [&] (const shared_ptr<Data>&) { ++nSigned; }, nullptr));
+
+  // the slot is taken until the first packet has been signed; a refused packet is unchanged
+  auto refused = make_shared<Data>("/data/2");
+  while (!m_keyChain.asyncSign(refused, signingByIdentity(id), io,
+                               [&] (const shared_ptr<Data>&) { ++nSigned; }, nullptr)) {
+    BOOST_CHECK(!refused->getSignatureInfo());
+    std::this_thread::yield();
+  }
+
+  io.run();
+  BOOST_CHECK_EQUAL(nSigned, 2);
+}
+
 BOOST_FIXTURE_TEST_CASE(PublicKeySigningDefaults, IdentityManagementFixture)
 {
   Data data("/test/data");
@@ -522,6 +594,101 @@ BOOST_FIXTURE_TEST_CASE(ExportImport, IdentityManagementFixture)
   BOOST_CHECK_EQUAL(m_keyChain.getTpm().hasKey(cert.getKeyName()), false);
 }
 
+BOOST_FIXTURE_TEST_CASE(ExportImportMany, IdentityManagementFixture)
+{
+  Name idName("/TestKeyChain/ExportMany");
+  Identity id = addIdentity(idName);
+  m_keyChain.createKey(id);
+  m_keyChain.createKey(id);
+  std::vector<Certificate> certs;
+  for (const auto& key : id.getKeys()) {
+    certs.push_back(key.getDefaultCertificate());
+  }
+  BOOST_REQUIRE_EQUAL(certs.size(), 3);
+
+  auto exported = m_keyChain.exportSafeBags(certs, "1234", 4, 2);
+  BOOST_REQUIRE_EQUAL(exported.size(), 3);
+  std::vector<SafeBag> safeBags;
+  for (size_t i = 0; i < exported.size(); ++i) {
+    BOOST_CHECK_EQUAL(Certificate(exported[i]->getCertificate()).getName(), certs[i].getName());
+    safeBags.push_back(*exported[i]);
+  }
+
+  m_keyChain.deleteIdentity(id);
+  BOOST_CHECK_EQUAL(m_keyChain.getPib().getIdentities().size(), 0);
+  BOOST_CHECK_THROW(m_keyChain.exportSafeBags(certs, "1234", 4, 2), KeyChain::Error);
+
+  // a wrong password is detected before anything is imported
+  BOOST_CHECK_THROW(m_keyChain.importSafeBags(safeBags, "4321", 4, 2), KeyChain::Error);
+  BOOST_CHECK_EQUAL(m_keyChain.getPib().getIdentities().size(), 0);
+
+  m_keyChain.importSafeBags(safeBags, "1234", 4, 2);
+  Identity newId = m_keyChain.getPib().getIdentity(idName);
+  BOOST_CHECK_EQUAL(newId.getKeys().size(), 3);
+  for (const auto& cert : certs) {
+    BOOST_CHECK_EQUAL(m_keyChain.getTpm().hasKey(cert.getKeyName()), true);
+    BOOST_CHECK_NO_THROW(newId.getKey(cert.getKeyName()).getCertificate(cert.getName()));
+  }
+  BOOST_CHECK_THROW(m_keyChain.importSafeBags(safeBags, "1234", 4, 2), KeyChain::Error);
+}
+
+static void
+checkImportManyRollback(KeyChain& keyChain)
+{
+  Identity existingId = keyChain.createIdentity("/TestKeyChain/ImportRollback/Existing");
+  Key existingKey = existingId.getDefaultKey();
+  Key extraKey = keyChain.createKey(existingId);
+  Identity newId = keyChain.createIdentity("/TestKeyChain/ImportRollback/New");
+  Name newIdName = newId.getName();
+  Name newKeyName = newId.getDefaultKey().getName();
+  Name extraKeyName = extraKey.getName();
+
+  std::vector<SafeBag> safeBags;
+  safeBags.push_back(*keyChain.exportSafeBag(newId.getDefaultKey().getDefaultCertificate(), "1234", 4));
+  safeBags.push_back(*keyChain.exportSafeBag(extraKey.getDefaultCertificate(), "1234", 4));
+  // this key is not deleted, so its SafeBag fails after the preceding ones have been imported
+  safeBags.push_back(*keyChain.exportSafeBag(existingKey.getDefaultCertificate(), "1234", 4));
+  keyChain.deleteIdentity(newId);
+  keyChain.deleteKey(existingId, extraKey);
+
+  BOOST_CHECK_THROW(keyChain.importSafeBags(safeBags, "1234", 4, 2), KeyChain::Error);
+  BOOST_CHECK_EQUAL(keyChain.getTpm().hasKey(newKeyName), false);
+  BOOST_CHECK_EQUAL(keyChain.getTpm().hasKey(extraKeyName), false);
+  BOOST_CHECK_EQUAL(keyChain.getTpm().hasKey(existingKey.getName()), true);
+  BOOST_CHECK_EQUAL(keyChain.getPib().getIdentities().size(), 1);
+  BOOST_CHECK_THROW(keyChain.getPib().getIdentity(newIdName), Pib::Error);
+  BOOST_CHECK_EQUAL(keyChain.getPib().getDefaultIdentity().getName(), existingId.getName());
+  // handles obtained before the import remain valid and up to date
+  BOOST_CHECK_EQUAL(existingId.getKeys().size(), 1);
+  BOOST_CHECK_THROW(existingId.getKey(extraKeyName), Pib::Error);
+  BOOST_CHECK_NO_THROW(existingId.getKey(existingKey.getName()));
+  BOOST_CHECK_EQUAL(existingKey.getCertificates().size(), 1);
+
+  safeBags.pop_back();
+  keyChain.importSafeBags(safeBags, "1234", 4, 2);
+  BOOST_CHECK_EQUAL(keyChain.getPib().getIdentities().size(), 2);
+  BOOST_CHECK_EQUAL(existingId.getKeys().size(), 2);
+  BOOST_CHECK_EQUAL(keyChain.getPib().getIdentity(newIdName).getDefaultKey().getName(), newKeyName);
+  BOOST_CHECK_EQUAL(keyChain.getTpm().hasKey(newKeyName), true);
+  BOOST_CHECK_EQUAL(keyChain.getTpm().hasKey(extraKeyName), true);
+}
+
+BOOST_FIXTURE_TEST_CASE(ImportManyRollback, IdentityManagementFixture)
+{
+  checkImportManyRollback(m_keyChain);
+}
+
+struct PibPathImportRollbackHome
+{
+  const std::string PATH = "build/import-rollback-home/";
+};
+
+BOOST_FIXTURE_TEST_CASE(ImportManyRollbackSqlite3, TestHomeAndPibFixture<PibPathImportRollbackHome>)
+{
+  KeyChain keyChain("pib-sqlite3:" + m_pibDir, "tpm-memory:");
+  checkImportManyRollback(keyChain);
+}
+
 BOOST_FIXTURE_TEST_CASE(SelfSignedCertValidity, IdentityManagementFixture)
 {
   Certificate cert = addIdentity("/Security/TestKeyChain/SelfSignedCertValidity")
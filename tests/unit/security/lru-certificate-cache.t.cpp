@@ -0,0 +1,163 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/lru-certificate-cache.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/unit/identity-management-time-fixture.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Security)
+
+class LruCertificateCacheFixture : public ndn::tests::IdentityManagementTimeFixture
+{
+public:
+  LruCertificateCacheFixture()
+    : certCache(io, 2, 10_s, 1_s)
+  {
+    for (int i = 0; i < 3; ++i) {
+      Identity identity = addIdentity("/TestLruCertificateCache/" + to_string(i));
+      certs.push_back(identity.getDefaultKey().getDefaultCertificate());
+    }
+  }
+
+public:
+  LruCertificateCache certCache;
+  std::vector<Certificate> certs;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestLruCertificateCache, LruCertificateCacheFixture)
+
+BOOST_AUTO_TEST_CASE(Errors)
+{
+  BOOST_CHECK_THROW(LruCertificateCache(io, 0), std::invalid_argument);
+  BOOST_CHECK_THROW(LruCertificateCache(io, 1, 1_h, 0_s), std::invalid_argument);
+  BOOST_CHECK_THROW(certCache.setLimit(0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(RemovalTime)
+{
+  const auto& cert = certs[0];
+
+  certCache.insert(cert);
+  BOOST_CHECK(certCache.find(cert.getName()) != nullptr);
+
+  // expired certificates are not returned even before they are swept
+  systemClock->advance(11_s);
+  BOOST_CHECK(certCache.find(cert.getName()) == nullptr);
+  BOOST_CHECK_EQUAL(certCache.size(), 1);
+  certCache.sweep();
+  BOOST_CHECK_EQUAL(certCache.size(), 0);
+
+  certCache.insert(cert);
+  advanceClocks(5_s);
+  BOOST_CHECK(certCache.find(cert.getName()) != nullptr);
+
+  // periodic sweep removes the certificate
+  advanceClocks(1_s, 10);
+  BOOST_CHECK_EQUAL(certCache.size(), 0);
+  BOOST_CHECK(certCache.find(cert.getName()) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Find)
+{
+  const auto& cert = certs[0];
+  certCache.insert(cert);
+
+  BOOST_CHECK(certCache.find(cert.getKeyName()) != nullptr);
+  BOOST_CHECK(certCache.find(cert.getIdentity()) != nullptr);
+  BOOST_CHECK(certCache.find(certs[1].getKeyName()) == nullptr);
+
+  BOOST_CHECK(certCache.find(Interest(cert.getIdentity())) != nullptr);
+  BOOST_CHECK(certCache.find(Interest(cert.getKeyName())) != nullptr);
+  BOOST_CHECK(certCache.find(Interest(Name(cert.getName()).appendVersion())) == nullptr);
+
+  BOOST_CHECK_EQUAL(certCache.getNHits(), 4);
+  BOOST_CHECK_EQUAL(certCache.getNMisses(), 2);
+  certCache.resetCounters();
+  BOOST_CHECK_EQUAL(certCache.getNHits(), 0);
+  BOOST_CHECK_EQUAL(certCache.getNMisses(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Peek)
+{
+  certCache.insert(certs[0]);
+  certCache.insert(certs[1]);
+
+  BOOST_CHECK(certCache.peek(certs[0].getKeyName()) != nullptr);
+  BOOST_CHECK(certCache.peek(certs[0].getIdentity()) != nullptr);
+  BOOST_CHECK(certCache.peek(Interest(certs[0].getKeyName())) != nullptr);
+  BOOST_CHECK(certCache.peek(certs[2].getKeyName()) == nullptr);
+  BOOST_CHECK(certCache.peek(Interest(Name(certs[0].getName()).appendVersion())) == nullptr);
+  BOOST_CHECK_EQUAL(certCache.getNHits(), 0);
+  BOOST_CHECK_EQUAL(certCache.getNMisses(), 0);
+
+  // peeking at certs[0] does not protect it from eviction
+  certCache.insert(certs[2]);
+  BOOST_CHECK(certCache.peek(certs[0].getKeyName()) == nullptr);
+  BOOST_CHECK(certCache.peek(certs[1].getKeyName()) != nullptr);
+
+  // expired certificates are not returned even before they are swept
+  systemClock->advance(11_s);
+  BOOST_CHECK(certCache.peek(certs[1].getKeyName()) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Eviction)
+{
+  certCache.insert(certs[0]);
+  certCache.insert(certs[1]);
+  BOOST_CHECK_EQUAL(certCache.size(), 2);
+
+  // use certs[0], so that certs[1] becomes the least recently used
+  BOOST_CHECK(certCache.find(certs[0].getKeyName()) != nullptr);
+
+  certCache.insert(certs[2]);
+  BOOST_CHECK_EQUAL(certCache.size(), 2);
+  BOOST_CHECK_EQUAL(certCache.getNEvictions(), 1);
+  BOOST_CHECK(certCache.find(certs[0].getKeyName()) != nullptr);
+  BOOST_CHECK(certCache.find(certs[1].getKeyName()) == nullptr);
+  BOOST_CHECK(certCache.find(certs[2].getKeyName()) != nullptr);
+
+  // re-inserting an existing certificate does not evict anything
+  certCache.insert(certs[0]);
+  BOOST_CHECK_EQUAL(certCache.size(), 2);
+  BOOST_CHECK_EQUAL(certCache.getNEvictions(), 1);
+
+  certCache.setLimit(1);
+  BOOST_CHECK_EQUAL(certCache.size(), 1);
+  BOOST_CHECK_EQUAL(certCache.getNEvictions(), 2);
+  BOOST_CHECK(certCache.find(certs[0].getKeyName()) != nullptr);
+
+  certCache.clear();
+  BOOST_CHECK_EQUAL(certCache.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLruCertificateCache
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace tests
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
@@ -157,6 +157,24 @@ BOOST_AUTO_TEST_CASE(Iterator)
   BOOST_CHECK(container.end() == CertificateContainer::const_iterator());
 }
 
+BOOST_AUTO_TEST_CASE(Prefetch)
+{
+  auto pibImpl = make_shared<PibMemory>();
+  pibImpl->addCertificate(id1Key1Cert1);
+  pibImpl->addCertificate(id1Key1Cert2);
+  pibImpl->addCertificate(id1Key2Cert1);
+
+  CertificateContainer container(id1Key1Name, pibImpl);
+  BOOST_CHECK_EQUAL(container.size(), 2);
+  BOOST_CHECK_EQUAL(container.getCache().size(), 0);
+
+  container.prefetch();
+  BOOST_CHECK_EQUAL(container.getCache().size(), 2);
+  BOOST_CHECK_EQUAL(container.get(id1Key1Cert1.getName()), id1Key1Cert1);
+  BOOST_CHECK_EQUAL(container.get(id1Key1Cert2.getName()), id1Key1Cert2);
+  BOOST_CHECK(container.isConsistent());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCertificateContainer
 BOOST_AUTO_TEST_SUITE_END() // Pib
 BOOST_AUTO_TEST_SUITE_END() // Security
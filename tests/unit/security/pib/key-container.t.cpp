@@ -164,6 +164,29 @@ BOOST_AUTO_TEST_CASE(Iterator)
   BOOST_CHECK(container.end() == KeyContainer::const_iterator());
 }
 
+BOOST_AUTO_TEST_CASE(Prefetch)
+{
+  auto pibImpl = make_shared<PibMemory>();
+  pibImpl->addKey(id1, id1Key1Name, id1Key1.data(), id1Key1.size());
+  pibImpl->addKey(id1, id1Key2Name, id1Key2.data(), id1Key2.size());
+  pibImpl->addKey(id2, id2Key1Name, id2Key1.data(), id2Key1.size());
+
+  KeyContainer container(id1, pibImpl);
+  BOOST_CHECK_EQUAL(container.size(), 2);
+  BOOST_CHECK_EQUAL(container.getLoadedKeys().size(), 0);
+
+  container.prefetch();
+  BOOST_CHECK_EQUAL(container.getLoadedKeys().size(), 2);
+  BOOST_CHECK(container.get(id1Key1Name).getPublicKey() == id1Key1);
+  BOOST_CHECK(container.get(id1Key2Name).getPublicKey() == id1Key2);
+
+  // already loaded keys are kept
+  auto key1 = container.getLoadedKeys().at(id1Key1Name);
+  container.prefetch();
+  BOOST_CHECK_EQUAL(container.getLoadedKeys().at(id1Key1Name), key1);
+  BOOST_CHECK(container.isConsistent());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestKeyContainer
 BOOST_AUTO_TEST_SUITE_END() // Pib
 BOOST_AUTO_TEST_SUITE_END() // Security
@@ -267,6 +267,34 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(CertificateManagement, T, PibImpls, T)
   BOOST_CHECK_EQUAL(certNames.size(), 0);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(BulkRetrieval, T, PibImpls, T)
+{
+  BOOST_CHECK(this->pib.getKeyBitsOfIdentity(this->id1).empty());
+  BOOST_CHECK(this->pib.getCertificatesDataOfKey(this->id1Key1Name).empty());
+
+  this->pib.addCertificate(this->id1Key1Cert1);
+  this->pib.addCertificate(this->id1Key1Cert2);
+  this->pib.addCertificate(this->id1Key2Cert1);
+  this->pib.addCertificate(this->id2Key1Cert1);
+
+  auto keys = this->pib.getKeyBitsOfIdentity(this->id1);
+  BOOST_REQUIRE_EQUAL(keys.size(), 2);
+  BOOST_CHECK(keys.at(this->id1Key1Name) == this->id1Key1);
+  BOOST_CHECK(keys.at(this->id1Key2Name) == this->id1Key2);
+
+  auto certs = this->pib.getCertificatesDataOfKey(this->id1Key1Name);
+  BOOST_REQUIRE_EQUAL(certs.size(), 2);
+  std::set<Name> certNames;
+  for (const auto& cert : certs) {
+    certNames.insert(cert.getName());
+    BOOST_CHECK_EQUAL(cert, this->pib.getCertificate(cert.getName()));
+  }
+  BOOST_CHECK(certNames == this->pib.getCertificatesOfKey(this->id1Key1Name));
+
+  BOOST_CHECK_EQUAL(this->pib.getCertificatesDataOfKey(this->id1Key2Name).size(), 1);
+  BOOST_CHECK(this->pib.getCertificatesDataOfKey(Name("/non-existing/KEY/1")).empty());
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(DefaultsManagement, T, PibImpls, T)
 {
   this->pib.addIdentity(this->id1);
@@ -346,6 +374,109 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Overwrite, T, PibImpls, T)
   BOOST_CHECK(keyBits3 == this->id1Key2);
 }
 
+BOOST_FIXTURE_TEST_CASE(Sqlite3Transaction, PibSqlite3Fixture)
+{
+  pib.beginTransaction();
+  pib.addCertificate(id1Key1Cert1);
+  BOOST_CHECK(pib.hasCertificate(id1Key1Cert1.getName()));
+  pib.rollbackTransaction();
+  BOOST_CHECK(!pib.hasIdentity(id1));
+  BOOST_CHECK(!pib.hasCertificate(id1Key1Cert1.getName()));
+
+  pib.beginTransaction();
+  pib.addCertificate(id1Key1Cert1);
+  pib.beginTransaction(); // nested
+  pib.addCertificate(id1Key2Cert1);
+  pib.commitTransaction();
+  pib.commitTransaction();
+  BOOST_CHECK(pib.hasCertificate(id1Key1Cert1.getName()));
+  BOOST_CHECK(pib.hasCertificate(id1Key2Cert1.getName()));
+  BOOST_CHECK_EQUAL(pib.getDefaultKeyOfIdentity(id1), id1Key1Name);
+}
+
+BOOST_FIXTURE_TEST_CASE(Sqlite3NestedRollback, PibSqlite3Fixture)
+{
+  pib.beginTransaction();
+  pib.addCertificate(id1Key1Cert1);
+  pib.beginTransaction(); // nested
+  pib.addCertificate(id1Key2Cert1);
+  pib.rollbackTransaction();
+  BOOST_CHECK(!pib.hasIdentity(id1));
+
+  // the outer transaction can neither be modified nor committed
+  BOOST_CHECK_THROW(pib.addCertificate(id2Key1Cert1), PibImpl::Error);
+  BOOST_CHECK_THROW(pib.commitTransaction(), PibImpl::Error);
+  BOOST_CHECK(!pib.hasIdentity(id1));
+  BOOST_CHECK(!pib.hasIdentity(id2));
+
+  // a new transaction works normally
+  pib.beginTransaction();
+  pib.addCertificate(id2Key1Cert1);
+  pib.commitTransaction();
+  BOOST_CHECK(pib.hasCertificate(id2Key1Cert1.getName()));
+
+  // nested rollbacks end one level each
+  pib.beginTransaction();
+  pib.beginTransaction();
+  pib.addCertificate(id1Key1Cert1);
+  pib.rollbackTransaction();
+  pib.rollbackTransaction();
+  BOOST_CHECK(!pib.hasIdentity(id1));
+  pib.addCertificate(id1Key1Cert1);
+  BOOST_CHECK(pib.hasIdentity(id1));
+}
+
+BOOST_FIXTURE_TEST_CASE(Sqlite3WalAndReadOnly, PibSqlite3Fixture)
+{
+  PibSqlite3::Options walOptions;
+  walOptions.useWal = true;
+  walOptions.busyTimeout = 100_ms;
+  PibSqlite3 walPib(tmpPath.string(), walOptions);
+  walPib.setTpmLocator("tpmLocator");
+  walPib.addCertificate(id1Key1Cert1);
+
+  PibSqlite3::Options readOnlyOptions;
+  readOnlyOptions.isReadOnly = true;
+  PibSqlite3 readOnlyPib(tmpPath.string(), readOnlyOptions);
+  BOOST_CHECK_EQUAL(readOnlyPib.getTpmLocator(), "tpmLocator");
+  BOOST_CHECK_EQUAL(readOnlyPib.getDefaultIdentity(), id1);
+  BOOST_CHECK_EQUAL(readOnlyPib.getDefaultCertificateOfKey(id1Key1Name).wireEncode(),
+                    id1Key1Cert1.wireEncode());
+
+  // modifications by the writer are visible to the reader
+  walPib.addCertificate(id2Key1Cert1);
+  BOOST_CHECK(readOnlyPib.hasCertificate(id2Key1Cert1.getName()));
+
+  BOOST_CHECK_THROW(readOnlyPib.setTpmLocator("other"), PibImpl::Error);
+  BOOST_CHECK_THROW(readOnlyPib.addIdentity(id2), PibImpl::Error);
+  BOOST_CHECK_THROW(readOnlyPib.addCertificate(id2Key2Cert1), PibImpl::Error);
+  BOOST_CHECK_THROW(readOnlyPib.removeIdentity(id1), PibImpl::Error);
+  BOOST_CHECK_THROW(readOnlyPib.beginTransaction(), PibImpl::Error);
+  BOOST_CHECK(readOnlyPib.hasIdentity(id1));
+
+  // read-only mode does not create a database
+  BOOST_CHECK_THROW(PibSqlite3((tmpPath / "nonexistent").string(), readOnlyOptions), PibImpl::Error);
+}
+
+BOOST_FIXTURE_TEST_CASE(Sqlite3LocatorOptions, PibSqlite3Fixture)
+{
+  PibSqlite3 walPib(tmpPath.string() + "?wal=1&busy-timeout=100");
+  walPib.addCertificate(id1Key1Cert1);
+  BOOST_CHECK(boost::filesystem::exists(tmpPath / "pib.db-wal"));
+
+  PibSqlite3 readOnlyPib(tmpPath.string() + "?read-only=1");
+  BOOST_CHECK_EQUAL(readOnlyPib.getDefaultIdentity(), id1);
+  BOOST_CHECK_THROW(readOnlyPib.addIdentity(id2), PibImpl::Error);
+
+  PibSqlite3 writablePib(tmpPath.string() + "?read-only=0");
+  BOOST_CHECK_NO_THROW(writablePib.addIdentity(id2));
+
+  BOOST_CHECK_THROW(PibSqlite3(tmpPath.string() + "?wal=yes"), PibImpl::Error);
+  BOOST_CHECK_THROW(PibSqlite3(tmpPath.string() + "?busy-timeout=-1"), PibImpl::Error);
+  BOOST_CHECK_THROW(PibSqlite3(tmpPath.string() + "?busy-timeout=99999999999999999999"), PibImpl::Error);
+  BOOST_CHECK_THROW(PibSqlite3(tmpPath.string() + "?compress=1"), PibImpl::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestPibImpl
 BOOST_AUTO_TEST_SUITE_END() // Pib
 BOOST_AUTO_TEST_SUITE_END() // Security
@@ -26,6 +26,11 @@
 #include "tests/unit/identity-management-time-fixture.hpp"
 
 #include <boost/filesystem.hpp>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+
+#include <sys/stat.h>
 
 namespace ndn {
 namespace security {
@@ -69,6 +74,30 @@ public:
     boost::filesystem::remove_all(UNIT_TEST_CONFIG_PATH);
   }
 
+  /**
+   * Invoke @p write until the status change time of @p path differs from its value before the
+   * first invocation, as file systems with coarse timestamps may not record a quick rewrite.
+   */
+  template<typename WriteFn>
+  static void
+  rewrite(const boost::filesystem::path& path, const WriteFn& write)
+  {
+    auto getCtime = [&path] {
+      struct stat st;
+      BOOST_REQUIRE_EQUAL(::stat(path.c_str(), &st), 0);
+#ifdef __APPLE__
+      return std::make_pair(st.st_ctimespec.tv_sec, st.st_ctimespec.tv_nsec);
+#else
+      return std::make_pair(st.st_ctim.tv_sec, st.st_ctim.tv_nsec);
+#endif // __APPLE__
+    };
+
+    auto oldCtime = getCtime();
+    do {
+      write();
+    } while (getCtime() == oldCtime);
+  }
+
 public:
   TrustAnchorContainer anchorContainer;
 
@@ -155,6 +184,111 @@ BOOST_AUTO_TEST_CASE(DynamicAnchorFromDir)
   BOOST_CHECK_EQUAL(anchorContainer.getGroup("group").size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(DynamicAnchorIncrementalReload)
+{
+  namespace fs = boost::filesystem;
+  fs::last_write_time(certPath1, std::time(nullptr) - 3600);
+  fs::last_write_time(certPath2, std::time(nullptr) - 3600);
+  // file system timestamps are trusted only if they are older than the current time
+  systemClock->setNow(time::seconds(std::time(nullptr) + 60));
+
+  anchorContainer.insert("group", certDirPath.string(), 1_s, true /* isDir */);
+  auto& group = dynamic_cast<DynamicTrustAnchorGroup&>(anchorContainer.getGroup("group"));
+  BOOST_CHECK_EQUAL(group.size(), 2);
+  BOOST_CHECK_EQUAL(group.m_nLoadedFiles, 2);
+
+  // unchanged files are not decoded again
+  advanceClocks(100_ms, 11);
+  group.refresh();
+  BOOST_CHECK_EQUAL(group.size(), 2);
+  BOOST_CHECK_EQUAL(group.m_nLoadedFiles, 2);
+
+  // only the file that was written again is decoded
+  rewrite(certPath2, [&] {
+    saveCertToFile(cert2, certPath2.string());
+    fs::last_write_time(certPath2, std::time(nullptr) - 3600);
+  });
+  advanceClocks(100_ms, 11);
+  group.refresh();
+  BOOST_CHECK_EQUAL(group.size(), 2);
+  BOOST_CHECK_EQUAL(group.m_nLoadedFiles, 3);
+
+  advanceClocks(100_ms, 11);
+  group.refresh();
+  BOOST_CHECK_EQUAL(group.m_nLoadedFiles, 3);
+
+  // a file changed too recently for its timestamps to be trusted is decoded on every refresh
+  systemClock->setNow(time::seconds(std::time(nullptr) - 60));
+  saveCertToFile(cert2, certPath2.string());
+  advanceClocks(100_ms, 11);
+  group.refresh();
+  BOOST_CHECK_EQUAL(group.m_nLoadedFiles, 4);
+  advanceClocks(100_ms, 11);
+  group.refresh();
+  BOOST_CHECK_EQUAL(group.m_nLoadedFiles, 5);
+  BOOST_CHECK_EQUAL(group.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(DynamicAnchorSameSizeRewrite)
+{
+  namespace fs = boost::filesystem;
+  fs::remove(certPath2);
+
+  Identity identity3 = addIdentity("/TestAnchorContainer/Third");
+  Certificate cert3 = identity3.getDefaultKey().getDefaultCertificate();
+
+  // pad both certificates to the same file size, the padding is ignored when decoding
+  std::ostringstream encoded1, encoded3;
+  io::save(cert1, encoded1);
+  io::save(cert3, encoded3);
+  size_t size = std::max(encoded1.str().size(), encoded3.str().size());
+  auto writePadded = [&] (const std::ostringstream& encoded) {
+    std::ofstream os(certPath1.string(), std::ios::binary | std::ios::trunc);
+    os << encoded.str() << std::string(size - encoded.str().size(), '\n');
+  };
+
+  writePadded(encoded1);
+  std::time_t mtime = std::time(nullptr) - 3600;
+  fs::last_write_time(certPath1, mtime);
+  systemClock->setNow(time::seconds(std::time(nullptr) + 60));
+
+  anchorContainer.insert("group", certDirPath.string(), 1_s, true /* isDir */);
+  auto& group = dynamic_cast<DynamicTrustAnchorGroup&>(anchorContainer.getGroup("group"));
+  BOOST_CHECK(anchorContainer.find(identity1.getName()) != nullptr);
+  BOOST_CHECK_EQUAL(group.size(), 1);
+  BOOST_CHECK_EQUAL(group.m_nLoadedFiles, 1);
+
+  advanceClocks(100_ms, 11);
+  group.refresh();
+  BOOST_CHECK_EQUAL(group.m_nLoadedFiles, 1);
+
+  // rewrite the file in place with another certificate of the same size and restore its mtime
+  rewrite(certPath1, [&] {
+    writePadded(encoded3);
+    fs::last_write_time(certPath1, mtime);
+  });
+  BOOST_REQUIRE_EQUAL(fs::file_size(certPath1), size);
+
+  advanceClocks(100_ms, 11);
+  group.refresh();
+  BOOST_CHECK_EQUAL(group.m_nLoadedFiles, 2);
+  BOOST_CHECK(anchorContainer.find(identity1.getName()) == nullptr);
+  BOOST_CHECK(anchorContainer.find(identity3.getName()) != nullptr);
+  BOOST_CHECK_EQUAL(group.size(), 1);
+
+  // replace the file with a renamed copy of another certificate
+  saveCertToFile(cert2, certPath2.string());
+  fs::last_write_time(certPath2, mtime);
+  fs::rename(certPath2, certPath1);
+
+  advanceClocks(100_ms, 11);
+  group.refresh();
+  BOOST_CHECK_EQUAL(group.m_nLoadedFiles, 3);
+  BOOST_CHECK(anchorContainer.find(identity3.getName()) == nullptr);
+  BOOST_CHECK(anchorContainer.find(identity2.getName()) != nullptr);
+  BOOST_CHECK_EQUAL(group.size(), 1);
+}
+
 BOOST_FIXTURE_TEST_CASE(FindByInterest, AnchorContainerTestFixture)
 {
   anchorContainer.insert("group1", certPath1.string(), 1_s);
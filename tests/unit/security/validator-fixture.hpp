@@ -172,6 +172,18 @@ private:
     // do nothing
   }
 
+  std::function<bool()>
+  makeOriginalPacketVerifier(const Certificate& trustedCert) const override
+  {
+    return [] { return true; };
+  }
+
+  void
+  finishOriginalPacket(bool isVerified) override
+  {
+    // do nothing
+  }
+
   void
   bypassValidation() override
   {
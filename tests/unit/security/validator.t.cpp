@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/security/validator.hpp"
+#include "ndn-cxx/security/certificate-fetcher-offline.hpp"
 #include "ndn-cxx/security/validation-policy-simple-hierarchy.hpp"
 
 #include "tests/boost-test.hpp"
@@ -194,6 +195,145 @@ BOOST_AUTO_TEST_CASE(UntrustedCertCaching)
   face.sentInterests.clear();
 }
 
+BOOST_AUTO_TEST_CASE(LruTrustedCertCaching)
+{
+  validator.useLruCertCaches(io, 10, 10);
+  BOOST_REQUIRE(validator.getLruVerifiedCertCache() != nullptr);
+  const auto& lruCache = *validator.getLruVerifiedCertCache();
+
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+
+  VALIDATE_SUCCESS(data, "Should get accepted, as signed by the policy-compliant cert");
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(lruCache.size(), 1);
+  BOOST_CHECK_EQUAL(validator.getVerifiedCertCache().find(subIdentity.getName()), nullptr);
+  face.sentInterests.clear();
+
+  processInterest = nullptr; // disable data responses from mocked network
+
+  uint64_t nHits = lruCache.getNHits();
+  VALIDATE_SUCCESS(data, "Should get accepted, based on the cached trusted cert");
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 0);
+  BOOST_CHECK_EQUAL(lruCache.getNHits(), nHits + 1);
+  face.sentInterests.clear();
+
+  advanceClocks(1_h, 2); // expire trusted cache
+  BOOST_CHECK_EQUAL(lruCache.size(), 0);
+
+  VALIDATE_FAILURE(data, "Should try and fail to retrieve certs");
+  BOOST_CHECK_GT(face.sentInterests.size(), 1);
+  face.sentInterests.clear();
+}
+
+BOOST_AUTO_TEST_CASE(LruUntrustedCertCaching)
+{
+  validator.useLruCertCaches(io, 10, 10);
+  BOOST_REQUIRE(validator.getLruUnverifiedCertCache() != nullptr);
+  const auto& lruCache = *validator.getLruUnverifiedCertCache();
+
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subSelfSignedIdentity));
+
+  VALIDATE_FAILURE(data, "Should fail, as signed by the policy-violating cert");
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(lruCache.size(), 1);
+  face.sentInterests.clear();
+
+  processInterest = nullptr; // disable data responses from mocked network
+
+  VALIDATE_FAILURE(data, "Should fail again, but no network operations expected");
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 0);
+  face.sentInterests.clear();
+
+  advanceClocks(10_min, 2); // expire untrusted cache
+  BOOST_CHECK_EQUAL(lruCache.size(), 0);
+
+  VALIDATE_FAILURE(data, "Should try and fail to retrieve certs");
+  BOOST_CHECK_GT(face.sentInterests.size(), 1);
+  face.sentInterests.clear();
+}
+
+BOOST_AUTO_TEST_CASE(LruCertCacheLimit)
+{
+  validator.useLruCertCaches(io, 1, 10);
+  const auto& lruCache = *validator.getLruVerifiedCertCache();
+
+  auto sub3Identity = addSubCertificate("/Security/ValidatorFixture/Sub3", identity);
+  cache.insert(sub3Identity.getDefaultKey().getDefaultCertificate());
+
+  Data data1("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data1, signingByIdentity(subIdentity));
+  Data data3("/Security/ValidatorFixture/Sub3/Data");
+  m_keyChain.sign(data3, signingByIdentity(sub3Identity));
+
+  VALIDATE_SUCCESS(data1, "Should get accepted, as signed by the policy-compliant cert");
+  VALIDATE_SUCCESS(data3, "Should get accepted, as signed by the policy-compliant cert");
+  BOOST_CHECK_EQUAL(lruCache.size(), 1);
+  BOOST_CHECK_EQUAL(lruCache.getNEvictions(), 1);
+  face.sentInterests.clear();
+
+  // the evicted cert is still known as unverified and gets verified again
+  VALIDATE_SUCCESS(data1, "Should get accepted after re-verifying the evicted cert");
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 0);
+  BOOST_CHECK_EQUAL(lruCache.size(), 1);
+  BOOST_CHECK_EQUAL(lruCache.getNEvictions(), 2);
+
+  validator.resetVerifiedCertificates();
+  BOOST_CHECK_EQUAL(lruCache.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(LruCertCacheProbes)
+{
+  validator.useLruCertCaches(io, 1, 10);
+  const auto& lruCache = *validator.getLruVerifiedCertCache();
+  const auto& lruUnverifiedCache = *validator.getLruUnverifiedCertCache();
+
+  auto sub3Identity = addSubCertificate("/Security/ValidatorFixture/Sub3", identity);
+  cache.insert(sub3Identity.getDefaultKey().getDefaultCertificate());
+
+  Data data1("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data1, signingByIdentity(subIdentity));
+  VALIDATE_SUCCESS(data1, "Should get accepted, as signed by the policy-compliant cert");
+  BOOST_CHECK_EQUAL(lruCache.size(), 1);
+
+  // probes do not count as hits or misses
+  uint64_t nHits = lruCache.getNHits();
+  uint64_t nMisses = lruCache.getNMisses();
+  uint64_t nUnverifiedMisses = lruUnverifiedCache.getNMisses();
+  const Name& keyName = subIdentity.getDefaultKey().getName();
+  BOOST_CHECK(validator.isCertKnown(keyName));
+  BOOST_CHECK(!validator.isCertKnown("/Security/ValidatorFixture/Unknown/KEY"));
+  BOOST_CHECK(validator.findTrustedCert(Interest(keyName)) != nullptr);
+
+  size_t nRetrieved = 0;
+  processInterest = nullptr; // disable data responses from mocked network
+  validator.prefetchCertificates({keyName}, [&] (size_t n) { nRetrieved = n; });
+  advanceClocks(200_ms, 60);
+  BOOST_CHECK_EQUAL(nRetrieved, 0);
+  BOOST_CHECK_EQUAL(lruCache.getNHits(), nHits);
+  BOOST_CHECK_EQUAL(lruCache.getNMisses(), nMisses);
+  BOOST_CHECK_EQUAL(lruUnverifiedCache.getNMisses(), nUnverifiedMisses);
+}
+
+BOOST_AUTO_TEST_CASE(CustomCertLifetimes)
+{
+  Validator customValidator(make_unique<ValidationPolicySimpleHierarchy>(),
+                            make_unique<CertificateFetcherOffline>(), 10_s, 1_s);
+  auto cert = subIdentity.getDefaultKey().getDefaultCertificate();
+
+  customValidator.cacheVerifiedCertificate(Certificate(cert));
+  BOOST_CHECK(customValidator.isCertKnown(cert.getKeyName()));
+  advanceClocks(1_s, 11);
+  BOOST_CHECK(!customValidator.isCertKnown(cert.getKeyName()));
+
+  customValidator.useLruCertCaches(io, 10, 10);
+  customValidator.cacheVerifiedCertificate(Certificate(cert));
+  BOOST_CHECK(customValidator.isCertKnown(cert.getKeyName()));
+  advanceClocks(1_s, 11);
+  BOOST_CHECK(!customValidator.isCertKnown(cert.getKeyName()));
+}
+
 class ValidationPolicySimpleHierarchyForInterestOnly : public ValidationPolicySimpleHierarchy
 {
 public:
@@ -258,6 +398,43 @@ BOOST_FIXTURE_TEST_CASE(ValidateInterestsButBypassForData,
   face.sentInterests.clear();
 }
 
+BOOST_AUTO_TEST_CASE(VerificationExecutor)
+{
+  std::vector<std::pair<std::function<bool()>, std::function<void(bool)>>> jobs;
+  validator.setVerificationExecutor([&jobs] (std::function<bool()> verify, std::function<void(bool)> done) {
+    jobs.emplace_back(std::move(verify), std::move(done));
+  });
+
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+  Data badData(data);
+  const uint8_t content[] = {0x01};
+  badData.setContent(content, sizeof(content));
+
+  size_t nSuccesses = 0;
+  size_t nFailures = 0;
+  for (const auto& packet : {data, badData}) {
+    validator.validate(packet,
+                       [&] (const Data&) { ++nSuccesses; },
+                       [&] (const Data&, const ValidationError&) { ++nFailures; });
+  }
+  mockNetworkOperations();
+  BOOST_REQUIRE_EQUAL(jobs.size(), 2);
+  BOOST_CHECK_EQUAL(nSuccesses + nFailures, 0);
+
+  // the jobs do not depend on the validation state and may run in any order
+  bool isBadVerified = jobs[1].first();
+  bool isVerified = jobs[0].first();
+  jobs[1].second(isBadVerified);
+  BOOST_CHECK_EQUAL(nFailures, 1);
+  jobs[0].second(isVerified);
+  BOOST_CHECK_EQUAL(nSuccesses, 1);
+
+  validator.setVerificationExecutor(nullptr);
+  VALIDATE_SUCCESS(data, "Should verify synchronously");
+  BOOST_CHECK_EQUAL(jobs.size(), 2);
+}
+
 BOOST_AUTO_TEST_CASE(InfiniteCertChain)
 {
   processInterest = [this] (const Interest& interest) {
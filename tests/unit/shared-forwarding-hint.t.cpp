@@ -0,0 +1,62 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/shared-forwarding-hint.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestSharedForwardingHint)
+
+BOOST_AUTO_TEST_CASE(CreateFromDelegations)
+{
+  auto fh = SharedForwardingHint::create(DelegationList({{20, "/B"}, {10, "/A"}}));
+  BOOST_CHECK(fh->getDelegations().isSorted());
+  BOOST_CHECK_EQUAL(fh->getDelegations(), DelegationList({{10, "/A"}, {20, "/B"}}));
+  BOOST_CHECK_EQUAL(fh->wireEncode(),
+                    "1E14 1F081E010A0703080141 1F081E01140703080142"_block);
+
+  BOOST_CHECK_THROW(SharedForwardingHint::create(DelegationList()), DelegationList::Error);
+}
+
+BOOST_AUTO_TEST_CASE(CreateFromWire)
+{
+  Block sorted = "1E14 1F081E010A0703080141 1F081E01140703080142"_block;
+  auto fh1 = SharedForwardingHint::create(sorted);
+  BOOST_CHECK_EQUAL(fh1->getDelegations(), DelegationList({{10, "/A"}, {20, "/B"}}));
+  BOOST_CHECK_EQUAL(fh1->wireEncode().getBuffer(), sorted.getBuffer()); // kept, not re-encoded
+
+  Block unsorted = "1E14 1F081E01140703080142 1F081E010A0703080141"_block;
+  auto fh2 = SharedForwardingHint::create(unsorted);
+  BOOST_CHECK(fh2->getDelegations().isSorted());
+  BOOST_CHECK_EQUAL(fh2->getDelegations(), DelegationList({{10, "/A"}, {20, "/B"}}));
+  BOOST_CHECK_EQUAL(fh2->wireEncode(), sorted);
+
+  BOOST_CHECK_THROW(SharedForwardingHint::create("1E00"_block), DelegationList::Error);
+  BOOST_CHECK_THROW(SharedForwardingHint::create("1E02 1F00"_block), DelegationList::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSharedForwardingHint
+
+} // namespace tests
+} // namespace ndn
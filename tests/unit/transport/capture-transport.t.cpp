@@ -0,0 +1,81 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/transport/capture-transport.hpp"
+#include "ndn-cxx/face.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/make-interest-data.hpp"
+#include "tests/unit/identity-management-time-fixture.hpp"
+
+#include <sstream>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Transport)
+BOOST_FIXTURE_TEST_SUITE(TestCaptureTransport, IdentityManagementTimeFixture)
+
+BOOST_AUTO_TEST_CASE(CaptureReplay)
+{
+  auto t0 = time::system_clock::now();
+  auto replay = make_shared<ReplayTransport>(std::vector<util::TraceRecord>{
+    {t0, util::TraceDirection::INCOMING, makeInterest("/A/1")->wireEncode()},
+    {t0 + 20_ms, util::TraceDirection::INCOMING, makeInterest("/A/2")->wireEncode()},
+  });
+
+  std::stringstream ss;
+  auto writer = make_shared<util::PacketTraceWriter>(ss);
+  auto capture = make_shared<CaptureTransport>(replay, writer);
+  BOOST_CHECK_EQUAL(capture->getInnerTransport(), replay);
+
+  Face face(capture, io, m_keyChain);
+  face.setInterestFilter("/A", [&] (const auto&, const Interest& interest) {
+    face.put(*makeData(interest.getName()));
+  });
+  advanceClocks(1_ms);
+  BOOST_CHECK(capture->isConnected());
+  BOOST_CHECK_EQUAL(writer->getNRecords(), 2);
+
+  advanceClocks(1_ms, 20);
+  BOOST_CHECK_EQUAL(writer->getNRecords(), 4);
+  BOOST_CHECK_EQUAL(replay->getNSent(), 2);
+
+  util::PacketTraceReader reader(ss);
+  auto records = reader.readAll();
+  BOOST_REQUIRE_EQUAL(records.size(), 4);
+  BOOST_CHECK_EQUAL(records[0].direction, util::TraceDirection::INCOMING);
+  BOOST_CHECK_EQUAL(Interest(records[0].wire).getName(), "/A/1");
+  BOOST_CHECK_EQUAL(records[1].direction, util::TraceDirection::OUTGOING);
+  BOOST_CHECK_EQUAL(Data(records[1].wire).getName(), "/A/1");
+  BOOST_CHECK_EQUAL(records[3].direction, util::TraceDirection::OUTGOING);
+  BOOST_CHECK_EQUAL(Data(records[3].wire).getName(), "/A/2");
+
+  face.shutdown();
+  advanceClocks(1_ms);
+  BOOST_CHECK(!capture->isConnected());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCaptureTransport
+BOOST_AUTO_TEST_SUITE_END() // Transport
+
+} // namespace tests
+} // namespace ndn
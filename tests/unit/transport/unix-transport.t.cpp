@@ -22,7 +22,13 @@
 #include "ndn-cxx/transport/unix-transport.hpp"
 
 #include "tests/boost-test.hpp"
+#include "tests/make-interest-data.hpp"
 #include "tests/unit/transport/transport-fixture.hpp"
+#include "tests/unit/unit-test-time-fixture.hpp"
+
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/filesystem.hpp>
 
 namespace ndn {
 namespace tests {
@@ -52,6 +58,82 @@ BOOST_AUTO_TEST_CASE(GetSocketNameFromUri)
                         });
 }
 
+class UnixTransportConnectFixture : public UnitTestTimeFixture
+{
+public:
+  UnixTransportConnectFixture()
+    : socketPath(boost::filesystem::unique_path(boost::filesystem::temp_directory_path() /
+                                                "ndn-cxx-test-%%%%-%%%%.sock").string())
+    , acceptor(io, boost::asio::local::stream_protocol::endpoint(socketPath))
+    , transport(socketPath)
+  {
+  }
+
+  ~UnixTransportConnectFixture()
+  {
+    transport.close();
+    acceptor.close();
+    boost::filesystem::remove(socketPath);
+  }
+
+public:
+  std::string socketPath;
+  boost::asio::local::stream_protocol::acceptor acceptor;
+  UnixTransport transport;
+};
+
+BOOST_FIXTURE_TEST_CASE(ConnectDeadline, UnixTransportConnectFixture)
+{
+  BOOST_CHECK(!transport.getConnectDeadline());
+
+  transport.connect(io, [] (const Block&) {});
+  BOOST_REQUIRE(transport.getConnectDeadline());
+  BOOST_CHECK(*transport.getConnectDeadline() == time::steady_clock::now() + 4_s);
+
+  advanceClocks(1_ms);
+  BOOST_CHECK(transport.isConnected());
+  BOOST_CHECK(!transport.getConnectDeadline());
+}
+
+BOOST_FIXTURE_TEST_CASE(SendWireSequence, UnixTransportConnectFixture)
+{
+  boost::asio::local::stream_protocol::socket peer(io);
+  bool isAccepted = false;
+  acceptor.async_accept(peer, [&] (const boost::system::error_code& error) {
+    BOOST_CHECK(!error);
+    isAccepted = true;
+  });
+
+  // split a packet into regions that live in separate buffers, so that they can only be
+  // sent back to back by a gathered write
+  Block wire = makeData("/unix/wire-sequence")->wireEncode();
+  WireSequence sequence;
+  std::vector<size_t> splits{0, 3, wire.size() - 10, wire.size()};
+  for (size_t i = 1; i < splits.size(); ++i) {
+    auto region = make_shared<Buffer>(wire.wire() + splits[i - 1], wire.wire() + splits[i]);
+    sequence.emplace_back(region, region->data(), region->size());
+  }
+  Block other = makeData("/unix/block")->wireEncode();
+
+  transport.connect(io, [] (const Block&) {});
+  transport.send(sequence); // queued until connected
+  advanceClocks(1_ms, 5);
+  BOOST_REQUIRE(isAccepted);
+  BOOST_REQUIRE(transport.isConnected());
+  transport.send(other);
+  transport.send(sequence);
+  advanceClocks(1_ms, 5);
+
+  std::vector<uint8_t> expected;
+  for (const Block& block : {wire, other, wire}) {
+    expected.insert(expected.end(), block.begin(), block.end());
+  }
+  BOOST_REQUIRE_EQUAL(peer.available(), expected.size());
+  std::vector<uint8_t> received(expected.size());
+  boost::asio::read(peer, boost::asio::buffer(received));
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.begin(), received.end(), expected.begin(), expected.end());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestUnixTransport
 BOOST_AUTO_TEST_SUITE_END() // Transport
 
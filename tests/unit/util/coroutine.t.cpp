@@ -0,0 +1,341 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/coroutine.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/make-interest-data.hpp"
+#include "tests/unit/dummy-validator.hpp"
+#include "tests/unit/unit-test-time-fixture.hpp"
+
+namespace ndn {
+namespace coro {
+namespace tests {
+
+using namespace ndn::tests;
+using util::DummyClientFace;
+using util::SegmentFetcher;
+
+/** \brief A validation policy that makes its decision asynchronously, from the io_service.
+ */
+class AsyncValidationPolicy : public DummyValidationPolicy
+{
+public:
+  AsyncValidationPolicy(boost::asio::io_service& io, bool shouldAccept)
+    : DummyValidationPolicy(shouldAccept)
+    , m_io(io)
+  {
+  }
+
+protected:
+  using DummyValidationPolicy::checkPolicy;
+
+  void
+  checkPolicy(const Data& data, const shared_ptr<security::v2::ValidationState>& state,
+              const ValidationContinuation& continueValidation) override
+  {
+    m_io.post([this, &data, state, continueValidation] {
+      DummyValidationPolicy::checkPolicy(data, state, continueValidation);
+    });
+  }
+
+private:
+  boost::asio::io_service& m_io;
+};
+
+class CoroutineFixture : public UnitTestTimeFixture
+{
+public:
+  CoroutineFixture()
+    : face(io)
+  {
+  }
+
+  static shared_ptr<Data>
+  makeSegment(uint64_t segment, uint64_t lastSegment)
+  {
+    auto data = make_shared<Data>(Name("/coro/object").appendVersion(1).appendSegment(segment));
+    data->setFreshnessPeriod(1_s);
+    std::string content = to_string(segment);
+    data->setContent(reinterpret_cast<const uint8_t*>(content.data()), content.size());
+    data->setFinalBlock(name::Component::fromSegment(lastSegment));
+    return signData(data);
+  }
+
+public:
+  DummyClientFace face;
+};
+
+static Task<void>
+expressInto(Face& face, Interest interest, optional<ExpressResult>& result)
+{
+  result = co_await express(face, interest);
+}
+
+static Task<void>
+validateInto(security::Validator& validator, const Data& data, optional<ValidationResult>& result)
+{
+  result = co_await validate(validator, data);
+}
+
+static Task<void>
+readStream(Face& face, security::Validator& validator, std::vector<std::string>& segments,
+           optional<uint32_t>& errorCode, bool& isDone)
+{
+  // keep all segments in flight at once, so that they can be answered out of order
+  SegmentFetcher::Options options;
+  options.useConstantCwnd = true;
+  options.initCwnd = 4.0;
+  SegmentStream stream(face, Interest("/coro/object"), validator, options);
+  try {
+    while (auto segment = co_await stream.next()) {
+      segments.emplace_back((*segment)->begin(), (*segment)->end());
+    }
+  }
+  catch (const SegmentFetchError& e) {
+    errorCode = e.getCode();
+  }
+  isDone = true;
+}
+
+static Task<int>
+throwAfterSuspend(Face& face)
+{
+  co_await express(face, *makeInterest("/coro/throw"));
+  NDN_THROW(std::runtime_error("task failed"));
+}
+
+static Task<int>
+addOne(Task<int> task)
+{
+  co_return co_await task + 1;
+}
+
+static Task<void>
+catchInto(Task<int> task, std::string& what)
+{
+  try {
+    co_await task;
+  }
+  catch (const std::runtime_error& e) {
+    what = e.what();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_FIXTURE_TEST_SUITE(TestCoroutine, CoroutineFixture)
+
+BOOST_AUTO_TEST_SUITE(Express)
+
+BOOST_AUTO_TEST_CASE(ReceiveData)
+{
+  optional<ExpressResult> result;
+  spawn(io, expressInto(face, *makeInterest("/coro/data"), result));
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+  BOOST_CHECK(!result);
+
+  face.receive(*makeData("/coro/data"));
+  advanceClocks(1_ms);
+  BOOST_REQUIRE(result);
+  BOOST_CHECK(result->status == ExpressResult::Status::DATA);
+  BOOST_REQUIRE(result->data);
+  BOOST_CHECK_EQUAL(result->data->getName(), "/coro/data");
+  BOOST_CHECK(!result->nack);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ReceiveNack)
+{
+  optional<ExpressResult> result;
+  spawn(io, expressInto(face, *makeInterest("/coro/nack"), result));
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+
+  face.receive(makeNack(face.sentInterests.back(), lp::NackReason::NO_ROUTE));
+  advanceClocks(1_ms);
+  BOOST_REQUIRE(result);
+  BOOST_CHECK(result->status == ExpressResult::Status::NACK);
+  BOOST_REQUIRE(result->nack);
+  BOOST_CHECK_EQUAL(result->nack->getReason(), lp::NackReason::NO_ROUTE);
+  BOOST_CHECK(!result->data);
+}
+
+BOOST_AUTO_TEST_CASE(Timeout)
+{
+  optional<ExpressResult> result;
+  spawn(io, expressInto(face, *makeInterest("/coro/timeout", false, 500_ms), result));
+  advanceClocks(100_ms, 4);
+  BOOST_CHECK(!result);
+
+  advanceClocks(100_ms, 2);
+  BOOST_REQUIRE(result);
+  BOOST_CHECK(result->status == ExpressResult::Status::TIMEOUT);
+  BOOST_CHECK(!result->data);
+  BOOST_CHECK(!result->nack);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Express
+
+BOOST_AUTO_TEST_SUITE(Validate)
+
+BOOST_AUTO_TEST_CASE(Success)
+{
+  DummyValidator validator(true);
+  auto data = makeData("/coro/valid");
+  optional<ValidationResult> result;
+  spawn(io, validateInto(validator, *data, result));
+  // DummyValidator completes synchronously, so the coroutine does not suspend
+  BOOST_REQUIRE(result);
+  BOOST_CHECK(static_cast<bool>(*result));
+  BOOST_CHECK(!result->error);
+}
+
+BOOST_AUTO_TEST_CASE(Failure)
+{
+  DummyValidator validator(false);
+  auto data = makeData("/coro/invalid");
+  optional<ValidationResult> result;
+  spawn(io, validateInto(validator, *data, result));
+  BOOST_REQUIRE(result);
+  BOOST_CHECK(!*result);
+  BOOST_REQUIRE(result->error);
+  BOOST_CHECK_EQUAL(result->error->getCode(), security::v2::ValidationError::NO_ERROR);
+}
+
+BOOST_AUTO_TEST_CASE(Asynchronous)
+{
+  for (bool shouldAccept : {true, false}) {
+    security::v2::Validator validator(make_unique<AsyncValidationPolicy>(io, shouldAccept),
+                                      make_unique<security::v2::CertificateFetcherOffline>());
+    auto data = makeData("/coro/async");
+    optional<ValidationResult> result;
+    spawn(io, validateInto(validator, *data, result));
+    BOOST_CHECK(!result);
+
+    advanceClocks(1_ms);
+    BOOST_REQUIRE(result);
+    BOOST_CHECK_EQUAL(static_cast<bool>(*result), shouldAccept);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Validate
+
+BOOST_AUTO_TEST_SUITE(Stream)
+
+BOOST_AUTO_TEST_CASE(InOrder)
+{
+  DummyValidator validator;
+  std::vector<std::string> segments;
+  optional<uint32_t> errorCode;
+  bool isDone = false;
+  spawn(io, readStream(face, validator, segments, errorCode, isDone));
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+  face.sentInterests.clear();
+  face.receive(*makeSegment(0, 3));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(segments.size(), 1);
+
+  // answer the remaining segments in reverse order
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 3);
+  for (auto it = face.sentInterests.rbegin(); it != face.sentInterests.rend(); ++it) {
+    face.receive(*makeSegment(it->getName()[-1].toSegment(), 3));
+    advanceClocks(1_ms);
+  }
+
+  BOOST_CHECK(isDone);
+  BOOST_CHECK(!errorCode);
+  std::vector<std::string> expected{"0", "1", "2", "3"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(segments.begin(), segments.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(Error)
+{
+  DummyValidator validator(false);
+  std::vector<std::string> segments;
+  optional<uint32_t> errorCode;
+  bool isDone = false;
+  spawn(io, readStream(face, validator, segments, errorCode, isDone));
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+  face.receive(*makeSegment(0, 3));
+  advanceClocks(1_ms);
+
+  BOOST_CHECK(isDone);
+  BOOST_CHECK(segments.empty());
+  BOOST_REQUIRE(errorCode);
+  BOOST_CHECK_EQUAL(*errorCode, SegmentFetcher::SEGMENT_VALIDATION_FAIL);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Stream
+
+BOOST_AUTO_TEST_SUITE(TaskLifetime)
+
+BOOST_AUTO_TEST_CASE(ExceptionPropagation)
+{
+  std::string what;
+  spawn(io, catchInto(addOne(throwAfterSuspend(face)), what));
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+  BOOST_CHECK(what.empty());
+
+  face.receive(*makeData("/coro/throw"));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(what, "task failed");
+}
+
+BOOST_AUTO_TEST_CASE(UnhandledException)
+{
+  // an exception escaping a spawned task is rethrown from the io_service
+  spawn(io, []() -> Task<void> { NDN_THROW(std::runtime_error("spawned task failed")); co_return; }());
+  BOOST_CHECK_THROW(advanceClocks(1_ms), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(Cancellation)
+{
+  optional<ExpressResult> result;
+  {
+    auto task = expressInto(face, *makeInterest("/coro/cancel"), result);
+    // start the task without a continuation, as an awaiting coroutine would
+    auto awaiter = task.operator co_await();
+    awaiter.await_suspend(std::noop_coroutine()).resume();
+    BOOST_CHECK(!task.isDone());
+    advanceClocks(1_ms);
+    BOOST_CHECK_EQUAL(face.getNPendingInterests(), 1);
+  } // destroying the suspended task withdraws its pending Interest
+
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
+  face.receive(*makeData("/coro/cancel"));
+  advanceClocks(1_ms);
+  BOOST_CHECK(!result);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TaskLifetime
+
+BOOST_AUTO_TEST_SUITE_END() // TestCoroutine
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace tests
+} // namespace coro
+} // namespace ndn
@@ -24,6 +24,8 @@
 #include "tests/boost-test.hpp"
 #include "tests/identity-management-fixture.hpp"
 
+#include <atomic>
+
 #include <boost/filesystem.hpp>
 #include <boost/mpl/vector.hpp>
 
@@ -89,6 +91,53 @@ BOOST_AUTO_TEST_CASE(SaveBufferException)
   BOOST_CHECK_THROW(io::saveBuffer(buffer.data(), buffer.size(), out, io::NO_ENCODING), io::Error);
 }
 
+BOOST_AUTO_TEST_CASE(LoadBufferBase64)
+{
+  auto decode = [] (const std::string& text) {
+    std::istringstream is(text);
+    return io::loadBuffer(is, io::BASE64);
+  };
+
+  BOOST_CHECK_EQUAL(decode("")->size(), 0);
+  BOOST_CHECK_EQUAL(decode("QQ==")->size(), 1);
+  BOOST_CHECK_EQUAL(decode("QUI=")->size(), 2);
+  BOOST_CHECK_EQUAL(decode("QUI")->size(), 2);
+
+  auto buf = decode(" Qm Fz\r\nZTY0\tRW5j \n");
+  const std::string expected("Base64Enc");
+  BOOST_CHECK_EQUAL_COLLECTIONS(buf->begin(), buf->end(), expected.begin(), expected.end());
+
+  // a large input spanning several read chunks
+  std::string large;
+  for (int i = 0; i < 30000; ++i) {
+    large += "QUJD\n";
+  }
+  BOOST_CHECK_EQUAL(decode(large)->size(), 90000);
+
+  // a stream that is not at its beginning
+  std::istringstream partial("garbage" + large);
+  partial.ignore(7);
+  BOOST_CHECK_EQUAL(io::loadBuffer(partial, io::BASE64)->size(), 90000);
+
+  // a stream that does not support seeking, e.g., a pipe
+  class UnseekableBuf : public std::streambuf
+  {
+  public:
+    explicit
+    UnseekableBuf(std::string& s)
+    {
+      setg(&s[0], &s[0], &s[0] + s.size());
+    }
+  } unseekableBuf(large);
+  std::istream unseekable(&unseekableBuf);
+  BOOST_CHECK_EQUAL(io::loadBuffer(unseekable, io::BASE64)->size(), 90000);
+
+  BOOST_CHECK_THROW(decode("QU*D"), io::Error);
+  BOOST_CHECK_THROW(decode("Q"), io::Error);
+  BOOST_CHECK_THROW(decode("Q==="), io::Error);
+  BOOST_CHECK_THROW(decode("QQ==QUJD"), io::Error);
+}
+
 BOOST_AUTO_TEST_CASE(UnknownIoEncoding)
 {
   std::stringstream ss;
@@ -283,6 +332,66 @@ BOOST_AUTO_TEST_CASE(LoadFileNotReadable)
   BOOST_CHECK(decoded == nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(LoadBlocks)
+{
+  this->writeFile<std::vector<uint8_t>>({0xBB, 0x01, 0xEE, 0x08, 0x00, 0x07, 0x02, 0x08, 0x00});
+  auto blocks = io::loadBlocks(filename);
+  BOOST_REQUIRE_EQUAL(blocks.size(), 3);
+  BOOST_CHECK_EQUAL(blocks[0].type(), 0xBB);
+  BOOST_CHECK_EQUAL(blocks[1].type(), 0x08);
+  BOOST_CHECK_EQUAL(blocks[2].type(), 0x07);
+  BOOST_CHECK_EQUAL(blocks[2].size(), 4);
+  // all blocks share one buffer
+  BOOST_CHECK_EQUAL(blocks[0].getBuffer(), blocks[2].getBuffer());
+
+  std::ifstream is(filename, std::ios_base::binary);
+  BOOST_CHECK_EQUAL(io::loadBlocks(is).size(), 3);
+
+  this->writeFile<std::string>("uwHu\nCAA=\n"); // printf '\xBB\x01\xEE\x08\x00' | base64
+  BOOST_CHECK_EQUAL(io::loadBlocks(filename, io::BASE64).size(), 2);
+
+  this->writeFile<std::string>("");
+  BOOST_CHECK_EQUAL(io::loadBlocks(filename).size(), 0);
+
+  this->writeFile<std::vector<uint8_t>>({0xBB, 0x01, 0xEE, 0x08, 0x02, 0x00});
+  BOOST_CHECK_THROW(io::loadBlocks(filename), io::Error);
+
+  boost::filesystem::remove(filepath);
+  BOOST_CHECK_THROW(io::loadBlocks(filename), io::Error);
+}
+
+BOOST_AUTO_TEST_CASE(LoadMany)
+{
+  std::vector<std::string> filenames;
+  for (int i = 0; i < 8; ++i) {
+    filenames.push_back(filename + to_string(i));
+    std::ofstream os(filenames.back());
+    io::save(name::Component(to_string(i)), os);
+  }
+  filenames.push_back(filename + "-does-not-exist");
+
+  auto components = io::loadMany<name::Component>(filenames, io::BASE64, 3);
+  BOOST_REQUIRE_EQUAL(components.size(), 9);
+  for (int i = 0; i < 8; ++i) {
+    BOOST_REQUIRE(components[i] != nullptr);
+    BOOST_CHECK_EQUAL(*components[i], name::Component(to_string(i)));
+    boost::filesystem::remove(filenames[i]);
+  }
+  BOOST_CHECK(components[8] == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForException)
+{
+  std::atomic<int> nCalls(0);
+  BOOST_CHECK_THROW(io::detail::parallelFor(100, 4, [&] (size_t i) {
+                      ++nCalls;
+                      if (i == 10)
+                        NDN_THROW(std::runtime_error("expected"));
+                    }),
+                    std::runtime_error);
+  BOOST_CHECK_LT(nCalls, 100);
+}
+
 BOOST_AUTO_TEST_CASE(SaveNoEncoding)
 {
   EncodableType encoded;
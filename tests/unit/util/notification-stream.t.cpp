@@ -68,6 +68,50 @@ BOOST_AUTO_TEST_CASE(Post)
   BOOST_CHECK_EQUAL(decoded2.getMessage(), "msg2");
 }
 
+BOOST_AUTO_TEST_CASE(Batching)
+{
+  DummyClientFace face(io, m_keyChain);
+  util::NotificationStream<SimpleNotification> notificationStream(face,
+    "/localhost/nfd/NotificationStreamTest", m_keyChain);
+  BOOST_CHECK_THROW(notificationStream.setBatching(10_ms, 0), std::invalid_argument);
+  notificationStream.setBatching(10_ms, 3);
+
+  // published when the batch is full
+  notificationStream.postNotification(SimpleNotification("msg1"));
+  notificationStream.postNotification(SimpleNotification("msg2"));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 0);
+  notificationStream.postNotification(SimpleNotification("msg3"));
+  advanceClocks(1_ms);
+
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentData[0].getName(), "/localhost/nfd/NotificationStreamTest/%FE%00");
+  const Block& content = face.sentData[0].getContent();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements_size(), 3);
+  BOOST_CHECK_EQUAL(SimpleNotification(content.elements()[0]).getMessage(), "msg1");
+  BOOST_CHECK_EQUAL(SimpleNotification(content.elements()[2]).getMessage(), "msg3");
+
+  // published when the window expires
+  notificationStream.postNotification(SimpleNotification("msg4"));
+  advanceClocks(1_ms, 9);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 1);
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 2);
+  BOOST_CHECK_EQUAL(face.sentData[1].getName(), "/localhost/nfd/NotificationStreamTest/%FE%01");
+  BOOST_CHECK_EQUAL(SimpleNotification(face.sentData[1].getContent().blockFromValue()).getMessage(),
+                    "msg4");
+
+  // published on flush
+  notificationStream.postNotification(SimpleNotification("msg5"));
+  notificationStream.flush();
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 3);
+  BOOST_CHECK_EQUAL(face.sentData[2].getName(), "/localhost/nfd/NotificationStreamTest/%FE%02");
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestNotificationStream
 BOOST_AUTO_TEST_SUITE_END() // Util
 
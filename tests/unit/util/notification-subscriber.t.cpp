@@ -70,6 +70,24 @@ public:
     subscriberFace.receive(data);
   }
 
+  /** \brief make a Data packet carrying one or more notifications
+   */
+  Data
+  makeNotificationData(uint64_t seqNo, std::initializer_list<std::string> msgs)
+  {
+    Block content(tlv::Content);
+    for (const auto& msg : msgs) {
+      content.push_back(SimpleNotification(msg).wireEncode());
+    }
+    content.encode();
+
+    Data data(Name(streamPrefix).appendSequenceNumber(seqNo));
+    data.setContent(content);
+    data.setFreshnessPeriod(1_s);
+    m_keyChain.sign(data);
+    return data;
+  }
+
   /** \brief deliver a Nack to subscriber
    */
   void
@@ -312,6 +330,111 @@ BOOST_AUTO_TEST_CASE(PayloadError)
   BOOST_CHECK(this->hasInitialRequest());
 }
 
+BOOST_AUTO_TEST_CASE(Batch)
+{
+  std::vector<std::string> received;
+  subscriber.onNotification.connect([&] (const SimpleNotification& n) {
+    received.push_back(n.getMessage());
+  });
+  subscriber.start();
+  advanceClocks(1_ms);
+
+  subscriberFace.sentInterests.clear();
+  subscriberFace.receive(makeNotificationData(5, {"n1", "n2", "n3"}));
+  advanceClocks(1_ms);
+  BOOST_CHECK(received == (std::vector<std::string>{"n1", "n2", "n3"}));
+  BOOST_CHECK_EQUAL(this->getRequestSeqNum(), 6);
+}
+
+BOOST_AUTO_TEST_CASE(Pipeline)
+{
+  BOOST_CHECK_THROW(subscriber.setPipelineSize(0), std::invalid_argument);
+  subscriber.setPipelineSize(3);
+  BOOST_CHECK_EQUAL(subscriber.getPipelineSize(), 3);
+
+  std::vector<std::string> received;
+  subscriber.onNotification.connect([&] (const SimpleNotification& n) {
+    received.push_back(n.getMessage());
+  });
+  subscriber.start();
+  advanceClocks(1_ms);
+
+  subscriberFace.sentInterests.clear();
+  subscriberFace.receive(makeNotificationData(10, {"n10"}));
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(subscriberFace.sentInterests.size(), 3);
+  BOOST_CHECK_EQUAL(subscriberFace.sentInterests[0].getName().at(-1).toSequenceNumber(), 11);
+  BOOST_CHECK_EQUAL(subscriberFace.sentInterests[2].getName().at(-1).toSequenceNumber(), 13);
+
+  // out-of-order Data are delivered in sequence order
+  subscriberFace.sentInterests.clear();
+  subscriberFace.receive(makeNotificationData(12, {"n12"}));
+  advanceClocks(1_ms);
+  BOOST_CHECK(received == (std::vector<std::string>{"n10"}));
+  BOOST_CHECK_EQUAL(subscriberFace.sentInterests.size(), 0);
+
+  subscriberFace.receive(makeNotificationData(11, {"n11"}));
+  advanceClocks(1_ms);
+  BOOST_CHECK(received == (std::vector<std::string>{"n10", "n11", "n12"}));
+  BOOST_REQUIRE_EQUAL(subscriberFace.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(subscriberFace.sentInterests[0].getName().at(-1).toSequenceNumber(), 14);
+  BOOST_CHECK_EQUAL(subscriberFace.sentInterests[1].getName().at(-1).toSequenceNumber(), 15);
+}
+
+BOOST_AUTO_TEST_CASE(Gap)
+{
+  subscriber.setPipelineSize(3);
+  std::vector<std::string> received;
+  subscriber.onNotification.connect([&] (const SimpleNotification& n) {
+    received.push_back(n.getMessage());
+  });
+  std::vector<std::pair<uint64_t, uint64_t>> gaps;
+  subscriber.onGap.connect([&] (uint64_t first, uint64_t last) { gaps.emplace_back(first, last); });
+  subscriber.start();
+  advanceClocks(1_ms);
+
+  subscriberFace.receive(makeNotificationData(0, {"n0"}));
+  advanceClocks(1_ms);
+  subscriberFace.receive(makeNotificationData(3, {"n3"}));
+  advanceClocks(1_ms);
+  BOOST_CHECK(received == (std::vector<std::string>{"n0"}));
+
+  // Interests for 1 and 2 time out, while 3 has been received
+  advanceClocks(100_ms, 10);
+  BOOST_REQUIRE_EQUAL(gaps.size(), 1);
+  BOOST_CHECK_EQUAL(gaps[0].first, 1);
+  BOOST_CHECK_EQUAL(gaps[0].second, 2);
+  BOOST_CHECK(received == (std::vector<std::string>{"n0", "n3"}));
+}
+
+BOOST_AUTO_TEST_CASE(Backpressure)
+{
+  subscriber.setPipelineSize(4);
+  this->connectHandlers();
+  std::vector<size_t> windows;
+  subscriber.onBackpressure.connect([&] (size_t window) { windows.push_back(window); });
+  subscriber.start();
+  advanceClocks(1_ms);
+
+  subscriberFace.receive(makeNotificationData(0, {"n0"}));
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(subscriberFace.sentInterests.size(), 5);
+
+  Interest interest = subscriberFace.sentInterests.back();
+  subscriberFace.sentInterests.clear();
+  this->deliverNack(interest, lp::NackReason::CONGESTION);
+  advanceClocks(1_ms);
+  BOOST_CHECK(windows == std::vector<size_t>{2});
+
+  // after backing off, the subscriber resynchronizes with a reduced pipeline
+  advanceClocks(300_ms);
+  BOOST_REQUIRE(this->hasInitialRequest());
+  subscriberFace.sentInterests.clear();
+  subscriberFace.receive(makeNotificationData(1, {"n1"}));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(subscriberFace.sentInterests.size(), 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestNotificationSubscriber
 BOOST_AUTO_TEST_SUITE_END() // Util
 
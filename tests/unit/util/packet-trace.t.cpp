@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/packet-trace.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/make-interest-data.hpp"
+#include "tests/unit/identity-management-time-fixture.hpp"
+
+#include <sstream>
+
+namespace ndn {
+namespace util {
+namespace tests {
+
+using namespace ndn::tests;
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_FIXTURE_TEST_SUITE(TestPacketTrace, IdentityManagementTimeFixture)
+
+BOOST_AUTO_TEST_CASE(WriteRead)
+{
+  std::stringstream ss;
+  PacketTraceWriter writer(ss);
+  Block interest = makeInterest("/A")->wireEncode();
+  Block data = makeData("/A")->wireEncode();
+  writer.write(TraceDirection::INCOMING, interest);
+  advanceClocks(5_ms);
+  writer.write(TraceDirection::OUTGOING, data);
+  BOOST_CHECK_EQUAL(writer.getNRecords(), 2);
+
+  PacketTraceReader reader(ss);
+  auto records = reader.readAll();
+  BOOST_REQUIRE_EQUAL(records.size(), 2);
+  BOOST_CHECK_EQUAL(records[0].direction, TraceDirection::INCOMING);
+  BOOST_CHECK_EQUAL(records[0].wire, interest);
+  BOOST_CHECK_EQUAL(records[1].direction, TraceDirection::OUTGOING);
+  BOOST_CHECK_EQUAL(records[1].wire, data);
+  BOOST_CHECK(records[1].timestamp - records[0].timestamp == 5_ms);
+  BOOST_CHECK(reader.read() == nullopt);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  std::stringstream notTrace("NDNTRC99");
+  BOOST_CHECK_THROW(PacketTraceReader{notTrace}, PacketTraceReader::Error);
+
+  std::stringstream ss;
+  PacketTraceWriter writer(ss);
+  writer.write(TraceDirection::INCOMING, makeInterest("/A")->wireEncode());
+  std::string trace = ss.str();
+
+  std::stringstream truncatedHeader(trace.substr(0, 12));
+  PacketTraceReader reader1(truncatedHeader);
+  BOOST_CHECK_THROW(reader1.read(), PacketTraceReader::Error);
+
+  std::stringstream truncatedBlock(trace.substr(0, trace.size() - 1));
+  PacketTraceReader reader2(truncatedBlock);
+  BOOST_CHECK_THROW(reader2.read(), PacketTraceReader::Error);
+
+  trace[16] = '\x07';
+  std::stringstream badDirection(trace);
+  PacketTraceReader reader3(badDirection);
+  BOOST_CHECK_THROW(reader3.read(), PacketTraceReader::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Replay)
+{
+  auto t0 = time::system_clock::now();
+  std::vector<TraceRecord> records{
+    {t0, TraceDirection::INCOMING, makeInterest("/A/1")->wireEncode()},
+    {t0 + 10_ms, TraceDirection::OUTGOING, makeData("/A/1")->wireEncode()},
+    {t0 + 100_ms, TraceDirection::INCOMING, makeInterest("/A/2")->wireEncode()},
+  };
+  BOOST_CHECK_THROW(PacketTraceReplayer(io, records, 0.0), std::invalid_argument);
+
+  DummyClientFace face(io, m_keyChain);
+  std::vector<Name> received;
+  face.setInterestFilter("/A", [&] (const auto&, const Interest& interest) {
+    received.push_back(interest.getName());
+  });
+  advanceClocks(1_ms);
+
+  PacketTraceReplayer replayer(io, records, 2.0);
+  bool hasFinished = false;
+  replayer.onFinished.connect([&] { hasFinished = true; });
+  replayer.start([&face] (const Block& wire) { face.receive(wire); });
+  BOOST_CHECK(replayer.isRunning());
+
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(received.size(), 1);
+  advanceClocks(1_ms, 47);
+  BOOST_CHECK_EQUAL(received.size(), 1);
+  advanceClocks(1_ms, 2);
+  BOOST_REQUIRE_EQUAL(received.size(), 2);
+  BOOST_CHECK_EQUAL(received[1], "/A/2");
+  BOOST_CHECK_EQUAL(replayer.getNReplayed(), 2);
+  BOOST_CHECK(hasFinished);
+  BOOST_CHECK(!replayer.isRunning());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPacketTrace
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace tests
+} // namespace util
+} // namespace ndn
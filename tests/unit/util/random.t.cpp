@@ -25,8 +25,12 @@
 #include "tests/boost-test.hpp"
 
 #include <array>
+#include <set>
 #include <thread>
 
+#include <sys/wait.h>
+#include <unistd.h>
+
 namespace ndn {
 namespace tests {
 
@@ -46,6 +50,57 @@ BOOST_AUTO_TEST_CASE(ThreadLocalEngine)
   BOOST_CHECK_EQUAL(r1, r3);
 }
 
+BOOST_AUTO_TEST_CASE(NonceBytes)
+{
+  // larger than the internal buffer, so that a refill happens in the middle
+  std::vector<uint8_t> buf1(10000), buf2(10000);
+  random::generateNonceBytes(buf1.data(), buf1.size());
+  random::generateNonceBytes(buf2.data(), buf2.size());
+  BOOST_CHECK(buf1 != buf2);
+
+  // all 256 byte values should show up in 10000 uniformly random bytes
+  std::set<uint8_t> values(buf1.begin(), buf1.end());
+  BOOST_CHECK_EQUAL(values.size(), 256);
+
+  // each thread has its own stream
+  std::array<uint8_t, 16> mine, theirs;
+  random::generateNonceBytes(mine.data(), mine.size());
+  std::thread t([&theirs] { random::generateNonceBytes(theirs.data(), theirs.size()); });
+  t.join();
+  BOOST_CHECK(mine != theirs);
+
+  BOOST_CHECK_NE(random::generateNonceWord64(), random::generateNonceWord64());
+}
+
+BOOST_AUTO_TEST_CASE(NonceBytesAfterFork)
+{
+  // make sure this thread's stream has buffered keystream before forking
+  std::array<uint8_t, 16> before;
+  random::generateNonceBytes(before.data(), before.size());
+
+  int fds[2];
+  BOOST_REQUIRE_EQUAL(pipe(fds), 0);
+  pid_t pid = fork();
+  BOOST_REQUIRE_NE(pid, -1);
+  if (pid == 0) {
+    std::array<uint8_t, 16> child;
+    random::generateNonceBytes(child.data(), child.size());
+    ssize_t nWritten = write(fds[1], child.data(), child.size());
+    _exit(nWritten == static_cast<ssize_t>(child.size()) ? 0 : 1);
+  }
+  close(fds[1]);
+
+  std::array<uint8_t, 16> parent, child;
+  random::generateNonceBytes(parent.data(), parent.size());
+  BOOST_CHECK_EQUAL(read(fds[0], child.data(), child.size()), static_cast<ssize_t>(child.size()));
+  close(fds[0]);
+
+  int status = -1;
+  BOOST_CHECK_EQUAL(waitpid(pid, &status, 0), pid);
+  BOOST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  BOOST_CHECK(parent != child);
+}
+
 // This fixture uses OpenSSL routines to set a dummy random generator that always fails
 class FailRandMethodFixture
 {
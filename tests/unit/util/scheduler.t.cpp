@@ -210,6 +210,24 @@ BOOST_AUTO_TEST_CASE(CancelAllWithScopedEventId) // Bug 3691
   BOOST_CHECK(true);
 }
 
+BOOST_AUTO_TEST_CASE(NextExpiry)
+{
+  BOOST_CHECK(!scheduler.getNextExpiry());
+
+  auto start = time::steady_clock::now();
+  EventId e1 = scheduler.schedule(500_ms, []{});
+  scheduler.schedule(200_ms, []{});
+  BOOST_REQUIRE(scheduler.getNextExpiry());
+  BOOST_CHECK(*scheduler.getNextExpiry() == start + 200_ms);
+
+  advanceClocks(100_ms, 3);
+  BOOST_REQUIRE(scheduler.getNextExpiry());
+  BOOST_CHECK(*scheduler.getNextExpiry() == start + 500_ms);
+
+  e1.cancel();
+  BOOST_CHECK(!scheduler.getNextExpiry());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // General
 
 BOOST_AUTO_TEST_SUITE(EventId)
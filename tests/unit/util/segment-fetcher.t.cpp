@@ -22,6 +22,7 @@
 #include "ndn-cxx/util/segment-fetcher.hpp"
 
 #include "ndn-cxx/data.hpp"
+#include "ndn-cxx/link.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/util/dummy-client-face.hpp"
 
@@ -332,6 +333,30 @@ BOOST_AUTO_TEST_CASE(BasicMultipleSegments)
   BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
 }
 
+BOOST_AUTO_TEST_CASE(ForwardingHint)
+{
+  DummyValidator acceptValidator;
+  nSegments = 10;
+  sendNackInsteadOfDropping = false;
+
+  Link link("/producer/link", {{10, "/gateway"}});
+  Interest baseInterest("/hello/world");
+  baseInterest.setSharedForwardingHint(link.getForwardingHint());
+
+  shared_ptr<SegmentFetcher> fetcher = SegmentFetcher::start(face, baseInterest, acceptValidator);
+  face.onSendInterest.connect(bind(&Fixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 10);
+  for (const auto& interest : face.sentInterests) {
+    BOOST_CHECK_EQUAL(interest.getForwardingHint(), link.getDelegationList());
+  }
+}
+
 BOOST_AUTO_TEST_CASE(BasicInOrder)
 {
   DummyValidator acceptValidator;
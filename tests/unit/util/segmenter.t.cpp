@@ -0,0 +1,223 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/segmenter.hpp"
+#include "ndn-cxx/ims/in-memory-storage-persistent.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/identity-management-fixture.hpp"
+
+#include <sstream>
+#include <thread>
+
+namespace ndn {
+namespace util {
+namespace tests {
+
+using namespace ndn::tests;
+
+/** \brief A stream buffer that cannot seek, so the input size is not known in advance.
+ */
+class UnseekableStreambuf : public std::streambuf
+{
+public:
+  explicit
+  UnseekableStreambuf(std::vector<uint8_t>& bytes)
+  {
+    auto p = reinterpret_cast<char*>(bytes.data());
+    setg(p, p, p + bytes.size());
+  }
+};
+
+class SegmenterFixture : public IdentityManagementFixture
+{
+protected:
+  SegmenterFixture()
+    : identity(addIdentity("/segmenter"))
+    , segmenter(m_keyChain, signingByIdentity(identity))
+  {
+    segmenter.setMaxSegmentSize(100).setFreshnessPeriod(2_s);
+    for (size_t i = 0; i < input.size(); ++i) {
+      input[i] = static_cast<uint8_t>(i * 7);
+    }
+  }
+
+  /** \brief Check that \p segments are valid and reassemble into \p expected.
+   *  \param isFinalBlockIdOnAll whether every segment, rather than the last one only,
+   *                             is expected to carry a FinalBlockId
+   */
+  void
+  checkSegments(const std::vector<shared_ptr<Data>>& segments, const uint8_t* expected,
+                size_t expectedSize, bool isFinalBlockIdOnAll = true)
+  {
+    BOOST_REQUIRE(!segments.empty());
+    Name versionedName = segments.front()->getName().getPrefix(-1);
+    BOOST_CHECK(versionedName[-1].isVersion());
+    BOOST_CHECK_EQUAL(versionedName.getPrefix(-1), "/segmenter/object");
+
+    std::vector<uint8_t> reassembled;
+    for (size_t i = 0; i < segments.size(); ++i) {
+      const Data& data = *segments[i];
+      BOOST_CHECK_EQUAL(data.getName(), Name(versionedName).appendSegment(i));
+      BOOST_CHECK_EQUAL(data.getFreshnessPeriod(), 2_s);
+      BOOST_CHECK(security::verifySignature(data, identity.getDefaultKey()));
+      if (isFinalBlockIdOnAll || i + 1 == segments.size()) {
+        BOOST_REQUIRE(data.getFinalBlock());
+        BOOST_CHECK_EQUAL(data.getFinalBlock()->toSegment(), segments.size() - 1);
+      }
+      else {
+        BOOST_CHECK(!data.getFinalBlock());
+      }
+      reassembled.insert(reassembled.end(), data.getContent().value_begin(), data.getContent().value_end());
+    }
+    BOOST_CHECK_EQUAL_COLLECTIONS(reassembled.begin(), reassembled.end(),
+                                  expected, expected + expectedSize);
+  }
+
+protected:
+  security::Identity identity;
+  Segmenter segmenter;
+  std::vector<uint8_t> input = std::vector<uint8_t>(1050);
+};
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_FIXTURE_TEST_SUITE(TestSegmenter, SegmenterFixture)
+
+BOOST_AUTO_TEST_CASE(InvalidParameters)
+{
+  BOOST_CHECK_THROW(segmenter.setMaxSegmentSize(0), std::invalid_argument);
+  BOOST_CHECK_THROW(segmenter.setNThreads(0), std::invalid_argument);
+  BOOST_CHECK_THROW(segmenter.setBatchSize(0), std::invalid_argument);
+  BOOST_CHECK_THROW(segmenter.segment("/segmenter/object", nullptr, 1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(MemoryBuffer)
+{
+  auto segments = segmenter.segment("/segmenter/object", input.data(), input.size());
+  BOOST_CHECK_EQUAL(segments.size(), 11);
+  BOOST_CHECK_EQUAL(segments.back()->getContent().value_size(), 50);
+  checkSegments(segments, input.data(), input.size());
+}
+
+BOOST_AUTO_TEST_CASE(ExplicitVersion)
+{
+  auto segments = segmenter.segment(Name("/segmenter/object").appendVersion(42),
+                                    input.data(), input.size());
+  BOOST_REQUIRE(!segments.empty());
+  BOOST_CHECK_EQUAL(segments.front()->getName(), Name("/segmenter/object").appendVersion(42).appendSegment(0));
+  checkSegments(segments, input.data(), input.size());
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  auto segments = segmenter.segment("/segmenter/object", nullptr, 0);
+  BOOST_CHECK_EQUAL(segments.size(), 1);
+  checkSegments(segments, nullptr, 0);
+
+  std::istringstream is;
+  segments.clear();
+  BOOST_CHECK_EQUAL(segmenter.segment("/segmenter/object", is,
+                                      [&] (const shared_ptr<Data>& data) { segments.push_back(data); }),
+                    1);
+  checkSegments(segments, nullptr, 0);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelBatches)
+{
+  segmenter.setNThreads(4).setBatchSize(3);
+  auto segments = segmenter.segment("/segmenter/object", input.data(), input.size());
+  BOOST_CHECK_EQUAL(segments.size(), 11);
+  checkSegments(segments, input.data(), input.size());
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentSegmentCalls)
+{
+  // both calls share the worker threads of the segmenter; jobs that do not fit
+  // into the pool are executed by the calling thread
+  segmenter.setNThreads(3).setBatchSize(2);
+  std::vector<std::vector<shared_ptr<Data>>> results(4);
+  std::vector<std::thread> threads;
+  for (auto& segments : results) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 5; ++i) {
+        segments = segmenter.segment("/segmenter/object", input.data(), input.size());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& segments : results) {
+    BOOST_CHECK_EQUAL(segments.size(), 11);
+    checkSegments(segments, input.data(), input.size());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SeekableStream)
+{
+  segmenter.setNThreads(2).setBatchSize(4);
+  std::istringstream is(std::string(input.begin(), input.end()));
+  is.ignore(50); // segmentation starts at the current position
+
+  std::vector<shared_ptr<Data>> segments;
+  BOOST_CHECK_EQUAL(segmenter.segment("/segmenter/object", is,
+                                      [&] (const shared_ptr<Data>& data) { segments.push_back(data); }),
+                    10);
+  checkSegments(segments, input.data() + 50, input.size() - 50);
+}
+
+BOOST_AUTO_TEST_CASE(UnseekableStream)
+{
+  segmenter.setBatchSize(5);
+  for (size_t size : {1050, 1000}) { // last batch partially filled, last segment exactly full
+    input.resize(size);
+    UnseekableStreambuf buf(input);
+    std::istream is(&buf);
+
+    std::vector<shared_ptr<Data>> segments;
+    segmenter.segment("/segmenter/object", is,
+                      [&] (const shared_ptr<Data>& data) { segments.push_back(data); });
+    BOOST_CHECK_EQUAL(segments.size(), (size + 99) / 100);
+    checkSegments(segments, input.data(), input.size(), false);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(InsertIntoIms)
+{
+  InMemoryStoragePersistent ims;
+  std::istringstream is(std::string(input.begin(), input.end()));
+  BOOST_CHECK_EQUAL(segmenter.segment("/segmenter/object", is, ims), 11);
+  BOOST_CHECK_EQUAL(ims.size(), 11);
+
+  Interest interest("/segmenter/object");
+  interest.setCanBePrefix(true);
+  auto found = ims.find(interest);
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK(found->getName()[-1].isSegment());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSegmenter
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace tests
+} // namespace util
+} // namespace ndn
@@ -150,6 +150,51 @@ BOOST_AUTO_TEST_CASE(Basic)
   }
 }
 
+BOOST_AUTO_TEST_CASE(Cache)
+{
+  Sqlite3Statement(db, "CREATE TABLE test (t1 int)").step();
+
+  Sqlite3StatementCache cache(db);
+  const std::string insertSql = "INSERT INTO test VALUES (?)";
+  sqlite3_stmt* prepared = nullptr;
+  for (int i = 0; i < 3; ++i) {
+    Sqlite3Statement stmt(cache, insertSql);
+    if (prepared == nullptr) {
+      prepared = stmt;
+    }
+    BOOST_CHECK_EQUAL(static_cast<sqlite3_stmt*>(stmt), prepared); // statement is reused
+    stmt.bind(1, i);
+    BOOST_CHECK_EQUAL(stmt.step(), SQLITE_DONE);
+  }
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+
+  {
+    Sqlite3Statement outer(cache, "SELECT t1 FROM test ORDER BY t1");
+    BOOST_CHECK_EQUAL(outer.step(), SQLITE_ROW);
+    BOOST_CHECK_EQUAL(outer.getInt(0), 0);
+
+    // nested use of the same SQL gets a separate statement
+    Sqlite3Statement inner(cache, "SELECT t1 FROM test ORDER BY t1");
+    BOOST_CHECK_NE(static_cast<sqlite3_stmt*>(inner), static_cast<sqlite3_stmt*>(outer));
+    BOOST_CHECK_EQUAL(inner.step(), SQLITE_ROW);
+    BOOST_CHECK_EQUAL(inner.getInt(0), 0);
+
+    BOOST_CHECK_EQUAL(outer.step(), SQLITE_ROW);
+    BOOST_CHECK_EQUAL(outer.getInt(0), 1);
+  }
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+
+  {
+    // cached statement was reset after the previous use
+    Sqlite3Statement stmt(cache, "SELECT t1 FROM test ORDER BY t1");
+    BOOST_CHECK_EQUAL(stmt.step(), SQLITE_ROW);
+    BOOST_CHECK_EQUAL(stmt.getInt(0), 0);
+  }
+
+  BOOST_CHECK_THROW(Sqlite3Statement(cache, "bad SQL"), std::domain_error);
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestSqlite3Statement
 BOOST_AUTO_TEST_SUITE_END() // Util
 
@@ -192,6 +192,43 @@ BOOST_AUTO_TEST_CASE(Escape)
   BOOST_CHECK(os.is_equal("%01%2A%3B%C4%DE%FA%B5%CD%EF"));
 }
 
+BOOST_AUTO_TEST_CASE(EscapeIntoBuffer)
+{
+  // long enough to exercise the vectorized path, with reserved characters at various offsets
+  // and bytes with the high bit set, which must not be mistaken for unreserved characters
+  std::string input;
+  for (int i = 0; i < 100; ++i) {
+    input += "Az09-._~";
+    input += static_cast<char>(i % 3 == 0 ? ' ' : i % 3 == 1 ? '\xe1' : '/');
+    input += std::string(static_cast<size_t>(i % 17), 'q');
+  }
+
+  std::string expected;
+  for (char c : input) {
+    if (std::isalnum(static_cast<unsigned char>(c)) || std::strchr("-._~", c) != nullptr) {
+      expected += c;
+    }
+    else {
+      expected += '%';
+      expected += toHexChar((static_cast<uint8_t>(c) >> 4) & 0xf);
+      expected += toHexChar(static_cast<uint8_t>(c) & 0xf);
+    }
+  }
+
+  std::vector<char> buf(3 * input.size());
+  size_t n = escape(buf.data(), input.data(), input.size());
+  BOOST_CHECK_EQUAL(std::string(buf.data(), n), expected);
+  BOOST_CHECK_EQUAL(escape(input), expected);
+  BOOST_CHECK_EQUAL(unescape(expected), input);
+}
+
+BOOST_AUTO_TEST_CASE(UnescapeIntoBuffer)
+{
+  char buf[] = "abc%20def%zz%4";
+  size_t n = unescape(buf, buf, std::strlen(buf)); // in place
+  BOOST_CHECK_EQUAL(std::string(buf, n), "abc def%zz%4");
+}
+
 BOOST_AUTO_TEST_CASE(Unescape)
 {
   BOOST_CHECK_EQUAL(unescape(""), "");
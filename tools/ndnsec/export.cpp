@@ -25,6 +25,8 @@
 #include "ndn-cxx/security/impl/openssl.hpp"
 #include "ndn-cxx/util/io.hpp"
 
+#include <fstream>
+
 #include <boost/scope_exit.hpp>
 
 namespace ndn {
@@ -39,6 +41,7 @@ ndnsec_export(int argc, char** argv)
   bool isIdentityName = false;
   bool isKeyName = false;
   bool isCertName = false;
+  bool wantAllKeys = false;
   std::string output;
   std::string password;
 
@@ -49,7 +52,7 @@ ndnsec_export(int argc, char** argv)
   } BOOST_SCOPE_EXIT_END
 
   po::options_description visibleOptDesc(
-    "Usage: ndnsec export [-h] [-o FILE] [-P PASSPHRASE] [-i|-k|-c] NAME\n"
+    "Usage: ndnsec export [-h] [-o FILE] [-P PASSPHRASE] [-i [-A]|-k|-c] NAME\n"
     "\n"
     "Options");
   visibleOptDesc.add_options()
@@ -61,6 +64,8 @@ ndnsec_export(int argc, char** argv)
     ("cert,c",     po::bool_switch(&isCertName),
                    "treat the NAME argument as a certificate name "
                    "(e.g., /ndn/edu/ucla/alice/KEY/1%5D%A7g%90%B2%CF%AA/self/%FD%00%00%01r-%D3%DC%2A)")
+    ("all-keys,A", po::bool_switch(&wantAllKeys),
+                   "export every key of the identity, each with its default certificate")
     ("output,o",   po::value<std::string>(&output)->default_value("-"),
                    "output file, '-' for stdout (the default)")
     ("password,P", po::value<std::string>(&password),
@@ -108,9 +113,24 @@ ndnsec_export(int argc, char** argv)
     isIdentityName = true;
   }
 
+  if (wantAllKeys && !isIdentityName) {
+    std::cerr << "ERROR: '--all-keys' requires an identity name" << std::endl;
+    return 2;
+  }
+
   security::v2::KeyChain keyChain;
-  auto cert = getCertificateFromPib(keyChain.getPib(), name,
-                                    isIdentityName, isKeyName, isCertName);
+  std::vector<security::v2::Certificate> certs;
+  if (wantAllKeys) {
+    const auto& keys = keyChain.getPib().getIdentity(name).getKeys();
+    keys.prefetch();
+    for (const auto& key : keys) {
+      certs.push_back(key.getDefaultCertificate());
+    }
+  }
+  else {
+    certs.push_back(getCertificateFromPib(keyChain.getPib(), name,
+                                          isIdentityName, isKeyName, isCertName));
+  }
 
   if (password.empty()) {
     int count = 3;
@@ -123,12 +143,26 @@ ndnsec_export(int argc, char** argv)
     }
   }
 
-  auto safeBag = keyChain.exportSafeBag(cert, password.data(), password.size());
+  // the private keys are encrypted in parallel; the SafeBags are written as one
+  // base64-encoded sequence of TLV elements, which ndnsec import accepts
+  auto safeBags = keyChain.exportSafeBags(certs, password.data(), password.size());
+  Buffer wire;
+  for (const auto& safeBag : safeBags) {
+    const Block& block = safeBag->wireEncode();
+    wire.insert(wire.end(), block.wire(), block.wire() + block.size());
+  }
 
-  if (output == "-")
-    io::save(*safeBag, std::cout);
-  else
-    io::save(*safeBag, output);
+  if (output == "-") {
+    io::saveBuffer(wire.data(), wire.size(), std::cout);
+  }
+  else {
+    std::ofstream os(output);
+    if (!os) {
+      std::cerr << "ERROR: cannot open '" << output << "'" << std::endl;
+      return 1;
+    }
+    io::saveBuffer(wire.data(), wire.size(), os);
+  }
 
   return 0;
 }
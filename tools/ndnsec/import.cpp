@@ -77,11 +77,28 @@ ndnsec_import(int argc, char** argv)
 
   security::v2::KeyChain keyChain;
 
-  shared_ptr<security::SafeBag> safeBag;
-  if (input == "-")
-    safeBag = io::load<security::SafeBag>(std::cin);
-  else
-    safeBag = io::load<security::SafeBag>(input);
+  // the input may contain several SafeBags, as produced by ndnsec export --all-keys
+  std::vector<security::SafeBag> safeBags;
+  try {
+    std::vector<Block> blocks;
+    if (input == "-")
+      blocks = io::loadBlocks(std::cin, io::BASE64);
+    else
+      blocks = io::loadBlocks(input, io::BASE64);
+
+    safeBags.reserve(blocks.size());
+    for (const auto& block : blocks) {
+      safeBags.emplace_back(block);
+    }
+  }
+  catch (const std::exception& e) {
+    std::cerr << "ERROR: cannot load SafeBag: " << e.what() << std::endl;
+    return 1;
+  }
+  if (safeBags.empty()) {
+    std::cerr << "ERROR: no SafeBag found in input" << std::endl;
+    return 1;
+  }
 
   if (password.empty()) {
     int count = 3;
@@ -94,7 +111,7 @@ ndnsec_import(int argc, char** argv)
     }
   }
 
-  keyChain.importSafeBag(*safeBag, password.data(), password.size());
+  keyChain.importSafeBags(safeBags, password.data(), password.size());
 
   return 0;
 }
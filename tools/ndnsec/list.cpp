@@ -45,7 +45,8 @@ public:
     else
       std::cout << "  ";
 
-    std::cout << identity.getName() << std::endl;
+    // avoid flushing after every line, which dominates the run time with many certificates
+    std::cout << identity.getName() << "\n";
 
     if (m_verboseLevel >= 1) {
       security::Key defaultKey;
@@ -56,11 +57,14 @@ public:
         // no default key
       }
 
-      for (const auto& key : identity.getKeys()) {
+      // load all keys of the identity with one PIB query
+      const auto& keys = identity.getKeys();
+      keys.prefetch();
+      for (const auto& key : keys) {
         printKey(key, key == defaultKey);
       }
 
-      std::cout << std::endl;
+      std::cout << "\n";
     }
   }
 
@@ -72,7 +76,7 @@ public:
     else
       std::cout << "  +->  ";
 
-    std::cout << key.getName() << std::endl;
+    std::cout << key.getName() << "\n";
 
     if (m_verboseLevel >= 2) {
       security::v2::Certificate defaultCert;
@@ -83,7 +87,10 @@ public:
         // no default certificate
       }
 
-      for (const auto& cert : key.getCertificates()) {
+      // load all certificates of the key with one PIB query
+      const auto& certs = key.getCertificates();
+      certs.prefetch();
+      for (const auto& cert : certs) {
         printCertificate(cert, cert == defaultCert);
       }
     }
@@ -97,7 +104,7 @@ public:
     else
       std::cout << "       +->  ";
 
-    std::cout << cert.getName() << std::endl;
+    std::cout << cert.getName() << "\n";
 
     if (m_verboseLevel >= 3) {
       util::IndentedStream os(std::cout, "            ");
@@ -167,6 +174,7 @@ ndnsec_list(int argc, char** argv)
   for (const auto& identity : keyChain.getPib().getIdentities()) {
     printer.printIdentity(identity, identity == defaultIdentity);
   }
+  std::cout.flush();
 
   return 0;
 }